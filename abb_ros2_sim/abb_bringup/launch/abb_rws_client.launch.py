@@ -10,6 +10,14 @@ def generate_launch_description():
     robot_nickname = LaunchConfiguration("robot_nickname")
     polling_rate = LaunchConfiguration("polling_rate")
     no_connection_timeout = LaunchConfiguration("no_connection_timeout")
+    description_cache_dir = LaunchConfiguration("description_cache_dir")
+    use_subscriptions = LaunchConfiguration("use_subscriptions")
+    fallback_polling_rate = LaunchConfiguration("fallback_polling_rate")
+    concurrent_services = LaunchConfiguration("concurrent_services")
+    state_bridge = LaunchConfiguration("state_bridge")
+    state_bridge_rate = LaunchConfiguration("state_bridge_rate")
+    rws_sessions = LaunchConfiguration("rws_sessions")
+    publish_diagnostics = LaunchConfiguration("publish_diagnostics")
 
     declared_arguments = []
 
@@ -46,6 +54,15 @@ def generate_launch_description():
         )
     )
 
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "description_cache_dir",
+            default_value="",
+            description="Directory for caching the robot controller description between launches \
+            (empty to always retrieve it via RWS).",
+        )
+    )
+
     declared_arguments.append(
         DeclareLaunchArgument(
             "polling_rate",
@@ -54,6 +71,68 @@ def generate_launch_description():
         )
     )
 
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "use_subscriptions",
+            default_value="false",
+            description="Specifies whether the controller state is pushed via an RWS subscription \
+            (with polling kept as a fallback).",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "fallback_polling_rate",
+            default_value="1.0",
+            description="The frequency [Hz] at which the controller state is polled while the RWS subscription \
+            is active (joint states not from a state bridge are still polled at polling_rate).",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "concurrent_services",
+            default_value="false",
+            description="Specifies whether services of different categories are executed concurrently, \
+            each category in its own callback group.",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "state_bridge",
+            default_value="",
+            description="Shared memory segment in which the hardware interface on this host publishes the joint \
+            states, which are then used instead of polling them via RWS (empty to always poll).",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "state_bridge_rate",
+            default_value="50.0",
+            description="The frequency [Hz] at which joint states are published from the state bridge.",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "rws_sessions",
+            default_value="5",
+            description="The maximum number of RWS sessions, which are shared by the services and the state \
+            publisher.",
+        )
+    )
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "publish_diagnostics",
+            default_value="false",
+            description="Specifies whether the latencies and errors of the RWS requests are published on \
+            /diagnostics.",
+        )
+    )
+
     node = Node(
         package="abb_rws_client",
         executable="rws_client",
@@ -65,6 +144,14 @@ def generate_launch_description():
             {"robot_nickname": robot_nickname},
             {"polling_rate": polling_rate},
             {"no_connection_timeout": no_connection_timeout},
+            {"description_cache_dir": description_cache_dir},
+            {"use_subscriptions": use_subscriptions},
+            {"fallback_polling_rate": fallback_polling_rate},
+            {"concurrent_services": concurrent_services},
+            {"state_bridge": state_bridge},
+            {"state_bridge_rate": state_bridge_rate},
+            {"rws_sessions": rws_sessions},
+            {"publish_diagnostics": publish_diagnostics},
         ],
     )
     return LaunchDescription(declared_arguments + [node])
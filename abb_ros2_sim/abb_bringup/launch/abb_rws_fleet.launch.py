@@ -0,0 +1,28 @@
+from launch import LaunchDescription
+from launch.actions import DeclareLaunchArgument
+from launch.substitutions import LaunchConfiguration, PathJoinSubstitution
+from launch_ros.actions import Node
+from launch_ros.substitutions import FindPackageShare
+
+
+def generate_launch_description():
+    fleet_config = LaunchConfiguration("fleet_config")
+
+    declared_arguments = []
+
+    declared_arguments.append(
+        DeclareLaunchArgument(
+            "fleet_config",
+            default_value=PathJoinSubstitution([FindPackageShare("abb_bringup"), "config", "abb_rws_fleet.yaml"]),
+            description="YAML file with the robot controllers of the fleet, and the polling parameters.",
+        )
+    )
+
+    node = Node(
+        package="abb_rws_client",
+        executable="rws_fleet",
+        name="rws_fleet",
+        output="screen",
+        parameters=[fleet_config],
+    )
+    return LaunchDescription(declared_arguments + [node])
@@ -17,6 +17,14 @@
 
 #include <abb_egm_rws_managers/egm_manager.h>
 #include <abb_egm_rws_managers/rws_manager.h>
+#include <abb_hardware_interface/cycle_statistics.hpp>
+#include <abb_hardware_interface/description_cache.hpp>
+#include <abb_hardware_interface/diagnostics_publisher.hpp>
+#include <abb_hardware_interface/egm_channels.hpp>
+#include <abb_hardware_interface/egm_io_thread.hpp>
+#include <abb_hardware_interface/joint_buffers.hpp>
+#include <abb_hardware_interface/state_bridge.hpp>
+#include <abb_hardware_interface/telemetry_recorder.hpp>
 #include <abb_hardware_interface/visibility_control.h>
 
 #include <chrono>
@@ -58,6 +66,9 @@ public:
   ROS2_CONTROL_DRIVER_PUBLIC
   CallbackReturn on_activate(const rclcpp_lifecycle::State& previous_state) override;
 
+  ROS2_CONTROL_DRIVER_PUBLIC
+  CallbackReturn on_deactivate(const rclcpp_lifecycle::State& previous_state) override;
+
   ROS2_CONTROL_DRIVER_PUBLIC
   return_type read(const rclcpp::Time& time, const rclcpp::Duration& period) override;
 
@@ -65,12 +76,41 @@ public:
   return_type write(const rclcpp::Time& time, const rclcpp::Duration& period) override;
 
 private:
+  // Appends the joint states or commands of all groups to the telemetry file
+  void recordTelemetry(TelemetryKind kind);
+
   // EGM
   abb::robot::RobotControllerDescription robot_controller_description_;
-  std::unique_ptr<abb::robot::EGMManager> egm_manager_;
 
-  // Store the state and commands for the robot(s)
-  abb::robot::MotionData motion_data_;
+  // RWS, kept alive for revalidating a cached robot controller description in the background
+  std::unique_ptr<abb::robot::RWSManager> rws_manager_;
+  std::unique_ptr<abb::robot::utilities::DescriptionCache> description_cache_;
+  // One EGM channel per mechanical units group, each storing the state and commands for its robot
+  EGMChannels egm_channels_;
+
+  // Time allowed for connecting to RWS and EGM
+  std::chrono::nanoseconds startup_timeout_{ 0 };
+
+  // Flat state and command buffers that the ros2_control interfaces point into
+  JointBuffers joint_buffers_;
+
+  // Timing instrumentation, optionally published on /diagnostics
+  CycleStatistics cycle_statistics_;
+  std::unique_ptr<DiagnosticsPublisher> diagnostics_publisher_;
+
+  // Optional recording of every state and command, into a memory-mapped ring file
+  std::unique_ptr<TelemetryRecorder> telemetry_recorder_;
+
+  // Optional shared memory segment, which serves the joint states to other processes on the host (e.g. the RWS client)
+  std::unique_ptr<StateBridgeWriter> state_bridge_;
+
+  // Optional EGM I/O thread, which decouples the EGM exchange from the controller cycle
+  // (declared after the data it uses, so that it is stopped first)
+  std::unique_ptr<EGMIOThread> egm_io_thread_;
+  int egm_io_thread_cpu_ = -1;
+
+  // Age [s] of the last EGM message, only exported when the EGM I/O thread is used
+  double egm_packet_age_ = std::numeric_limits<double>::infinity();
 };
 
 }  // namespace abb_hardware_interface
@@ -0,0 +1,143 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_hardware_interface/latency_histogram.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Timing statistics of the hardware interface's control cycle and of the EGM communication.
+ *
+ * The record methods are real-time safe (see LatencyHistogram), and each one must only be called from a single
+ * thread. The statistics may be read concurrently from any thread.
+ */
+class CycleStatistics
+{
+public:
+  /**
+   * \brief Creates the statistics.
+   *
+   * \param nominal_cycle_ns expected period [ns] of both the control cycle and the EGM messages.
+   */
+  explicit CycleStatistics(std::int64_t nominal_cycle_ns = DEFAULT_NOMINAL_CYCLE_NS);
+
+  /**
+   * \brief Gets the current time, as used by the record methods.
+   *
+   * \return std::int64_t with the steady clock time [ns].
+   */
+  static std::int64_t now();
+
+  /**
+   * \brief Sets the expected period of the control cycle and of the EGM messages.
+   *
+   * Not thread safe, i.e. only to be called before any recording takes place.
+   *
+   * \param nominal_cycle_ns with the period [ns].
+   */
+  void setNominalCycle(std::int64_t nominal_cycle_ns);
+
+  /**
+   * \brief Records the start of a read() call, which marks the start of a control cycle.
+   *
+   * \param start_ns time [ns] at which the call started.
+   */
+  void recordReadStart(std::int64_t start_ns);
+
+  /**
+   * \brief Records the duration of a read() call.
+   *
+   * \param duration_ns of the call [ns].
+   */
+  void recordReadDuration(std::int64_t duration_ns);
+
+  /**
+   * \brief Records the duration of a write() call.
+   *
+   * \param duration_ns of the call [ns].
+   */
+  void recordWriteDuration(std::int64_t duration_ns);
+
+  /**
+   * \brief Records the arrival of an EGM message.
+   *
+   * \param stamp_ns time [ns] at which the message arrived.
+   */
+  void recordEGMMessage(std::int64_t stamp_ns);
+
+  const LatencyHistogram& readDuration() const { return read_duration_; }
+  const LatencyHistogram& writeDuration() const { return write_duration_; }
+  const LatencyHistogram& cyclePeriod() const { return cycle_period_; }
+  const LatencyHistogram& egmInterArrival() const { return egm_inter_arrival_; }
+
+  /**
+   * \brief Gets the number of control cycles that were missed, i.e. periods that were not started on time.
+   *
+   * \return std::uint64_t with the number of missed cycles.
+   */
+  std::uint64_t missedCycles() const { return missed_cycles_.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Gets the number of EGM messages that were missed, i.e. that did not arrive on time.
+   *
+   * \return std::uint64_t with the number of missed messages.
+   */
+  std::uint64_t missedEGMMessages() const { return missed_egm_messages_.load(std::memory_order_relaxed); }
+
+  /**
+   * \brief Gets the expected period.
+   *
+   * \return std::int64_t with the period [ns].
+   */
+  std::int64_t nominalCycle() const { return nominal_cycle_ns_; }
+
+  /**
+   * \brief Default expected period [ns], i.e. the 4 ms EGM cycle.
+   */
+  static constexpr std::int64_t DEFAULT_NOMINAL_CYCLE_NS = 4000000;
+
+private:
+  /**
+   * \brief Counts how many periods were missed in an interval.
+   *
+   * An interval counts as late once it exceeds 1.5 periods, and each further period counts as one more miss.
+   *
+   * \param interval_ns to check [ns].
+   *
+   * \return std::uint64_t with the number of missed periods.
+   */
+  std::uint64_t missedPeriods(std::int64_t interval_ns) const;
+
+  std::int64_t nominal_cycle_ns_;
+
+  LatencyHistogram read_duration_;
+  LatencyHistogram write_duration_;
+  LatencyHistogram cycle_period_;
+  LatencyHistogram egm_inter_arrival_;
+
+  std::atomic<std::uint64_t> missed_cycles_{ 0 };
+  std::atomic<std::uint64_t> missed_egm_messages_{ 0 };
+
+  /**
+   * \brief Previous timestamps, each only used by the thread that records them.
+   */
+  std::int64_t last_read_start_ns_ = 0;
+  std::int64_t last_egm_message_ns_ = 0;
+};
+}  // namespace abb_hardware_interface
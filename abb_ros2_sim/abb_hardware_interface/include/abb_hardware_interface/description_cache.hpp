@@ -0,0 +1,113 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_egm_rws_managers/rws_manager.h>
+
+#include <functional>
+#include <future>
+#include <string>
+
+namespace abb
+{
+namespace robot
+{
+namespace utilities
+{
+/**
+ * \brief On-disk cache of a robot controller description, to skip the RWS crawl on warm restarts.
+ *
+ * The description is stored as a serialized protobuf message, in one file per robot controller (identified by its
+ * IP address, RWS port and ID). Several processes may share the same cache directory.
+ */
+class DescriptionCache
+{
+public:
+  /**
+   * \brief Creates a cache.
+   *
+   * \param directory to store the cache files in. It is created if it does not exist.
+   * \param robot_ip of the robot controller.
+   * \param robot_port of the robot controller's RWS server.
+   * \param robot_controller_id for an identifier/nickname for the robot controller.
+   */
+  DescriptionCache(const std::string& directory, const std::string& robot_ip, unsigned short robot_port,
+                   const std::string& robot_controller_id);
+
+  /**
+   * \brief Waits for any ongoing revalidation to finish.
+   */
+  ~DescriptionCache();
+
+  /**
+   * \brief Gets the robot controller description, from the cache if possible.
+   *
+   * On a cache hit, the cached description is returned immediately, and revalidated in the background by crawling the
+   * robot controller once more. If the robot controller has changed (e.g. a new RobotWare version), the cache is
+   * updated so that the next start uses the new description. On a cache miss, the description is retrieved by
+   * establish_connection, and stored.
+   *
+   * \param rws_manager for the revalidation. Must outlive the cache.
+   * \param establish_connection to retrieve the description via RWS on a cache miss.
+   *
+   * \return RobotControllerDescription of the robot controller.
+   *
+   * \throw std::runtime_error if there is a cache miss and establish_connection fails.
+   */
+  RobotControllerDescription get(RWSManager& rws_manager,
+                                 const std::function<RobotControllerDescription()>& establish_connection);
+
+  /**
+   * \brief Loads the cached description.
+   *
+   * \param description to load into.
+   *
+   * \return bool true if a cached description was found and could be parsed.
+   */
+  bool load(RobotControllerDescription& description) const;
+
+  /**
+   * \brief Stores a description in the cache, replacing the cached one atomically.
+   *
+   * \param description to store.
+   *
+   * \return bool true if the description was stored.
+   */
+  bool store(const RobotControllerDescription& description) const;
+
+  /**
+   * \brief Gets the path of the cache file.
+   *
+   * \return const std::string& with the path.
+   */
+  const std::string& path() const { return path_; }
+
+private:
+  /**
+   * \brief Crawls the robot controller, and updates the cache if the description differs from the cached one.
+   *
+   * \param rws_manager for the RWS communication with the robot controller.
+   * \param cached description to compare with.
+   */
+  void revalidate(RWSManager& rws_manager, const RobotControllerDescription& cached) const;
+
+  std::string directory_;
+  std::string path_;
+  std::string robot_controller_id_;
+  std::future<void> revalidation_;
+};
+}  // namespace utilities
+}  // namespace robot
+}  // namespace abb
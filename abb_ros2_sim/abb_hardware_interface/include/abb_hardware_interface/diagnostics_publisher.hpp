@@ -0,0 +1,74 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_hardware_interface/cycle_statistics.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Periodically publishes cycle statistics on the /diagnostics topic.
+ *
+ * Runs its own node and executor in a separate thread, so that neither the summarizing nor the publishing ever
+ * happens on the real-time control thread.
+ */
+class DiagnosticsPublisher
+{
+public:
+  /**
+   * \brief Creates the publisher, and starts publishing.
+   *
+   * \param hardware_name of the ros2_control hardware component, used as diagnostics hardware ID and in the name of
+   * the publishing node ("<hardware_name>_diagnostics").
+   * \param statistics to publish. Must outlive the publisher.
+   * \param period [s] between publications.
+   */
+  DiagnosticsPublisher(const std::string& hardware_name, const CycleStatistics& statistics, double period);
+
+  /**
+   * \brief Stops publishing.
+   */
+  ~DiagnosticsPublisher();
+
+private:
+  /**
+   * \brief Summarizes the statistics, and publishes them.
+   */
+  void timerCallback();
+
+  std::string hardware_name_;
+  const CycleStatistics& statistics_;
+
+  std::shared_ptr<rclcpp::Node> node_;
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr publisher_;
+  rclcpp::TimerBase::SharedPtr timer_;
+  std::shared_ptr<rclcpp::executors::SingleThreadedExecutor> executor_;
+  std::thread thread_;
+
+  /**
+   * \brief Missed counts at the previous publication, used to detect new misses.
+   */
+  std::uint64_t last_missed_cycles_ = 0;
+  std::uint64_t last_missed_egm_messages_ = 0;
+};
+}  // namespace abb_hardware_interface
@@ -0,0 +1,167 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_egm_rws_managers/egm_manager.h>
+#include <abb_hardware_interface/egm_reactor.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief EGM channels of all mechanical units groups, with one EGM manager (and motion data) per group.
+ *
+ * Keeping the groups apart allows waiting for every channel to connect concurrently, and knowing which ones did.
+ *
+ * Alternatively, all channels are serviced by a single EGMReactor, which reads every group that has a new message
+ * instead of pacing all of them by the first one.
+ */
+class EGMChannels
+{
+public:
+  /**
+   * \brief Stops any ongoing connection attempts.
+   */
+  ~EGMChannels();
+
+  /**
+   * \brief Services all channels from a single EGM reactor, instead of one EGM manager per channel.
+   *
+   * Must be called before the first channel is added.
+   *
+   * \throw std::runtime_error if the reactor could not be created.
+   */
+  void useReactor();
+
+  /**
+   * \brief Adds a channel for a mechanical units group, and opens its EGM port.
+   *
+   * \param description of the robot controller.
+   * \param group of the robot controller description to add a channel for.
+   * \param port to listen on for EGM messages from the group.
+   *
+   * \throw std::runtime_error if the motion data could not be initialized or the EGM port could not be opened.
+   */
+  void addChannel(const abb::robot::RobotControllerDescription& description,
+                  const abb::robot::MechanicalUnitGroup& group, std::uint16_t port);
+
+  /**
+   * \brief Starts waiting, concurrently on every channel, for the first EGM message.
+   *
+   * The attempts end as soon as any channel received a message, or at the deadline.
+   *
+   * \param deadline until which to wait.
+   */
+  void startConnecting(std::chrono::steady_clock::time_point deadline);
+
+  /**
+   * \brief Checks whether there are connection attempts that have not been finished yet.
+   *
+   * \return bool true if startConnecting() was called since the last finishConnecting().
+   */
+  bool isConnecting() const;
+
+  /**
+   * \brief Waits for the connection attempts started by startConnecting() to end, i.e. for any channel to receive a
+   * message or for the deadline, and cancels the attempts of the other channels.
+   *
+   * \return std::vector<std::string> with the names of the groups that did not connect (yet), all groups on failure.
+   */
+  std::vector<std::string> finishConnecting();
+
+  /**
+   * \brief Gets the number of channels.
+   *
+   * \return std::size_t with the number of channels.
+   */
+  std::size_t size() const { return channels_.size(); }
+
+  /**
+   * \brief Waits for an EGM message on any channel.
+   *
+   * With one EGM manager per channel, the managers are waited on in turn, for WAIT_SLICE_MS at a time, so that a
+   * group that stopped sending does not stall the others. With the reactor, all channels are waited on at once, and
+   * the message is already read.
+   *
+   * \param timeout_ms for the wait [ms].
+   *
+   * \return bool true if a message was received before the timeout.
+   */
+  bool waitForMessage(unsigned int timeout_ms);
+
+  /**
+   * \brief Reads the latest EGM states of every channel into its motion data.
+   *
+   * With the reactor, only the channels with new messages are read, and this never waits.
+   */
+  void read();
+
+  /**
+   * \brief Writes the commands in the motion data of every channel to EGM.
+   *
+   * With the reactor, the commands are only sent to the channels that sent a message since the last write.
+   */
+  void write();
+
+  /**
+   * \brief Gets the motion data of every channel.
+   *
+   * The motion data stays at the same address for the lifetime of the channels.
+   *
+   * \return std::vector<abb::robot::MotionData*> with the motion data, in the order the channels were added.
+   */
+  std::vector<abb::robot::MotionData*> motionData();
+
+private:
+  /**
+   * \brief Time [ms] to wait for a message at a time, which bounds how long stopping to connect takes.
+   */
+  static constexpr unsigned int CONNECTION_POLL_MS = 100;
+
+  /**
+   * \brief Time [ms] to wait on one of several EGM managers at a time, well below an EGM cycle (4 ms at 250 Hz).
+   */
+  static constexpr unsigned int WAIT_SLICE_MS = 1;
+
+  struct Channel
+  {
+    std::string name;
+    std::unique_ptr<abb::robot::EGMManager> egm_manager;
+    abb::robot::MotionData motion_data;
+
+    /**
+     * \brief Pending connection attempt (destroyed first, as it uses the EGM manager).
+     */
+    std::future<bool> connection;
+  };
+
+  std::vector<std::unique_ptr<Channel>> channels_;
+  std::atomic<bool> stop_connecting_{ false };
+
+  /**
+   * \brief Reactor for all channels, if used, and its pending connection attempt.
+   */
+  std::unique_ptr<EGMReactor> reactor_;
+  std::future<bool> reactor_connection_;
+};
+}  // namespace abb_hardware_interface
@@ -0,0 +1,113 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_hardware_interface/cycle_statistics.hpp>
+#include <abb_hardware_interface/egm_channels.hpp>
+#include <abb_hardware_interface/joint_buffers.hpp>
+#include <abb_hardware_interface/triple_buffer.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Dedicated thread that exchanges motion data with the EGM channels, independently of the controller cycle.
+ *
+ * The thread waits for EGM messages, and for each one publishes the new joint states and forwards the latest joint
+ * commands. States and commands are handed to/from the controller thread through wait-free triple buffers, so
+ * neither side ever blocks on the other.
+ */
+class EGMIOThread
+{
+public:
+  /**
+   * \brief Creates an (idle) EGM I/O thread.
+   *
+   * \param egm_channels to exchange motion data with. Only used by the thread while it is running.
+   * \param joint_buffers bound to the motion data of the channels.
+   * \param statistics to record the EGM message arrivals in.
+   */
+  EGMIOThread(EGMChannels& egm_channels, JointBuffers& joint_buffers, CycleStatistics& statistics);
+
+  /**
+   * \brief Stops the thread, if it is running.
+   */
+  ~EGMIOThread();
+
+  /**
+   * \brief Starts the thread.
+   *
+   * The current commands in the joint buffers are forwarded until the first call to writeCommands().
+   *
+   * \param cpu_core to pin the thread to. A negative value means no pinning.
+   *
+   * \return bool true if the thread was started and, if requested, pinned to the core.
+   */
+  bool start(int cpu_core);
+
+  /**
+   * \brief Stops the thread, and waits for it to finish.
+   */
+  void stop();
+
+  /**
+   * \brief Copies the most recently received joint states into the joint buffers.
+   *
+   * To be called from the controller thread.
+   *
+   * \return bool true if new states had been received since the last call.
+   */
+  bool readStates();
+
+  /**
+   * \brief Hands the commands in the joint buffers over to the thread.
+   *
+   * To be called from the controller thread.
+   */
+  void writeCommands();
+
+  /**
+   * \brief Gets the age of the most recently received EGM message.
+   *
+   * To be called from the controller thread, after readStates().
+   *
+   * \return double with the age [s], or infinity if no message has been received yet.
+   */
+  double packetAge() const;
+
+private:
+  /**
+   * \brief Main loop of the thread.
+   */
+  void run();
+
+  /**
+   * \brief Timeout [ms] for waiting on EGM messages, which bounds how long stop() takes.
+   */
+  static constexpr unsigned int WAIT_TIMEOUT_MS = 10;
+
+  EGMChannels& egm_channels_;
+  JointBuffers& joint_buffers_;
+  CycleStatistics& statistics_;
+
+  TripleBuffer<JointSample> states_;
+  TripleBuffer<JointSample> commands_;
+
+  std::atomic<bool> running_{ false };
+  std::thread thread_;
+};
+}  // namespace abb_hardware_interface
@@ -0,0 +1,237 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_egm_rws_managers/egm_manager.h>
+#include <abb_libegm/egm.pb.h>
+
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Services the EGM channels of all mechanical units groups from a single epoll instance.
+ *
+ * Every group has its own UDP socket, and poll() drains all readable sockets with recvmmsg. Only the newest message
+ * of each group is parsed: older ones are stale by the time they are read. The states go straight into the group's
+ * motion data, and reply() answers each group that sent a message since the last reply with the commands in its
+ * motion data. A group without a new message is skipped, so a slow group never delays the others.
+ *
+ * Until reply() is called for the first time, messages are answered right away with their own feedback, so the robot
+ * holds its position while the connection is established.
+ *
+ * After the groups have been added, polling and replying neither allocate nor block (unless poll() is given a
+ * timeout). The reactor is not thread safe.
+ */
+class EGMReactor
+{
+public:
+  /**
+   * \brief Creates a reactor without groups.
+   *
+   * \throw std::runtime_error if the epoll instance could not be created.
+   */
+  EGMReactor();
+
+  /**
+   * \brief Closes all sockets.
+   */
+  ~EGMReactor();
+
+  EGMReactor(const EGMReactor&) = delete;
+  EGMReactor& operator=(const EGMReactor&) = delete;
+
+  /**
+   * \brief Adds a mechanical units group, and opens its EGM port.
+   *
+   * \param description of the group.
+   * \param motion_data with only the group, as created from its description. Must outlive the reactor, and must not
+   * be resized or moved afterwards.
+   * \param port to listen on for EGM messages from the group. Zero picks a free port, see port().
+   *
+   * \throw std::runtime_error if the joints of the description and motion data differ, or the port could not be
+   * opened.
+   */
+  void addGroup(const abb::robot::MechanicalUnitGroup& description, abb::robot::MotionData& motion_data,
+                std::uint16_t port);
+
+  /**
+   * \brief Reads the newest EGM message of every group with pending messages into its motion data.
+   *
+   * \param timeout_ms to wait for the first message [ms], zero to only check.
+   *
+   * \return std::size_t with the number of groups that received a new message.
+   */
+  std::size_t poll(unsigned int timeout_ms);
+
+  /**
+   * \brief Sends the commands in the motion data to every group that sent a message since its last reply.
+   */
+  void reply();
+
+  /**
+   * \brief Forgets the connections, e.g. before reconnecting after a deactivation.
+   *
+   * The pending messages are discarded, every group is disconnected, and messages are answered with their own
+   * feedback again until the next reply().
+   */
+  void reset();
+
+  /**
+   * \brief Gets the number of groups.
+   *
+   * \return std::size_t with the number of groups, in the order they were added.
+   */
+  std::size_t size() const { return groups_.size(); }
+
+  /**
+   * \brief Checks whether a group received a new message in the last poll().
+   *
+   * \param index of the group.
+   *
+   * \return bool true if the group's motion data was updated.
+   */
+  bool fresh(std::size_t index) const { return groups_[index]->fresh; }
+
+  /**
+   * \brief Checks whether a group has received any message so far.
+   *
+   * \param index of the group.
+   *
+   * \return bool true if the group is connected.
+   */
+  bool connected(std::size_t index) const { return groups_[index]->connected; }
+
+  /**
+   * \brief Gets the port a group listens on.
+   *
+   * \param index of the group.
+   *
+   * \return std::uint16_t with the port.
+   */
+  std::uint16_t port(std::size_t index) const { return groups_[index]->port; }
+
+  /**
+   * \brief Gets the number of messages that were dropped because a newer one of the same group was already pending.
+   *
+   * \return std::uint64_t with the number of messages.
+   */
+  std::uint64_t coalescedMessages() const { return coalesced_messages_; }
+
+private:
+  /**
+   * \brief Largest EGM message [bytes] that is accepted.
+   */
+  static constexpr std::size_t MAX_MESSAGE_SIZE = 2048;
+
+  /**
+   * \brief Messages received per recvmmsg call.
+   */
+  static constexpr std::size_t RECEIVE_BATCH = 8;
+
+  /**
+   * \brief Robot joints that EGM reports as robot joints, the others (e.g. of 7 axes robots) are external joints.
+   */
+  static constexpr int MAX_ROBOT_JOINTS = 6;
+
+  /**
+   * \brief Binding of one joint to its motion data, with the conversion from the EGM units (degrees or mm).
+   */
+  struct Joint
+  {
+    double* state_position;
+    double* state_velocity;
+    const double* command_position;
+    const double* command_velocity;
+    double scale;
+  };
+
+  struct Group
+  {
+    int socket = -1;
+    std::uint16_t port = 0;
+    std::vector<Joint> joints;
+    int num_robot_joints = 0;
+
+    bool connected = false;
+    bool fresh = false;
+    bool pending_reply = false;
+    sockaddr_in sender{};
+
+    /**
+     * \brief Controller time [s] of the last feedback, for the velocity estimate.
+     */
+    double feedback_time = 0.0;
+
+    std::uint32_t sequence_number = 0;
+  };
+
+  /**
+   * \brief Receives all pending messages of a group, and parses the newest one.
+   *
+   * \param group to receive for.
+   */
+  void receive(Group& group);
+
+  /**
+   * \brief Parses a message into the motion data of a group.
+   *
+   * \param group that sent the message.
+   * \param data of the message.
+   * \param size of the message [bytes].
+   *
+   * \return bool true if the message was valid.
+   */
+  bool parse(Group& group, const char* data, std::size_t size);
+
+  /**
+   * \brief Sends the commands of a group, or its last feedback if no commands were written yet.
+   *
+   * \param group to send to.
+   */
+  void send(Group& group);
+
+  int epoll_fd_ = -1;
+  std::vector<std::unique_ptr<Group>> groups_;
+  std::vector<epoll_event> events_;
+  bool commanding_ = false;
+  std::uint64_t coalesced_messages_ = 0;
+  std::chrono::steady_clock::time_point start_time_;
+
+  /**
+   * \brief Receive buffers, shared by all groups.
+   */
+  std::array<std::array<char, MAX_MESSAGE_SIZE>, RECEIVE_BATCH> buffers_;
+  std::array<sockaddr_in, RECEIVE_BATCH> senders_;
+  std::array<iovec, RECEIVE_BATCH> iovecs_;
+  std::array<mmsghdr, RECEIVE_BATCH> messages_;
+
+  /**
+   * \brief Messages that are reused for every group, so that they keep their allocations.
+   */
+  abb::egm::EgmRobot robot_message_;
+  abb::egm::EgmSensor sensor_message_;
+  std::array<char, MAX_MESSAGE_SIZE> send_buffer_;
+};
+}  // namespace abb_hardware_interface
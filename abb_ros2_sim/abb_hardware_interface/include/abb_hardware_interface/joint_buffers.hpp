@@ -0,0 +1,201 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_egm_rws_managers/egm_manager.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Pre-resolved addresses of one joint's state and command inside the motion data exchanged with EGM.
+ */
+struct JointBinding
+{
+  const double* state_position;
+  const double* state_velocity;
+  double* command_position;
+  double* command_velocity;
+};
+
+/**
+ * \brief Flat, structure-of-arrays storage for the joints of one mechanical units group.
+ *
+ * All arrays have one entry per joint (in the order the joints appear in the group's mechanical units), and are
+ * sized once during initialization. They are never resized afterwards, so pointers into them stay valid.
+ */
+struct GroupJointBuffers
+{
+  /**
+   * \brief Name of the mechanical units group.
+   */
+  std::string name;
+
+  /**
+   * \brief Joint names, as used for the ros2_control state and command interfaces.
+   */
+  std::vector<std::string> joint_names;
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  std::vector<double> position_commands;
+  std::vector<double> velocity_commands;
+
+  /**
+   * \brief Bindings to the joints in the motion data, in the same order as the arrays above.
+   */
+  std::vector<JointBinding> bindings;
+};
+
+/**
+ * \brief Flat snapshot of the joint states or commands of all mechanical units groups, for handing them between
+ * threads.
+ */
+struct JointSample
+{
+  /**
+   * \brief Joint positions, in the order the joints appear in JointBuffers::groups().
+   */
+  std::vector<double> positions;
+
+  /**
+   * \brief Joint velocities, in the same order as the positions.
+   */
+  std::vector<double> velocities;
+
+  /**
+   * \brief Steady clock time [ns] at which the sample was taken.
+   */
+  std::int64_t stamp_ns = 0;
+};
+
+/**
+ * \brief Contiguous joint state and command buffers for all mechanical units groups.
+ *
+ * The ros2_control interfaces point into these buffers instead of into the nested MotionData structure. The
+ * update methods only copy doubles through pre-resolved bindings, i.e. they neither allocate nor touch any strings,
+ * which makes them safe to call from the real-time control loop.
+ */
+class JointBuffers
+{
+public:
+  /**
+   * \brief Sizes the buffers and resolves the bindings to the joints of a motion data instance.
+   *
+   * The motion data must outlive the buffers, and it must not be resized or moved afterwards.
+   *
+   * \param motion_data to bind to.
+   */
+  void initialize(abb::robot::MotionData& motion_data);
+
+  /**
+   * \brief Sizes the buffers and resolves the bindings to the joints of several motion data instances.
+   *
+   * The groups are laid out in the order of the motion data instances. The same lifetime requirements apply as for
+   * the single instance overload.
+   *
+   * \param motion_data to bind to.
+   */
+  void initialize(const std::vector<abb::robot::MotionData*>& motion_data);
+
+  /**
+   * \brief Copies the joint states from the bound motion data into the buffers.
+   */
+  void updateStates();
+
+  /**
+   * \brief Copies the joint commands from the buffers into the bound motion data.
+   */
+  void updateCommands();
+
+  /**
+   * \brief Sets the position commands to the current positions and the velocity commands to zero.
+   */
+  void holdPositions();
+
+  /**
+   * \brief Creates a sample that is sized for all joints, e.g. to initialize the buffers used between threads.
+   *
+   * \return JointSample with zero positions and velocities.
+   */
+  JointSample makeSample() const;
+
+  /**
+   * \brief Copies the joint states from the bound motion data into a sample.
+   *
+   * Only touches the motion data and the sample, i.e. it may be called from another thread than the one using the
+   * buffers.
+   *
+   * \param sample to fill. Must have been created by makeSample().
+   */
+  void gatherStates(JointSample& sample) const;
+
+  /**
+   * \brief Copies the joint commands from a sample into the bound motion data.
+   *
+   * Only touches the motion data and the sample, i.e. it may be called from another thread than the one using the
+   * buffers.
+   *
+   * \param sample with the commands. Must have been created by makeSample().
+   */
+  void scatterCommands(const JointSample& sample) const;
+
+  /**
+   * \brief Copies the joint states from a sample into the buffers.
+   *
+   * \param sample with the states. Must have been created by makeSample().
+   */
+  void loadStates(const JointSample& sample);
+
+  /**
+   * \brief Copies the joint commands from the buffers into a sample.
+   *
+   * \param sample to fill. Must have been created by makeSample().
+   */
+  void storeCommands(JointSample& sample) const;
+
+  /**
+   * \brief Gets the buffers of each mechanical units group.
+   *
+   * \return std::vector<GroupJointBuffers>& with the buffers.
+   */
+  std::vector<GroupJointBuffers>& groups() { return groups_; }
+
+  /**
+   * \brief Gets the total number of joints, across all mechanical units groups.
+   *
+   * \return std::size_t with the number of joints.
+   */
+  std::size_t size() const;
+
+private:
+  std::vector<GroupJointBuffers> groups_;
+};
+
+/**
+ * \brief Strips a joint name, as reported by the robot controller, down to the name used in the robot description.
+ *
+ * E.g. "ROB_1_joint_1" becomes "joint_1".
+ *
+ * \param name to strip.
+ *
+ * \return std::string with the stripped name.
+ */
+std::string stripJointName(const std::string& name);
+}  // namespace abb_hardware_interface
@@ -0,0 +1,189 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Fixed-size, lock-free histogram of durations, with log-linear (HDR style) buckets.
+ *
+ * Values below 2^SUB_BUCKET_BITS ns are counted exactly. Above that, every power of two is split into
+ * 2^SUB_BUCKET_BITS linear buckets, i.e. the relative bucket width is at most 1/32 (about 3 %). Values of 2^37 ns
+ * (about 137 s) and above are clamped to the last bucket.
+ *
+ * Recording only performs relaxed atomic operations on preallocated counters, so it never blocks or allocates and it
+ * is safe to call from the real-time control loop. Summaries may be computed concurrently from any other thread; they
+ * are then approximate, in the sense that concurrently recorded values may or may not be included.
+ */
+class LatencyHistogram
+{
+public:
+  /**
+   * \brief Summary statistics of the recorded values [ns].
+   */
+  struct Summary
+  {
+    std::uint64_t count = 0;
+    std::int64_t min = 0;
+    std::int64_t max = 0;
+    double mean = 0.0;
+    std::int64_t p50 = 0;
+    std::int64_t p90 = 0;
+    std::int64_t p99 = 0;
+    std::int64_t p999 = 0;
+  };
+
+  static constexpr unsigned int SUB_BUCKET_BITS = 5;
+  static constexpr unsigned int MAX_MAGNITUDE = 36;
+  static constexpr std::size_t SUB_BUCKET_COUNT = std::size_t{ 1 } << SUB_BUCKET_BITS;
+  static constexpr std::size_t BUCKET_COUNT = (MAX_MAGNITUDE - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT;
+
+  /**
+   * \brief Records a value.
+   *
+   * \param value_ns to record [ns]. Negative values are recorded as zero.
+   */
+  void record(const std::int64_t value_ns)
+  {
+    const std::uint64_t value = value_ns < 0 ? 0 : static_cast<std::uint64_t>(value_ns);
+    buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t current = max_.load(std::memory_order_relaxed);
+    while (value > current && !max_.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+    current = min_.load(std::memory_order_relaxed);
+    while (value < current && !min_.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  /**
+   * \brief Computes summary statistics of all values recorded so far.
+   *
+   * Reported percentiles are bucket upper bounds, i.e. they overestimate by at most one bucket width.
+   *
+   * \return Summary with the statistics.
+   */
+  Summary summarize() const
+  {
+    Summary summary;
+    std::array<std::uint64_t, BUCKET_COUNT> counts;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+      counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      summary.count += counts[i];
+    }
+    if (summary.count == 0)
+    {
+      return summary;
+    }
+
+    summary.min = static_cast<std::int64_t>(min_.load(std::memory_order_relaxed));
+    summary.max = static_cast<std::int64_t>(max_.load(std::memory_order_relaxed));
+    summary.mean = static_cast<double>(sum_.load(std::memory_order_relaxed)) /
+                   static_cast<double>(std::max<std::uint64_t>(count_.load(std::memory_order_relaxed), 1));
+
+    summary.p50 = percentile(counts, summary.count, 0.5, summary.max);
+    summary.p90 = percentile(counts, summary.count, 0.9, summary.max);
+    summary.p99 = percentile(counts, summary.count, 0.99, summary.max);
+    summary.p999 = percentile(counts, summary.count, 0.999, summary.max);
+    return summary;
+  }
+
+  /**
+   * \brief Maps a value to its bucket.
+   *
+   * \param value [ns] to map.
+   *
+   * \return std::size_t with the bucket index.
+   */
+  static std::size_t bucketIndex(const std::uint64_t value)
+  {
+    if (value < SUB_BUCKET_COUNT)
+    {
+      return static_cast<std::size_t>(value);
+    }
+    const unsigned int magnitude = highestBit(value);
+    if (magnitude > MAX_MAGNITUDE)
+    {
+      return BUCKET_COUNT - 1;
+    }
+    const unsigned int shift = magnitude - SUB_BUCKET_BITS;
+    const std::size_t sub_bucket = static_cast<std::size_t>(value >> shift) - SUB_BUCKET_COUNT;
+    return (shift + 1) * SUB_BUCKET_COUNT + sub_bucket;
+  }
+
+  /**
+   * \brief Gets the largest value that maps to a bucket.
+   *
+   * \param index of the bucket.
+   *
+   * \return std::uint64_t with the upper bound [ns].
+   */
+  static std::uint64_t bucketUpperBound(const std::size_t index)
+  {
+    if (index < SUB_BUCKET_COUNT)
+    {
+      return index;
+    }
+    const std::size_t shift = index / SUB_BUCKET_COUNT - 1;
+    const std::uint64_t lower = (SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT) << shift;
+    return lower + (std::uint64_t{ 1 } << shift) - 1;
+  }
+
+private:
+  static unsigned int highestBit(std::uint64_t value)
+  {
+    unsigned int bit = 0;
+    while (value >>= 1)
+    {
+      ++bit;
+    }
+    return bit;
+  }
+
+  static std::int64_t percentile(const std::array<std::uint64_t, BUCKET_COUNT>& counts, const std::uint64_t total,
+                                 const double fraction, const std::int64_t max)
+  {
+    const auto rank = static_cast<std::uint64_t>(fraction * static_cast<double>(total - 1)) + 1;
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+    {
+      seen += counts[i];
+      if (seen >= rank)
+      {
+        return std::min(static_cast<std::int64_t>(bucketUpperBound(i)), max);
+      }
+    }
+    return max;
+  }
+
+  std::array<std::atomic<std::uint64_t>, BUCKET_COUNT> buckets_{};
+  std::atomic<std::uint64_t> count_{ 0 };
+  std::atomic<std::uint64_t> sum_{ 0 };
+  std::atomic<std::uint64_t> min_{ std::numeric_limits<std::uint64_t>::max() };
+  std::atomic<std::uint64_t> max_{ 0 };
+};
+}  // namespace abb_hardware_interface
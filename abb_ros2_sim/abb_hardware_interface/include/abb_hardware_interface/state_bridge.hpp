@@ -0,0 +1,188 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_hardware_interface/joint_buffers.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Layout of a state bridge segment, in POSIX shared memory (i.e. /dev/shm/<name> on Linux).
+ */
+constexpr char STATE_BRIDGE_MAGIC[8] = { 'A', 'B', 'B', 'S', 'T', 'B', '0', '1' };
+constexpr std::uint32_t STATE_BRIDGE_VERSION = 1;
+constexpr std::size_t STATE_BRIDGE_MAX_JOINTS = 64;
+constexpr std::size_t STATE_BRIDGE_NAME_SIZE = 64;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "State bridges need lock-free 32 bit atomics");
+
+struct StateBridgeSegment
+{
+  char magic[8];
+  std::uint32_t version;
+
+  /**
+   * \brief Incremented (and odd) while the writer sets up the joints, even once they are valid.
+   *
+   * A writer restart may change the joints, so readers resolve them again whenever the generation changes.
+   */
+  std::atomic<std::uint32_t> generation;
+  std::uint32_t num_joints;
+  std::uint32_t reserved;
+
+  /**
+   * \brief Joint names, as "<mechanical units group>/<joint>", with the joint name stripped by stripJointName().
+   */
+  char joint_names[STATE_BRIDGE_MAX_JOINTS][STATE_BRIDGE_NAME_SIZE];
+
+  /**
+   * \brief Odd while a state is being written, even once it is complete.
+   */
+  std::atomic<std::uint32_t> sequence;
+  std::uint32_t padding;
+
+  /**
+   * \brief Steady clock time [ns] at which the state was read from EGM, comparable between processes on a host.
+   */
+  std::int64_t stamp_ns;
+
+  /**
+   * \brief Number of states published by the current writer.
+   */
+  std::uint64_t cycle;
+  double positions[STATE_BRIDGE_MAX_JOINTS];
+  double velocities[STATE_BRIDGE_MAX_JOINTS];
+};
+
+/**
+ * \brief Snapshot of a state bridge.
+ */
+struct StateBridgeSample
+{
+  std::uint32_t generation = 0;
+  std::int64_t stamp_ns = 0;
+  std::uint64_t cycle = 0;
+
+  /**
+   * \brief Joint positions [rad or m] and velocities [rad/s or m/s], in the order of StateBridgeReader::jointNames().
+   */
+  std::vector<double> positions;
+  std::vector<double> velocities;
+};
+
+/**
+ * \brief Builds the name of a joint in a state bridge.
+ *
+ * \param group name of the joint's mechanical units group.
+ * \param joint name of the joint, as reported by the robot controller or already stripped.
+ *
+ * \return std::string with the name.
+ */
+std::string stateBridgeJointName(const std::string& group, const std::string& joint);
+
+/**
+ * \brief Publishes the newest joint states of the hardware interface to other processes on the host.
+ *
+ * The states are exchanged through a shared memory segment, seqlock style: the writer never waits for readers, and
+ * readers retry when they raced with a write. Publishing copies the states and makes no system call, so it may be
+ * called from the real-time control loop. Only one writer may use a segment at a time.
+ *
+ * The segment is kept when the writer goes away, so that readers see the states go stale rather than vanish, and
+ * pick up the next writer of the same name.
+ */
+class StateBridgeWriter
+{
+public:
+  /**
+   * \brief Creates (or takes over) a state bridge segment.
+   *
+   * \param name of the segment, without a leading slash.
+   * \param groups of joints to publish, with the positions and velocities in the order of their joint names.
+   *
+   * \throw std::runtime_error if the segment could not be created, or if there are too many joints.
+   */
+  StateBridgeWriter(const std::string& name, const std::vector<GroupJointBuffers>& groups);
+
+  ~StateBridgeWriter();
+
+  StateBridgeWriter(const StateBridgeWriter&) = delete;
+  StateBridgeWriter& operator=(const StateBridgeWriter&) = delete;
+
+  /**
+   * \brief Publishes the current states.
+   *
+   * \param groups with the states, laid out as at construction.
+   * \param stamp_ns steady clock time [ns] of the states.
+   */
+  void publish(const std::vector<GroupJointBuffers>& groups, std::int64_t stamp_ns);
+
+private:
+  int fd_ = -1;
+  StateBridgeSegment* segment_ = nullptr;
+  std::uint64_t cycle_ = 0;
+};
+
+/**
+ * \brief Reads the joint states that a StateBridgeWriter publishes.
+ */
+class StateBridgeReader
+{
+public:
+  /**
+   * \brief Opens a state bridge segment.
+   *
+   * \param name of the segment, without a leading slash.
+   *
+   * \throw std::runtime_error if the segment does not exist (yet), or is not a state bridge.
+   */
+  explicit StateBridgeReader(const std::string& name);
+
+  ~StateBridgeReader();
+
+  StateBridgeReader(const StateBridgeReader&) = delete;
+  StateBridgeReader& operator=(const StateBridgeReader&) = delete;
+
+  /**
+   * \brief Gets the joint names of the current generation.
+   *
+   * \param generation set to the generation that the names belong to.
+   *
+   * \return std::vector<std::string> with the names, empty if the writer is setting up the joints.
+   */
+  std::vector<std::string> jointNames(std::uint32_t& generation) const;
+
+  /**
+   * \brief Reads the newest states.
+   *
+   * Does not allocate once the sample has been sized by a previous read with the same joints.
+   *
+   * \param sample to read into.
+   *
+   * \return bool true if a complete state was read, false if nothing has been published yet, or if the reads kept
+   * racing with the writer.
+   */
+  bool read(StateBridgeSample& sample) const;
+
+private:
+  int fd_ = -1;
+  const StateBridgeSegment* segment_ = nullptr;
+};
+}  // namespace abb_hardware_interface
@@ -0,0 +1,261 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Layout of a telemetry file: a header of TELEMETRY_HEADER_SIZE bytes, followed by a ring of fixed-size records.
+ *
+ * The layout is shared with the logger recorder of open_abb_sim's abb_node (see telemetry_recorder.h there), so that
+ * the same tools read both. All fields are in host byte order.
+ */
+constexpr char TELEMETRY_MAGIC[8] = { 'A', 'B', 'B', 'T', 'L', 'M', '0', '1' };
+constexpr std::uint32_t TELEMETRY_VERSION = 1;
+constexpr std::size_t TELEMETRY_HEADER_SIZE = 4096;
+constexpr std::size_t TELEMETRY_MAX_GROUPS = 8;
+constexpr std::size_t TELEMETRY_MAX_VALUES = 12;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Telemetry files need lock-free 64 bit atomics");
+
+/**
+ * \brief Producer of a telemetry file, which determines the units of the values.
+ */
+enum class TelemetrySource : std::uint32_t
+{
+  /**
+   * \brief ABBSystemHardware: joint states and commands per mechanical units group [rad, m, rad/s, m/s].
+   */
+  HARDWARE_INTERFACE = 0,
+
+  /**
+   * \brief abb_node: logger samples, with the logger record type as group [mm, deg, N].
+   */
+  LOGGER = 1
+};
+
+enum class TelemetryKind : std::uint8_t
+{
+  FEEDBACK = 0,
+  COMMAND = 1,
+  LOGGER = 2
+};
+
+/**
+ * \brief Joints of a mechanical units group, for interpreting its records.
+ */
+struct TelemetryGroup
+{
+  char name[32];
+  std::uint32_t num_joints;
+
+  /**
+   * \brief Number of the joints that EGM reports as robot joints, the others are external joints.
+   */
+  std::uint32_t num_robot_joints;
+
+  /**
+   * \brief Bit i is set if joint i is linear [m] instead of rotating [rad].
+   */
+  std::uint32_t linear_mask;
+  std::uint32_t reserved;
+};
+
+struct TelemetryHeader
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t record_size;
+  std::uint64_t capacity;
+
+  /**
+   * \brief Number of records appended so far. Record i is in slot i % capacity.
+   */
+  std::atomic<std::uint64_t> written;
+
+  /**
+   * \brief Wall clock time [ns since the epoch] at which the steady clock read start_steady_ns.
+   */
+  std::int64_t start_wall_ns;
+  std::int64_t start_steady_ns;
+  std::uint32_t source;
+  std::uint32_t num_groups;
+  TelemetryGroup groups[TELEMETRY_MAX_GROUPS];
+};
+
+static_assert(sizeof(TelemetryHeader) <= TELEMETRY_HEADER_SIZE, "The telemetry header does not fit");
+
+/**
+ * \brief Payload of a record.
+ */
+struct TelemetrySample
+{
+  /**
+   * \brief Steady clock time [ns] at which the sample was recorded.
+   */
+  std::int64_t stamp_ns;
+
+  /**
+   * \brief Time stamp [s] of the producer, e.g. of the robot's logger, or zero if there is none.
+   */
+  double source_time;
+
+  /**
+   * \brief Index of the mechanical units group, or the logger record type.
+   */
+  std::uint16_t group;
+  TelemetryKind kind;
+  std::uint8_t num_values;
+  std::uint32_t reserved;
+  double positions[TELEMETRY_MAX_VALUES];
+  double velocities[TELEMETRY_MAX_VALUES];
+};
+
+struct TelemetryRecord
+{
+  /**
+   * \brief Index of the record plus one once it is complete, zero while it is being written.
+   */
+  std::atomic<std::uint64_t> sequence;
+  TelemetrySample sample;
+};
+
+/**
+ * \brief Appends fixed-size telemetry records to a preallocated, memory-mapped ring file.
+ *
+ * The file is created with its final size and mapped, and all of its pages are touched (and locked, if permitted)
+ * up front. Appending a record then is a copy into the mapping and two atomic stores: it never allocates, takes a
+ * lock or makes a system call, so it is safe to call from the real-time control loop. The kernel writes the pages
+ * back in the background. On a disk backed file, a write-back can still make the next append fault once; put the
+ * file on a tmpfs (e.g. /dev/shm) to avoid that entirely.
+ *
+ * Once the ring is full, the oldest records are overwritten. Records are published seqlock style, so that the file
+ * can be read while it is written (see TelemetryReader). Only one thread may append.
+ */
+class TelemetryRecorder
+{
+public:
+  /**
+   * \brief Creates (or replaces) a telemetry file.
+   *
+   * \param path of the file.
+   * \param capacity in records.
+   * \param source of the records.
+   * \param groups to describe in the header, at most TELEMETRY_MAX_GROUPS.
+   *
+   * \throw std::runtime_error if the file could not be created or mapped.
+   */
+  TelemetryRecorder(const std::string& path, std::uint64_t capacity, TelemetrySource source,
+                    const std::vector<TelemetryGroup>& groups);
+
+  /**
+   * \brief Unmaps and closes the file, which keeps all records.
+   */
+  ~TelemetryRecorder();
+
+  TelemetryRecorder(const TelemetryRecorder&) = delete;
+  TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+  /**
+   * \brief Appends a record.
+   *
+   * \param kind of the record.
+   * \param group of the record.
+   * \param num_values in positions and velocities. Values beyond TELEMETRY_MAX_VALUES are dropped.
+   * \param positions to record.
+   * \param velocities to record, or nullptr to record zeros.
+   * \param source_time of the producer [s].
+   */
+  void append(TelemetryKind kind, std::uint16_t group, std::size_t num_values, const double* positions,
+              const double* velocities, double source_time = 0.0);
+
+  /**
+   * \brief Gets the number of records appended so far.
+   *
+   * \return std::uint64_t with the number of records.
+   */
+  std::uint64_t written() const { return written_; }
+
+  std::uint64_t capacity() const { return capacity_; }
+
+private:
+  int fd_ = -1;
+  void* mapping_ = nullptr;
+  std::size_t mapping_size_ = 0;
+  TelemetryHeader* header_ = nullptr;
+  TelemetryRecord* records_ = nullptr;
+  std::uint64_t capacity_ = 0;
+  std::uint64_t written_ = 0;
+};
+
+/**
+ * \brief Reads a telemetry file, also while it is being written.
+ */
+class TelemetryReader
+{
+public:
+  /**
+   * \brief Opens a telemetry file.
+   *
+   * \param path of the file.
+   *
+   * \throw std::runtime_error if the file could not be mapped, or is not a telemetry file.
+   */
+  explicit TelemetryReader(const std::string& path);
+
+  ~TelemetryReader();
+
+  TelemetryReader(const TelemetryReader&) = delete;
+  TelemetryReader& operator=(const TelemetryReader&) = delete;
+
+  const TelemetryHeader& header() const { return *header_; }
+
+  TelemetrySource source() const { return static_cast<TelemetrySource>(header_->source); }
+
+  /**
+   * \brief Gets the number of records appended so far.
+   */
+  std::uint64_t written() const { return header_->written.load(std::memory_order_acquire); }
+
+  /**
+   * \brief Gets the index of the oldest record that has not been overwritten yet.
+   */
+  std::uint64_t oldest() const;
+
+  /**
+   * \brief Reads a record.
+   *
+   * \param index of the record.
+   * \param sample to read into.
+   *
+   * \return bool true if the record was complete, false if it has not been written yet, is being written or has
+   * been overwritten.
+   */
+  bool read(std::uint64_t index, TelemetrySample& sample) const;
+
+private:
+  int fd_ = -1;
+  void* mapping_ = nullptr;
+  std::size_t mapping_size_ = 0;
+  const TelemetryHeader* header_ = nullptr;
+  const TelemetryRecord* records_ = nullptr;
+};
+}  // namespace abb_hardware_interface
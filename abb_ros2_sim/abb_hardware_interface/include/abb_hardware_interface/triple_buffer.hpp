@@ -0,0 +1,113 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace abb_hardware_interface
+{
+/**
+ * \brief Wait-free single-producer/single-consumer triple buffer.
+ *
+ * The producer fills the back buffer and publishes it, and the consumer picks up the most recently published buffer.
+ * Neither side ever blocks or allocates, and the consumer always sees a complete value (intermediate values that were
+ * published before the consumer got to them are dropped).
+ *
+ * \tparam T type of the exchanged value. Copies are only made on construction.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+  /**
+   * \brief Creates a triple buffer.
+   *
+   * \param initial value to initialize all three buffers with (e.g. to pre-size containers).
+   */
+  explicit TripleBuffer(const T& initial = T()) : buffers_{ { initial, initial, initial } }
+  {
+  }
+
+  /**
+   * \brief Gets the buffer that the producer may write to.
+   *
+   * Only to be called by the producer.
+   *
+   * \return T& with the back buffer.
+   */
+  T& back() { return buffers_[back_]; }
+
+  /**
+   * \brief Publishes the back buffer, and swaps in a new back buffer.
+   *
+   * Only to be called by the producer.
+   */
+  void publish()
+  {
+    const std::uint8_t previous = middle_.exchange(back_ | DIRTY_FLAG, std::memory_order_acq_rel);
+    back_ = previous & INDEX_MASK;
+  }
+
+  /**
+   * \brief Picks up the most recently published buffer, if there is a new one.
+   *
+   * Only to be called by the consumer.
+   *
+   * \return bool true if a new value was picked up.
+   */
+  bool update()
+  {
+    if ((middle_.load(std::memory_order_relaxed) & DIRTY_FLAG) == 0)
+    {
+      return false;
+    }
+    const std::uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = previous & INDEX_MASK;
+    return true;
+  }
+
+  /**
+   * \brief Gets the buffer that was picked up by the last successful update.
+   *
+   * Only to be called by the consumer.
+   *
+   * \return const T& with the front buffer.
+   */
+  const T& front() const { return buffers_[front_]; }
+
+private:
+  static constexpr std::uint8_t INDEX_MASK = 0x3;
+  static constexpr std::uint8_t DIRTY_FLAG = 0x4;
+
+  std::array<T, 3> buffers_;
+
+  /**
+   * \brief Index of the producer's buffer.
+   */
+  alignas(64) std::uint8_t back_ = 0;
+
+  /**
+   * \brief Index of the buffer in transit, and a flag that tells whether it has been published since the last update.
+   */
+  alignas(64) std::atomic<std::uint8_t> middle_{ 1 };
+
+  /**
+   * \brief Index of the consumer's buffer.
+   */
+  alignas(64) std::uint8_t front_ = 2;
+};
+}  // namespace abb_hardware_interface
@@ -41,10 +41,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include <abb_egm_rws_managers/rws_manager.h>
-#include <string>
 
 namespace abb
 {
@@ -68,6 +68,22 @@ namespace utilities
 RobotControllerDescription establishRWSConnection(RWSManager& rws_manager, const std::string& robot_controller_id,
                                                   const bool no_connection_timeout);
 
+/**
+ * \brief Attempts to establish a connection to a robot controller's RWS server, until a deadline.
+ *
+ * If a connection is established, then a structured description of the robot controller is returned.
+ *
+ * \param rws_manager for handling the RWS communication with the robot controller.
+ * \param robot_controller_id for an identifier/nickname for the targeted robot controller.
+ * \param deadline after which no further attempts are made.
+ *
+ * \return RobotControllerDescription of the robot controller.
+ *
+ * \throw std::runtime_error if unable to establish a connection before the deadline.
+ */
+RobotControllerDescription establishRWSConnection(RWSManager& rws_manager, const std::string& robot_controller_id,
+                                                  const std::chrono::steady_clock::time_point deadline);
+
 /**
  * \brief Verifies that the RobotWare version is supported.
  *
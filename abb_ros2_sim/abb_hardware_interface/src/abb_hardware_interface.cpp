@@ -16,12 +16,22 @@
 #include <abb_hardware_interface/abb_hardware_interface.hpp>
 #include <abb_hardware_interface/utilities.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
 using namespace std::chrono_literals;
 
 namespace abb_hardware_interface
 {
-static constexpr size_t NUM_CONNECTION_TRIES = 100;
+static constexpr std::chrono::nanoseconds DEFAULT_STARTUP_TIMEOUT = 100s;
 static const rclcpp::Logger LOGGER = rclcpp::get_logger("ABBSystemHardware");
+static const std::string EGM_COMPONENT_NAME = "egm";
+static const std::string EGM_PACKET_AGE_INTERFACE = "packet_age";
+static constexpr std::uint64_t DEFAULT_TELEMETRY_CAPACITY = 262144;
+// Records mapped (and locked in memory) at most, about 3.7 GB
+static constexpr std::uint64_t MAX_TELEMETRY_CAPACITY = std::uint64_t{ 1 } << 24;
+static constexpr int MAX_EGM_ROBOT_JOINTS = 6;
 
 CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo& info)
 {
@@ -30,6 +40,28 @@ CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo
     return CallbackReturn::ERROR;
   }
 
+  // All of the bring-up (RWS and every EGM channel) shares one deadline.
+  const auto timeout_it = info_.hardware_parameters.find("startup_timeout");
+  startup_timeout_ = DEFAULT_STARTUP_TIMEOUT;
+  if (timeout_it != info_.hardware_parameters.end())
+  {
+    double timeout = 0.0;
+    try
+    {
+      timeout = std::stod(timeout_it->second);
+    }
+    catch (const std::logic_error&)
+    {
+    }
+    if (timeout <= 0.0)
+    {
+      RCLCPP_FATAL(LOGGER, "Invalid startup_timeout \"%s\" in hardware parameters", timeout_it->second.c_str());
+      return CallbackReturn::ERROR;
+    }
+    startup_timeout_ = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(timeout));
+  }
+  const auto startup_deadline = std::chrono::steady_clock::now() + startup_timeout_;
+
   // Validate interfaces configured in ros2_control xacro.
   for (const hardware_interface::ComponentInfo& joint : info_.joints)
   {
@@ -96,9 +128,30 @@ CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo
       return CallbackReturn::ERROR;
     }
 
-    // Get robot controller description from RWS
-    abb::robot::RWSManager rws_manager(rws_ip, rws_port, "Default User", "robotics");
-    robot_controller_description_ = abb::robot::utilities::establishRWSConnection(rws_manager, "IRB1200", true);
+    // Get robot controller description from RWS, or from the cache if one is configured
+    rws_manager_ = std::make_unique<abb::robot::RWSManager>(rws_ip, rws_port, "Default User", "robotics");
+    const auto establish_connection = [this, &startup_deadline]() {
+      return abb::robot::utilities::establishRWSConnection(*rws_manager_, "IRB1200", startup_deadline);
+    };
+    try
+    {
+      const auto cache_it = info_.hardware_parameters.find("description_cache_dir");
+      if (cache_it != info_.hardware_parameters.end() && !cache_it->second.empty())
+      {
+        description_cache_ = std::make_unique<abb::robot::utilities::DescriptionCache>(cache_it->second, rws_ip,
+                                                                                      rws_port, "IRB1200");
+        robot_controller_description_ = description_cache_->get(*rws_manager_, establish_connection);
+      }
+      else
+      {
+        robot_controller_description_ = establish_connection();
+      }
+    }
+    catch (const std::runtime_error& e)
+    {
+      RCLCPP_FATAL_STREAM(LOGGER, "Failed to get robot controller description from RWS: " << e.what());
+      return CallbackReturn::ERROR;
+    }
   }
   else
   {
@@ -163,29 +216,29 @@ CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo
   // Configure EGM
   RCLCPP_INFO(LOGGER, "Configuring EGM interface...");
 
-  // Initialize motion data from robot controller description
-  try
-  {
-    abb::robot::initializeMotionData(motion_data_, robot_controller_description_);
-  }
-  catch (...)
+  // Optionally service all EGM channels from a single reactor, instead of one EGM manager each.
+  const auto reactor_it = info_.hardware_parameters.find("egm_reactor");
+  if (reactor_it != info_.hardware_parameters.end() && (reactor_it->second == "true" || reactor_it->second == "True"))
   {
-    RCLCPP_ERROR_STREAM(LOGGER, "Failed to initialize motion data from robot controller description");
-    return CallbackReturn::ERROR;
+    try
+    {
+      egm_channels_.useReactor();
+    }
+    catch (const std::runtime_error& e)
+    {
+      RCLCPP_ERROR_STREAM(LOGGER, "Failed to set up the EGM reactor: " << e.what());
+      return CallbackReturn::ERROR;
+    }
+    RCLCPP_INFO(LOGGER, "Servicing all EGM channels from a single reactor");
   }
 
-  // Create channel configuration for each mechanical unit group
-  std::vector<abb::robot::EGMManager::ChannelConfiguration> channel_configurations;
+  // Create an EGM channel for each mechanical unit group
   for (const auto& group : robot_controller_description_.mechanical_units_groups())
   {
+    std::uint16_t egm_port = 0;
     try
     {
-      const auto egm_port = stoi(info_.hardware_parameters[group.name() + "egm_port"]);
-      const auto channel_configuration =
-          abb::robot::EGMManager::ChannelConfiguration{ static_cast<uint16_t>(egm_port), group };
-      channel_configurations.emplace_back(channel_configuration);
-      RCLCPP_INFO_STREAM(LOGGER,
-                         "Configuring EGM for mechanical unit group " << group.name() << " on port " << egm_port);
+      egm_port = static_cast<std::uint16_t>(stoi(info_.hardware_parameters[group.name() + "egm_port"]));
     }
     catch (std::invalid_argument& e)
     {
@@ -193,15 +246,166 @@ CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo
                                                                           << "\" not specified in hardware parameters");
       return CallbackReturn::ERROR;
     }
+
+    try
+    {
+      egm_channels_.addChannel(robot_controller_description_, group, egm_port);
+      RCLCPP_INFO_STREAM(LOGGER,
+                         "Configuring EGM for mechanical unit group " << group.name() << " on port " << egm_port);
+    }
+    catch (std::runtime_error& e)
+    {
+      RCLCPP_ERROR_STREAM(LOGGER, "Failed to initialize EGM connection: " << e.what());
+      return CallbackReturn::ERROR;
+    }
   }
-  try
+
+  // Bind the flat joint buffers to the motion data. The motion data is never resized after this point.
+  joint_buffers_.initialize(egm_channels_.motionData());
+
+  // Start waiting for the robot on every channel already, and only collect the results in on_activate.
+  egm_channels_.startConnecting(startup_deadline);
+
+  // Configure the timing instrumentation, and optionally publish it off the real-time thread.
+  const auto cycle_it = info_.hardware_parameters.find("nominal_cycle_time");
+  if (cycle_it != info_.hardware_parameters.end())
   {
-    egm_manager_ = std::make_unique<abb::robot::EGMManager>(channel_configurations);
+    try
+    {
+      cycle_statistics_.setNominalCycle(static_cast<std::int64_t>(std::stod(cycle_it->second) * 1e9));
+    }
+    catch (const std::logic_error&)
+    {
+      RCLCPP_FATAL(LOGGER, "Invalid nominal_cycle_time \"%s\" in hardware parameters", cycle_it->second.c_str());
+      return CallbackReturn::ERROR;
+    }
   }
-  catch (std::runtime_error& e)
+  const auto diagnostics_it = info_.hardware_parameters.find("publish_diagnostics");
+  if (diagnostics_it != info_.hardware_parameters.end() &&
+      (diagnostics_it->second == "true" || diagnostics_it->second == "True"))
   {
-    RCLCPP_ERROR_STREAM(LOGGER, "Failed to initialize EGM connection");
-    return CallbackReturn::ERROR;
+    const auto period_it = info_.hardware_parameters.find("diagnostics_period");
+    double period = 1.0;
+    try
+    {
+      period = period_it == info_.hardware_parameters.end() ? 1.0 : std::stod(period_it->second);
+    }
+    catch (const std::logic_error&)
+    {
+      period = 0.0;
+    }
+    if (period <= 0.0)
+    {
+      RCLCPP_FATAL(LOGGER, "Invalid diagnostics_period \"%s\" in hardware parameters", period_it->second.c_str());
+      return CallbackReturn::ERROR;
+    }
+    diagnostics_publisher_ = std::make_unique<DiagnosticsPublisher>(info_.name, cycle_statistics_, period);
+    RCLCPP_INFO(LOGGER, "Publishing cycle statistics on /diagnostics every %.2f s", period);
+  }
+
+  // Optionally record every state and command, e.g. for post-mortems or for replaying into abb_simulator.
+  const auto telemetry_it = info_.hardware_parameters.find("telemetry_file");
+  if (telemetry_it != info_.hardware_parameters.end() && !telemetry_it->second.empty())
+  {
+    const auto capacity_it = info_.hardware_parameters.find("telemetry_capacity");
+    std::uint64_t capacity = DEFAULT_TELEMETRY_CAPACITY;
+    if (capacity_it != info_.hardware_parameters.end())
+    {
+      // Parsed as signed, since std::stoull silently wraps negative values around
+      long long value = 0;
+      try
+      {
+        value = std::stoll(capacity_it->second);
+      }
+      catch (const std::logic_error&)
+      {
+      }
+      if (value <= 0 || static_cast<std::uint64_t>(value) > MAX_TELEMETRY_CAPACITY)
+      {
+        RCLCPP_FATAL(LOGGER, "Invalid telemetry_capacity \"%s\" in hardware parameters (1 to %lu records)",
+                     capacity_it->second.c_str(), static_cast<unsigned long>(MAX_TELEMETRY_CAPACITY));
+        return CallbackReturn::ERROR;
+      }
+      capacity = static_cast<std::uint64_t>(value);
+    }
+
+    // The joints of each group, in the order of the joint buffers: the robot first, then the external units
+    std::vector<TelemetryGroup> groups;
+    const auto& descriptions = robot_controller_description_.mechanical_units_groups();
+    for (int g = 0; g < descriptions.size() && static_cast<std::size_t>(g) < TELEMETRY_MAX_GROUPS; ++g)
+    {
+      TelemetryGroup group{};
+      std::strncpy(group.name, descriptions[g].name().c_str(), sizeof(group.name) - 1);
+      const auto add_joint = [&group](const abb::robot::StandardizedJoint& joint) {
+        if (!joint.rotating_move() && group.num_joints < 32)
+        {
+          group.linear_mask |= 1u << group.num_joints;
+        }
+        ++group.num_joints;
+      };
+      for (const auto& joint : descriptions[g].robot().standardized_joints())
+      {
+        add_joint(joint);
+      }
+      group.num_robot_joints = std::min<std::uint32_t>(group.num_joints, MAX_EGM_ROBOT_JOINTS);
+      for (const auto& unit : descriptions[g].mechanical_units())
+      {
+        for (const auto& joint : unit.standardized_joints())
+        {
+          add_joint(joint);
+        }
+      }
+      groups.push_back(group);
+    }
+
+    try
+    {
+      telemetry_recorder_ = std::make_unique<TelemetryRecorder>(telemetry_it->second, capacity,
+                                                                TelemetrySource::HARDWARE_INTERFACE, groups);
+    }
+    catch (const std::runtime_error& e)
+    {
+      RCLCPP_ERROR_STREAM(LOGGER, "Failed to set up the telemetry recorder: " << e.what());
+      return CallbackReturn::ERROR;
+    }
+    RCLCPP_INFO(LOGGER, "Recording telemetry to '%s' (%lu records)", telemetry_it->second.c_str(),
+                static_cast<unsigned long>(capacity));
+  }
+
+  // Optionally share the joint states with other processes on the host, which need not poll them via RWS then.
+  const auto state_bridge_it = info_.hardware_parameters.find("state_bridge");
+  if (state_bridge_it != info_.hardware_parameters.end() && !state_bridge_it->second.empty())
+  {
+    try
+    {
+      state_bridge_ = std::make_unique<StateBridgeWriter>(state_bridge_it->second, joint_buffers_.groups());
+    }
+    catch (const std::runtime_error& e)
+    {
+      RCLCPP_ERROR_STREAM(LOGGER, "Failed to set up the state bridge: " << e.what());
+      return CallbackReturn::ERROR;
+    }
+    RCLCPP_INFO(LOGGER, "Sharing the joint states via the state bridge '%s'", state_bridge_it->second.c_str());
+  }
+
+  // Optionally exchange data with EGM in a dedicated thread, instead of in read() and write().
+  const auto io_thread_it = info_.hardware_parameters.find("egm_io_thread");
+  const bool use_io_thread = io_thread_it != info_.hardware_parameters.end() &&
+                             (io_thread_it->second == "true" || io_thread_it->second == "True");
+  if (use_io_thread)
+  {
+    const auto cpu_it = info_.hardware_parameters.find("egm_io_thread_cpu");
+    try
+    {
+      egm_io_thread_cpu_ = cpu_it == info_.hardware_parameters.end() ? -1 : std::stoi(cpu_it->second);
+    }
+    catch (const std::logic_error&)
+    {
+      RCLCPP_FATAL(LOGGER, "Invalid egm_io_thread_cpu \"%s\" in hardware parameters", cpu_it->second.c_str());
+      return CallbackReturn::ERROR;
+    }
+    egm_io_thread_ = std::make_unique<EGMIOThread>(egm_channels_, joint_buffers_, cycle_statistics_);
+    RCLCPP_INFO(LOGGER, "Using a dedicated EGM I/O thread (CPU core: %d)", egm_io_thread_cpu_);
   }
 
   return CallbackReturn::SUCCESS;
@@ -210,44 +414,38 @@ CallbackReturn ABBSystemHardware::on_init(const hardware_interface::HardwareInfo
 std::vector<hardware_interface::StateInterface> ABBSystemHardware::export_state_interfaces()
 {
   std::vector<hardware_interface::StateInterface> state_interfaces;
-  for (auto& group : motion_data_.groups)
+  state_interfaces.reserve(2 * joint_buffers_.size());
+  for (auto& group : joint_buffers_.groups())
   {
-    for (auto& unit : group.units)
+    for (std::size_t i = 0; i < group.joint_names.size(); ++i)
     {
-      for (auto& joint : unit.joints)
-      {
-        // TODO(seng): Consider changing joint names in robot description to match what comes
-        // from the ABB robot description to avoid needing to strip the prefix here
-        const auto pos = joint.name.find("joint");
-        const auto joint_name = joint.name.substr(pos);
-        state_interfaces.emplace_back(
-            hardware_interface::StateInterface(joint_name, hardware_interface::HW_IF_POSITION, &joint.state.position));
-        state_interfaces.emplace_back(
-            hardware_interface::StateInterface(joint_name, hardware_interface::HW_IF_VELOCITY, &joint.state.velocity));
-      }
+      state_interfaces.emplace_back(hardware_interface::StateInterface(
+          group.joint_names[i], hardware_interface::HW_IF_POSITION, &group.positions[i]));
+      state_interfaces.emplace_back(hardware_interface::StateInterface(
+          group.joint_names[i], hardware_interface::HW_IF_VELOCITY, &group.velocities[i]));
     }
   }
+
+  if (egm_io_thread_)
+  {
+    state_interfaces.emplace_back(
+        hardware_interface::StateInterface(EGM_COMPONENT_NAME, EGM_PACKET_AGE_INTERFACE, &egm_packet_age_));
+  }
   return state_interfaces;
 }
 
 std::vector<hardware_interface::CommandInterface> ABBSystemHardware::export_command_interfaces()
 {
   std::vector<hardware_interface::CommandInterface> command_interfaces;
-  for (auto& group : motion_data_.groups)
+  command_interfaces.reserve(2 * joint_buffers_.size());
+  for (auto& group : joint_buffers_.groups())
   {
-    for (auto& unit : group.units)
+    for (std::size_t i = 0; i < group.joint_names.size(); ++i)
     {
-      for (auto& joint : unit.joints)
-      {
-        // TODO(seng): Consider changing joint names in robot description to match what comes
-        // from the ABB robot description to avoid needing to strip the prefix here
-        const auto pos = joint.name.find("joint");
-        const auto joint_name = joint.name.substr(pos);
-        command_interfaces.emplace_back(hardware_interface::CommandInterface(
-            joint_name, hardware_interface::HW_IF_POSITION, &joint.command.position));
-        command_interfaces.emplace_back(hardware_interface::CommandInterface(
-            joint_name, hardware_interface::HW_IF_VELOCITY, &joint.command.velocity));
-      }
+      command_interfaces.emplace_back(hardware_interface::CommandInterface(
+          group.joint_names[i], hardware_interface::HW_IF_POSITION, &group.position_commands[i]));
+      command_interfaces.emplace_back(hardware_interface::CommandInterface(
+          group.joint_names[i], hardware_interface::HW_IF_VELOCITY, &group.velocity_commands[i]));
     }
   }
 
@@ -256,37 +454,39 @@ std::vector<hardware_interface::CommandInterface> ABBSystemHardware::export_comm
 
 CallbackReturn ABBSystemHardware::on_activate(const rclcpp_lifecycle::State& /* previous_state */)
 {
-  size_t counter = 0;
   RCLCPP_INFO(LOGGER, "Connecting to robot...");
-  while (rclcpp::ok() && ++counter < NUM_CONNECTION_TRIES)
+
+  // The connection attempts were started in on_init, unless this is a reactivation.
+  if (!egm_channels_.isConnecting())
   {
-    // Wait for a message on any of the configured EGM channels.
-    if (egm_manager_->waitForMessage(500))
-    {
-      RCLCPP_INFO(LOGGER, "Connected to robot");
-      break;
-    }
+    egm_channels_.startConnecting(std::chrono::steady_clock::now() + startup_timeout_);
+  }
 
-    RCLCPP_INFO(LOGGER, "Not connected to robot...");
-    if (counter == NUM_CONNECTION_TRIES)
-    {
-      RCLCPP_ERROR(LOGGER, "Failed to connect to robot");
-      return CallbackReturn::ERROR;
-    }
-    rclcpp::sleep_for(500ms);
+  // As before the groups were connected separately, receiving messages for any group is enough, since e.g. the
+  // EGM sessions of some groups may only be started later on.
+  const std::vector<std::string> failed_groups = egm_channels_.finishConnecting();
+  for (const auto& group : failed_groups)
+  {
+    RCLCPP_WARN(LOGGER, "No EGM messages received for mechanical unit group \"%s\"", group.c_str());
   }
+  if (failed_groups.size() == egm_channels_.size())
+  {
+    RCLCPP_ERROR(LOGGER, "Failed to connect to robot");
+    return CallbackReturn::ERROR;
+  }
+  RCLCPP_INFO(LOGGER, "Connected to robot");
+
+  egm_channels_.read();
+  joint_buffers_.updateStates();
+  joint_buffers_.holdPositions();
+  joint_buffers_.updateCommands();
 
-  egm_manager_->read(motion_data_);
-  for (auto& group : motion_data_.groups)
+  // A thread that could not be pinned would share its core with others, and miss EGM deadlines under load.
+  if (egm_io_thread_ && !egm_io_thread_->start(egm_io_thread_cpu_))
   {
-    for (auto& unit : group.units)
-    {
-      for (auto& joint : unit.joints)
-      {
-        joint.command.position = joint.state.position;
-        joint.command.velocity = 0.0;
-      }
-    }
+    egm_io_thread_->stop();
+    RCLCPP_ERROR(LOGGER, "Failed to start the EGM I/O thread");
+    return CallbackReturn::ERROR;
   }
 
   RCLCPP_INFO(LOGGER, "ros2_control hardware interface was successfully started!");
@@ -294,18 +494,85 @@ CallbackReturn ABBSystemHardware::on_activate(const rclcpp_lifecycle::State& /*
   return CallbackReturn::SUCCESS;
 }
 
+CallbackReturn ABBSystemHardware::on_deactivate(const rclcpp_lifecycle::State& /* previous_state */)
+{
+  if (egm_io_thread_)
+  {
+    egm_io_thread_->stop();
+  }
+
+  return CallbackReturn::SUCCESS;
+}
+
 return_type ABBSystemHardware::read(const rclcpp::Time& time, const rclcpp::Duration& period)
 {
-  egm_manager_->read(motion_data_);
+  const std::int64_t start_ns = CycleStatistics::now();
+  cycle_statistics_.recordReadStart(start_ns);
+
+  if (egm_io_thread_)
+  {
+    egm_io_thread_->readStates();
+    egm_packet_age_ = egm_io_thread_->packetAge();
+  }
+  else
+  {
+    egm_channels_.read();
+    joint_buffers_.updateStates();
+  }
+  if (telemetry_recorder_)
+  {
+    recordTelemetry(TelemetryKind::FEEDBACK);
+  }
+  if (state_bridge_)
+  {
+    state_bridge_->publish(joint_buffers_.groups(), start_ns);
+  }
+
+  cycle_statistics_.recordReadDuration(CycleStatistics::now() - start_ns);
   return return_type::OK;
 }
 
 return_type ABBSystemHardware::write(const rclcpp::Time& time, const rclcpp::Duration& period)
 {
-  egm_manager_->write(motion_data_);
+  const std::int64_t start_ns = CycleStatistics::now();
+
+  if (telemetry_recorder_)
+  {
+    recordTelemetry(TelemetryKind::COMMAND);
+  }
+  if (egm_io_thread_)
+  {
+    egm_io_thread_->writeCommands();
+  }
+  else
+  {
+    joint_buffers_.updateCommands();
+    egm_channels_.write();
+  }
+
+  cycle_statistics_.recordWriteDuration(CycleStatistics::now() - start_ns);
   return return_type::OK;
 }
 
+void ABBSystemHardware::recordTelemetry(const TelemetryKind kind)
+{
+  const auto& groups = joint_buffers_.groups();
+  for (std::size_t g = 0; g < groups.size(); ++g)
+  {
+    const GroupJointBuffers& group = groups[g];
+    if (kind == TelemetryKind::FEEDBACK)
+    {
+      telemetry_recorder_->append(kind, static_cast<std::uint16_t>(g), group.positions.size(), group.positions.data(),
+                                  group.velocities.data());
+    }
+    else
+    {
+      telemetry_recorder_->append(kind, static_cast<std::uint16_t>(g), group.position_commands.size(),
+                                  group.position_commands.data(), group.velocity_commands.data());
+    }
+  }
+}
+
 }  // namespace abb_hardware_interface
 
 #include "pluginlib/class_list_macros.hpp"
@@ -0,0 +1,79 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/cycle_statistics.hpp>
+
+#include <chrono>
+
+namespace abb_hardware_interface
+{
+constexpr std::int64_t CycleStatistics::DEFAULT_NOMINAL_CYCLE_NS;
+
+CycleStatistics::CycleStatistics(const std::int64_t nominal_cycle_ns) : nominal_cycle_ns_(nominal_cycle_ns)
+{
+}
+
+std::int64_t CycleStatistics::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void CycleStatistics::setNominalCycle(const std::int64_t nominal_cycle_ns)
+{
+  nominal_cycle_ns_ = nominal_cycle_ns;
+}
+
+void CycleStatistics::recordReadStart(const std::int64_t start_ns)
+{
+  if (last_read_start_ns_ != 0)
+  {
+    const std::int64_t period_ns = start_ns - last_read_start_ns_;
+    cycle_period_.record(period_ns);
+    missed_cycles_.fetch_add(missedPeriods(period_ns), std::memory_order_relaxed);
+  }
+  last_read_start_ns_ = start_ns;
+}
+
+void CycleStatistics::recordReadDuration(const std::int64_t duration_ns)
+{
+  read_duration_.record(duration_ns);
+}
+
+void CycleStatistics::recordWriteDuration(const std::int64_t duration_ns)
+{
+  write_duration_.record(duration_ns);
+}
+
+void CycleStatistics::recordEGMMessage(const std::int64_t stamp_ns)
+{
+  if (last_egm_message_ns_ != 0)
+  {
+    const std::int64_t interval_ns = stamp_ns - last_egm_message_ns_;
+    egm_inter_arrival_.record(interval_ns);
+    missed_egm_messages_.fetch_add(missedPeriods(interval_ns), std::memory_order_relaxed);
+  }
+  last_egm_message_ns_ = stamp_ns;
+}
+
+std::uint64_t CycleStatistics::missedPeriods(const std::int64_t interval_ns) const
+{
+  if (nominal_cycle_ns_ <= 0 || 2 * interval_ns <= 3 * nominal_cycle_ns_)
+  {
+    return 0;
+  }
+  // Round to the nearest number of periods, minus the one that was expected.
+  return static_cast<std::uint64_t>((interval_ns + nominal_cycle_ns_ / 2) / nominal_cycle_ns_ - 1);
+}
+}  // namespace abb_hardware_interface
@@ -0,0 +1,161 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/description_cache.hpp>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include <rclcpp/rclcpp.hpp>
+
+namespace abb
+{
+namespace robot
+{
+namespace utilities
+{
+namespace
+{
+auto LOGGER = rclcpp::get_logger("ABBDescriptionCache");
+
+/**
+ * \brief Replaces all characters that are not safe in a file name.
+ */
+std::string sanitize(std::string name)
+{
+  for (auto& c : name)
+  {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-')
+    {
+      c = '_';
+    }
+  }
+  return name;
+}
+}  // namespace
+
+DescriptionCache::DescriptionCache(const std::string& directory, const std::string& robot_ip,
+                                   const unsigned short robot_port, const std::string& robot_controller_id)
+  : directory_(directory)
+  , path_(directory + "/rws_" + sanitize(robot_ip) + "_" + std::to_string(robot_port) + "_" +
+          sanitize(robot_controller_id) + ".pb")
+  , robot_controller_id_(robot_controller_id)
+{
+}
+
+DescriptionCache::~DescriptionCache()
+{
+  if (revalidation_.valid())
+  {
+    revalidation_.wait();
+  }
+}
+
+RobotControllerDescription DescriptionCache::get(
+    RWSManager& rws_manager, const std::function<RobotControllerDescription()>& establish_connection)
+{
+  RobotControllerDescription description;
+  if (load(description))
+  {
+    RCLCPP_INFO_STREAM(LOGGER, "Using cached robot controller description from '" << path_
+                                                                                   << "' (revalidating in background)");
+    revalidation_ =
+        std::async(std::launch::async, [this, &rws_manager, description]() { revalidate(rws_manager, description); });
+    return description;
+  }
+
+  description = establish_connection();
+  store(description);
+  return description;
+}
+
+bool DescriptionCache::load(RobotControllerDescription& description) const
+{
+  std::ifstream file{ path_, std::ios::binary };
+  if (!file)
+  {
+    return false;
+  }
+  if (!description.ParseFromIstream(&file))
+  {
+    RCLCPP_WARN_STREAM(LOGGER, "Ignoring unreadable robot controller description cache '" << path_ << "'");
+    description.Clear();
+    return false;
+  }
+  return true;
+}
+
+bool DescriptionCache::store(const RobotControllerDescription& description) const
+{
+  if (::mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST)
+  {
+    RCLCPP_WARN_STREAM(LOGGER, "Failed to create robot controller description cache directory '" << directory_ << "'");
+    return false;
+  }
+
+  // Write to a temporary file first, so that concurrent readers never see a partial description.
+  const std::string temporary_path = path_ + ".tmp." + std::to_string(::getpid());
+  {
+    std::ofstream file{ temporary_path, std::ios::binary | std::ios::trunc };
+    if (!file || !description.SerializeToOstream(&file))
+    {
+      RCLCPP_WARN_STREAM(LOGGER, "Failed to write robot controller description cache '" << temporary_path << "'");
+      std::remove(temporary_path.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temporary_path.c_str(), path_.c_str()) != 0)
+  {
+    RCLCPP_WARN_STREAM(LOGGER, "Failed to replace robot controller description cache '" << path_ << "'");
+    std::remove(temporary_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+void DescriptionCache::revalidate(RWSManager& rws_manager, const RobotControllerDescription& cached) const
+{
+  RobotControllerDescription current;
+  try
+  {
+    current = rws_manager.collectAndParseSystemData(robot_controller_id_);
+  }
+  catch (const std::runtime_error& exception)
+  {
+    RCLCPP_WARN_STREAM(LOGGER, "Failed to revalidate cached robot controller description, reason: '"
+                                   << exception.what() << "'");
+    return;
+  }
+
+  if (current.SerializeAsString() == cached.SerializeAsString())
+  {
+    RCLCPP_DEBUG(LOGGER, "Cached robot controller description is up to date");
+    return;
+  }
+
+  RCLCPP_WARN_STREAM(LOGGER, "Cached robot controller description was outdated (RobotWare "
+                                 << cached.header().robot_ware_version().name() << " -> "
+                                 << current.header().robot_ware_version().name()
+                                 << "); the updated description will be used from the next start");
+  store(current);
+}
+}  // namespace utilities
+}  // namespace robot
+}  // namespace abb
@@ -0,0 +1,129 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/diagnostics_publisher.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+#include <diagnostic_msgs/msg/key_value.hpp>
+
+namespace abb_hardware_interface
+{
+namespace
+{
+diagnostic_msgs::msg::KeyValue makeKeyValue(const std::string& key, const std::string& value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+
+/**
+ * \brief Adds the summary of a histogram, in microseconds, to a diagnostic status.
+ */
+void addSummary(diagnostic_msgs::msg::DiagnosticStatus& status, const std::string& label,
+                const LatencyHistogram& histogram)
+{
+  const LatencyHistogram::Summary summary = histogram.summarize();
+  const auto to_us = [](const double value_ns) { return std::to_string(value_ns * 1e-3); };
+
+  status.values.push_back(makeKeyValue(label + " count", std::to_string(summary.count)));
+  status.values.push_back(makeKeyValue(label + " mean [us]", to_us(summary.mean)));
+  status.values.push_back(makeKeyValue(label + " min [us]", to_us(summary.min)));
+  status.values.push_back(makeKeyValue(label + " p50 [us]", to_us(summary.p50)));
+  status.values.push_back(makeKeyValue(label + " p90 [us]", to_us(summary.p90)));
+  status.values.push_back(makeKeyValue(label + " p99 [us]", to_us(summary.p99)));
+  status.values.push_back(makeKeyValue(label + " p999 [us]", to_us(summary.p999)));
+  status.values.push_back(makeKeyValue(label + " max [us]", to_us(summary.max)));
+}
+
+/**
+ * \brief Makes the name of the diagnostics node of a hardware component, so that every component has a node of its own.
+ *
+ * Node names may only contain alphanumerics and underscores, and may not start with a digit.
+ */
+std::string makeNodeName(const std::string& hardware_name)
+{
+  std::string name = hardware_name;
+  std::replace_if(name.begin(), name.end(), [](const char c) { return !std::isalnum(static_cast<unsigned char>(c)); },
+                  '_');
+  if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front())))
+  {
+    name.insert(name.begin(), '_');
+  }
+  return name + "_diagnostics";
+}
+}  // namespace
+
+DiagnosticsPublisher::DiagnosticsPublisher(const std::string& hardware_name, const CycleStatistics& statistics,
+                                           const double period)
+  : hardware_name_(hardware_name), statistics_(statistics)
+{
+  node_ = std::make_shared<rclcpp::Node>(makeNodeName(hardware_name));
+  publisher_ = node_->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 1);
+  timer_ = node_->create_wall_timer(std::chrono::duration<double>(period), [this]() { timerCallback(); });
+
+  executor_ = std::make_shared<rclcpp::executors::SingleThreadedExecutor>();
+  executor_->add_node(node_);
+  thread_ = std::thread([this]() { executor_->spin(); });
+}
+
+DiagnosticsPublisher::~DiagnosticsPublisher()
+{
+  executor_->cancel();
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+}
+
+void DiagnosticsPublisher::timerCallback()
+{
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.name = hardware_name_ + ": Control cycle";
+  status.hardware_id = hardware_name_;
+
+  const std::uint64_t missed_cycles = statistics_.missedCycles();
+  const std::uint64_t missed_egm_messages = statistics_.missedEGMMessages();
+  if (missed_cycles != last_missed_cycles_ || missed_egm_messages != last_missed_egm_messages_)
+  {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+    status.message = "Missed cycles since last report";
+  }
+  else
+  {
+    status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+    status.message = "OK";
+  }
+  last_missed_cycles_ = missed_cycles;
+  last_missed_egm_messages_ = missed_egm_messages;
+
+  status.values.push_back(makeKeyValue("nominal cycle [us]", std::to_string(statistics_.nominalCycle() / 1000)));
+  status.values.push_back(makeKeyValue("missed cycles", std::to_string(missed_cycles)));
+  status.values.push_back(makeKeyValue("missed EGM messages", std::to_string(missed_egm_messages)));
+  addSummary(status, "read duration", statistics_.readDuration());
+  addSummary(status, "write duration", statistics_.writeDuration());
+  addSummary(status, "cycle period", statistics_.cyclePeriod());
+  addSummary(status, "EGM inter-arrival", statistics_.egmInterArrival());
+
+  diagnostic_msgs::msg::DiagnosticArray array;
+  array.header.stamp = node_->now();
+  array.status.push_back(status);
+  publisher_->publish(array);
+}
+}  // namespace abb_hardware_interface
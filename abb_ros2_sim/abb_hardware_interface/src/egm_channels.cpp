@@ -0,0 +1,266 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/egm_channels.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <rclcpp/rclcpp.hpp>
+
+namespace abb_hardware_interface
+{
+constexpr unsigned int EGMChannels::CONNECTION_POLL_MS;
+constexpr unsigned int EGMChannels::WAIT_SLICE_MS;
+
+EGMChannels::~EGMChannels()
+{
+  stop_connecting_ = true;
+  for (auto& channel : channels_)
+  {
+    if (channel->connection.valid())
+    {
+      channel->connection.wait();
+    }
+  }
+  if (reactor_connection_.valid())
+  {
+    reactor_connection_.wait();
+  }
+}
+
+void EGMChannels::useReactor()
+{
+  if (!channels_.empty())
+  {
+    throw std::runtime_error{ "The EGM reactor must be set up before the channels are added" };
+  }
+  reactor_ = std::make_unique<EGMReactor>();
+}
+
+void EGMChannels::addChannel(const abb::robot::RobotControllerDescription& description,
+                             const abb::robot::MechanicalUnitGroup& group, const std::uint16_t port)
+{
+  auto channel = std::make_unique<Channel>();
+  channel->name = group.name();
+
+  // Describe the group on its own, so that the channel's motion data only contains the group.
+  abb::robot::RobotControllerDescription group_description{ description };
+  group_description.clear_mechanical_units_groups();
+  group_description.add_mechanical_units_groups()->CopyFrom(group);
+
+  try
+  {
+    abb::robot::initializeMotionData(channel->motion_data, group_description);
+  }
+  catch (...)
+  {
+    throw std::runtime_error{ "Failed to initialize motion data for mechanical unit group \"" + group.name() + "\"" };
+  }
+
+  if (reactor_)
+  {
+    reactor_->addGroup(group, channel->motion_data, port);
+    channels_.push_back(std::move(channel));
+    return;
+  }
+
+  const std::vector<abb::robot::EGMManager::ChannelConfiguration> channel_configurations{
+    abb::robot::EGMManager::ChannelConfiguration{ port, group }
+  };
+  channel->egm_manager = std::make_unique<abb::robot::EGMManager>(channel_configurations);
+  channels_.push_back(std::move(channel));
+}
+
+void EGMChannels::startConnecting(const std::chrono::steady_clock::time_point deadline)
+{
+  stop_connecting_ = false;
+  if (reactor_)
+  {
+    // A single attempt polls all channels, until any of them has received a message. A reactivation starts over,
+    // instead of taking the groups as connected (and commanded) from before the deactivation.
+    reactor_->reset();
+    EGMReactor* reactor = reactor_.get();
+    reactor_connection_ = std::async(std::launch::async, [this, reactor, deadline]() {
+      while (rclcpp::ok() && !stop_connecting_)
+      {
+        bool connected = false;
+        for (std::size_t i = 0; i < reactor->size(); ++i)
+        {
+          connected = connected || reactor->connected(i);
+        }
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (connected || remaining.count() <= 0)
+        {
+          return connected;
+        }
+        reactor->poll(static_cast<unsigned int>(std::min<std::chrono::milliseconds::rep>(remaining.count(),
+                                                                                          CONNECTION_POLL_MS)));
+      }
+      return false;
+    });
+    return;
+  }
+
+  for (auto& channel : channels_)
+  {
+    abb::robot::EGMManager* egm_manager = channel->egm_manager.get();
+    channel->connection = std::async(std::launch::async, [this, egm_manager, deadline]() {
+      while (rclcpp::ok() && !stop_connecting_)
+      {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+          return false;
+        }
+        const auto timeout_ms = std::min<std::chrono::milliseconds::rep>(remaining.count(), CONNECTION_POLL_MS);
+        if (egm_manager->waitForMessage(static_cast<unsigned int>(timeout_ms)))
+        {
+          return true;
+        }
+      }
+      return false;
+    });
+  }
+}
+
+bool EGMChannels::isConnecting() const
+{
+  if (reactor_)
+  {
+    return reactor_connection_.valid();
+  }
+  return std::any_of(channels_.begin(), channels_.end(),
+                     [](const std::unique_ptr<Channel>& channel) { return channel->connection.valid(); });
+}
+
+std::vector<std::string> EGMChannels::finishConnecting()
+{
+  std::vector<std::string> failed_groups;
+  if (reactor_)
+  {
+    if (reactor_connection_.valid())
+    {
+      reactor_connection_.get();
+    }
+    for (std::size_t i = 0; i < channels_.size(); ++i)
+    {
+      if (!reactor_->connected(i))
+      {
+        failed_groups.push_back(channels_[i]->name);
+      }
+    }
+    return failed_groups;
+  }
+
+  // Wait until any attempt succeeded, or all of them ended, and then cancel the others
+  std::vector<bool> connected(channels_.size(), false);
+  bool connecting = true;
+  while (connecting)
+  {
+    connecting = false;
+    for (std::size_t i = 0; i < channels_.size(); ++i)
+    {
+      auto& channel = channels_[i];
+      if (!channel->connection.valid())
+      {
+        continue;
+      }
+      if (channel->connection.wait_for(std::chrono::milliseconds(CONNECTION_POLL_MS / 10)) !=
+          std::future_status::ready)
+      {
+        connecting = true;
+      }
+      else if (channel->connection.get())
+      {
+        connected[i] = true;
+        stop_connecting_ = true;
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < channels_.size(); ++i)
+  {
+    if (!connected[i])
+    {
+      failed_groups.push_back(channels_[i]->name);
+    }
+  }
+  return failed_groups;
+}
+
+bool EGMChannels::waitForMessage(const unsigned int timeout_ms)
+{
+  if (reactor_)
+  {
+    return reactor_->poll(timeout_ms) > 0;
+  }
+  if (channels_.size() == 1)
+  {
+    return channels_.front()->egm_manager->waitForMessage(timeout_ms);
+  }
+
+  // A message that arrives while waiting on another manager is still pending on the next turn, so none is missed
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  do
+  {
+    for (auto& channel : channels_)
+    {
+      if (channel->egm_manager->waitForMessage(timeout_ms == 0 ? 0 : WAIT_SLICE_MS))
+      {
+        return true;
+      }
+    }
+  } while (std::chrono::steady_clock::now() < deadline);
+  return false;
+}
+
+void EGMChannels::read()
+{
+  if (reactor_)
+  {
+    reactor_->poll(0);
+    return;
+  }
+  for (auto& channel : channels_)
+  {
+    channel->egm_manager->read(channel->motion_data);
+  }
+}
+
+void EGMChannels::write()
+{
+  if (reactor_)
+  {
+    reactor_->reply();
+    return;
+  }
+  for (auto& channel : channels_)
+  {
+    channel->egm_manager->write(channel->motion_data);
+  }
+}
+
+std::vector<abb::robot::MotionData*> EGMChannels::motionData()
+{
+  std::vector<abb::robot::MotionData*> motion_data;
+  for (auto& channel : channels_)
+  {
+    motion_data.push_back(&channel->motion_data);
+  }
+  return motion_data;
+}
+}  // namespace abb_hardware_interface
@@ -0,0 +1,139 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/egm_io_thread.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <limits>
+
+#include <rclcpp/rclcpp.hpp>
+
+namespace abb_hardware_interface
+{
+static const rclcpp::Logger LOGGER = rclcpp::get_logger("ABBSystemHardware");
+
+EGMIOThread::EGMIOThread(EGMChannels& egm_channels, JointBuffers& joint_buffers, CycleStatistics& statistics)
+  : egm_channels_(egm_channels)
+  , joint_buffers_(joint_buffers)
+  , statistics_(statistics)
+  , states_(joint_buffers.makeSample())
+  , commands_(joint_buffers.makeSample())
+{
+}
+
+EGMIOThread::~EGMIOThread()
+{
+  stop();
+}
+
+bool EGMIOThread::start(const int cpu_core)
+{
+  if (running_)
+  {
+    return true;
+  }
+
+  // Seed the command buffer, so the thread has something sensible to forward before the first write().
+  writeCommands();
+
+  running_ = true;
+  thread_ = std::thread(&EGMIOThread::run, this);
+
+  if (cpu_core < 0)
+  {
+    return true;
+  }
+  if (cpu_core >= CPU_SETSIZE)
+  {
+    RCLCPP_WARN(LOGGER, "Failed to pin the EGM I/O thread to CPU core %d (no such core)", cpu_core);
+    return false;
+  }
+
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu_core, &cpu_set);
+  const int result = pthread_setaffinity_np(thread_.native_handle(), sizeof(cpu_set_t), &cpu_set);
+  if (result != 0)
+  {
+    RCLCPP_WARN(LOGGER, "Failed to pin the EGM I/O thread to CPU core %d (error %d)", cpu_core, result);
+    return false;
+  }
+
+  RCLCPP_INFO(LOGGER, "EGM I/O thread pinned to CPU core %d", cpu_core);
+  return true;
+}
+
+void EGMIOThread::stop()
+{
+  running_ = false;
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+}
+
+bool EGMIOThread::readStates()
+{
+  if (!states_.update())
+  {
+    return false;
+  }
+  joint_buffers_.loadStates(states_.front());
+  return true;
+}
+
+void EGMIOThread::writeCommands()
+{
+  joint_buffers_.storeCommands(commands_.back());
+  commands_.back().stamp_ns = CycleStatistics::now();
+  commands_.publish();
+}
+
+double EGMIOThread::packetAge() const
+{
+  const std::int64_t stamp_ns = states_.front().stamp_ns;
+  if (stamp_ns == 0)
+  {
+    return std::numeric_limits<double>::infinity();
+  }
+  return static_cast<double>(CycleStatistics::now() - stamp_ns) * 1e-9;
+}
+
+void EGMIOThread::run()
+{
+  while (running_)
+  {
+    if (!egm_channels_.waitForMessage(WAIT_TIMEOUT_MS))
+    {
+      continue;
+    }
+
+    const std::int64_t stamp_ns = CycleStatistics::now();
+    statistics_.recordEGMMessage(stamp_ns);
+
+    egm_channels_.read();
+    JointSample& states = states_.back();
+    joint_buffers_.gatherStates(states);
+    states.stamp_ns = stamp_ns;
+    states_.publish();
+
+    // Forward the latest commands. If there are no new ones, the previous ones are repeated.
+    commands_.update();
+    joint_buffers_.scatterCommands(commands_.front());
+    egm_channels_.write();
+  }
+}
+}  // namespace abb_hardware_interface
@@ -0,0 +1,310 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/egm_reactor.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace abb_hardware_interface
+{
+constexpr std::size_t EGMReactor::MAX_MESSAGE_SIZE;
+constexpr std::size_t EGMReactor::RECEIVE_BATCH;
+constexpr int EGMReactor::MAX_ROBOT_JOINTS;
+
+namespace
+{
+constexpr double DEGREES_TO_RADIANS = M_PI / 180.0;
+constexpr double MILLIMETERS_TO_METERS = 1e-3;
+
+std::string errorText(const std::string& what)
+{
+  return what + ": " + std::strerror(errno);
+}
+}  // namespace
+
+EGMReactor::EGMReactor() : start_time_{ std::chrono::steady_clock::now() }
+{
+  epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd_ < 0)
+  {
+    throw std::runtime_error{ errorText("Failed to create the EGM epoll instance") };
+  }
+
+  for (std::size_t i = 0; i < RECEIVE_BATCH; ++i)
+  {
+    iovecs_[i].iov_base = buffers_[i].data();
+    iovecs_[i].iov_len = MAX_MESSAGE_SIZE;
+    std::memset(&messages_[i], 0, sizeof(mmsghdr));
+    messages_[i].msg_hdr.msg_name = &senders_[i];
+    messages_[i].msg_hdr.msg_iov = &iovecs_[i];
+    messages_[i].msg_hdr.msg_iovlen = 1;
+  }
+}
+
+EGMReactor::~EGMReactor()
+{
+  for (auto& group : groups_)
+  {
+    close(group->socket);
+  }
+  close(epoll_fd_);
+}
+
+void EGMReactor::addGroup(const abb::robot::MechanicalUnitGroup& description, abb::robot::MotionData& motion_data,
+                          const std::uint16_t port)
+{
+  auto group = std::make_unique<Group>();
+
+  // Units of the joints, in the order of the motion data: the robot first, then the external units
+  std::vector<double> scales;
+  for (const auto& joint : description.robot().standardized_joints())
+  {
+    scales.push_back(joint.rotating_move() ? DEGREES_TO_RADIANS : MILLIMETERS_TO_METERS);
+  }
+  group->num_robot_joints = std::min(static_cast<int>(scales.size()), MAX_ROBOT_JOINTS);
+  for (const auto& unit : description.mechanical_units())
+  {
+    for (const auto& joint : unit.standardized_joints())
+    {
+      scales.push_back(joint.rotating_move() ? DEGREES_TO_RADIANS : MILLIMETERS_TO_METERS);
+    }
+  }
+
+  for (auto& motion_group : motion_data.groups)
+  {
+    for (auto& unit : motion_group.units)
+    {
+      for (auto& joint : unit.joints)
+      {
+        const double scale = group->joints.size() < scales.size() ? scales[group->joints.size()] : 0.0;
+        group->joints.push_back(Joint{ &joint.state.position, &joint.state.velocity, &joint.command.position,
+                                       &joint.command.velocity, scale });
+      }
+    }
+  }
+  if (group->joints.size() != scales.size())
+  {
+    throw std::runtime_error{ "The motion data of mechanical unit group \"" + description.name() +
+                              "\" does not match its description" };
+  }
+
+  group->socket = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (group->socket < 0)
+  {
+    throw std::runtime_error{ errorText("Failed to create the EGM socket of \"" + description.name() + "\"") };
+  }
+
+  const int reuse = 1;
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  socklen_t address_size = sizeof(address);
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.u64 = groups_.size();
+  if (setsockopt(group->socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0 ||
+      bind(group->socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 ||
+      getsockname(group->socket, reinterpret_cast<sockaddr*>(&address), &address_size) < 0 ||
+      epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, group->socket, &event) < 0)
+  {
+    const std::string error = errorText("Failed to open EGM port " + std::to_string(port));
+    close(group->socket);
+    throw std::runtime_error{ error };
+  }
+  group->port = ntohs(address.sin_port);
+
+  groups_.push_back(std::move(group));
+  events_.resize(groups_.size());
+}
+
+std::size_t EGMReactor::poll(const unsigned int timeout_ms)
+{
+  for (auto& group : groups_)
+  {
+    group->fresh = false;
+  }
+
+  const int count =
+      epoll_wait(epoll_fd_, events_.data(), static_cast<int>(events_.size()), static_cast<int>(timeout_ms));
+  std::size_t fresh = 0;
+  for (int i = 0; i < count; ++i)
+  {
+    Group& group = *groups_[events_[i].data.u64];
+    receive(group);
+    fresh += group.fresh ? 1 : 0;
+  }
+  return fresh;
+}
+
+void EGMReactor::reply()
+{
+  commanding_ = true;
+  for (auto& group : groups_)
+  {
+    if (group->pending_reply)
+    {
+      send(*group);
+      group->pending_reply = false;
+    }
+  }
+}
+
+void EGMReactor::reset()
+{
+  commanding_ = false;
+  for (auto& group : groups_)
+  {
+    // Messages received before the reset may be from a finished EGM session
+    while (recvmmsg(group->socket, messages_.data(), RECEIVE_BATCH, MSG_DONTWAIT, nullptr) > 0)
+    {
+    }
+    group->connected = false;
+    group->fresh = false;
+    group->pending_reply = false;
+    group->feedback_time = 0.0;
+  }
+}
+
+void EGMReactor::receive(Group& group)
+{
+  // Drain the socket. The newest message is the last one of the last non-empty batch.
+  int last_count = 0;
+  while (true)
+  {
+    for (auto& message : messages_)
+    {
+      message.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+    }
+    const int count = recvmmsg(group.socket, messages_.data(), RECEIVE_BATCH, MSG_DONTWAIT, nullptr);
+    if (count <= 0)
+    {
+      break;
+    }
+    coalesced_messages_ += static_cast<std::uint64_t>(count - 1 + (last_count > 0 ? 1 : 0));
+    last_count = count;
+    if (static_cast<std::size_t>(count) < RECEIVE_BATCH)
+    {
+      break;
+    }
+  }
+  if (last_count == 0)
+  {
+    return;
+  }
+
+  const mmsghdr& newest = messages_[last_count - 1];
+  if ((newest.msg_hdr.msg_flags & MSG_TRUNC) || !parse(group, buffers_[last_count - 1].data(), newest.msg_len))
+  {
+    return;
+  }
+  group.sender = senders_[last_count - 1];
+  group.connected = true;
+  group.fresh = true;
+
+  if (commanding_)
+  {
+    group.pending_reply = true;
+  }
+  else
+  {
+    send(group);
+  }
+}
+
+bool EGMReactor::parse(Group& group, const char* data, const std::size_t size)
+{
+  if (!robot_message_.ParseFromArray(data, static_cast<int>(size)) || !robot_message_.has_feedback())
+  {
+    return false;
+  }
+
+  const auto& feedback = robot_message_.feedback();
+  const auto& robot_joints = feedback.joints();
+  const auto& external_joints = feedback.externaljoints();
+  const std::size_t num_external = group.joints.size() - static_cast<std::size_t>(group.num_robot_joints);
+  if (robot_joints.joints_size() < group.num_robot_joints ||
+      static_cast<std::size_t>(external_joints.joints_size()) < num_external)
+  {
+    return false;
+  }
+
+  // EGM only reports positions, so the velocities are estimated from consecutive feedback
+  double time = 1e-3 * static_cast<double>(robot_message_.header().tm());
+  if (feedback.has_time())
+  {
+    time = static_cast<double>(feedback.time().sec()) + 1e-6 * static_cast<double>(feedback.time().usec());
+  }
+  const double dt = time - group.feedback_time;
+  const bool estimate_velocity = group.connected && dt > 0.0;
+  group.feedback_time = time;
+
+  for (std::size_t k = 0; k < group.joints.size(); ++k)
+  {
+    const Joint& joint = group.joints[k];
+    const int robot_index = static_cast<int>(k);
+    const double value = robot_index < group.num_robot_joints ?
+                             robot_joints.joints(robot_index) :
+                             external_joints.joints(robot_index - group.num_robot_joints);
+    const double position = value * joint.scale;
+    *joint.state_velocity = estimate_velocity ? (position - *joint.state_position) / dt : 0.0;
+    *joint.state_position = position;
+  }
+  return true;
+}
+
+void EGMReactor::send(Group& group)
+{
+  sensor_message_.Clear();
+  auto header = sensor_message_.mutable_header();
+  header->set_seqno(group.sequence_number++);
+  header->set_tm(static_cast<std::uint32_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time_).count()));
+  header->set_mtype(abb::egm::EgmHeader::MSGTYPE_CORRECTION);
+
+  auto planned = sensor_message_.mutable_planned();
+  auto speed = sensor_message_.mutable_speedref();
+  for (std::size_t k = 0; k < group.joints.size(); ++k)
+  {
+    const Joint& joint = group.joints[k];
+    const double position = (commanding_ ? *joint.command_position : *joint.state_position) / joint.scale;
+    const double velocity = (commanding_ ? *joint.command_velocity : 0.0) / joint.scale;
+    if (static_cast<int>(k) < group.num_robot_joints)
+    {
+      planned->mutable_joints()->add_joints(position);
+      speed->mutable_joints()->add_joints(velocity);
+    }
+    else
+    {
+      planned->mutable_externaljoints()->add_joints(position);
+      speed->mutable_externaljoints()->add_joints(velocity);
+    }
+  }
+
+  const std::size_t size = sensor_message_.ByteSizeLong();
+  if (size > send_buffer_.size() || !sensor_message_.SerializeToArray(send_buffer_.data(), static_cast<int>(size)))
+  {
+    return;
+  }
+  sendto(group.socket, send_buffer_.data(), size, MSG_DONTWAIT, reinterpret_cast<const sockaddr*>(&group.sender),
+         sizeof(group.sender));
+}
+}  // namespace abb_hardware_interface
@@ -0,0 +1,183 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/joint_buffers.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace abb_hardware_interface
+{
+void JointBuffers::initialize(abb::robot::MotionData& motion_data)
+{
+  initialize(std::vector<abb::robot::MotionData*>{ &motion_data });
+}
+
+void JointBuffers::initialize(const std::vector<abb::robot::MotionData*>& motion_data)
+{
+  groups_.clear();
+
+  for (auto p_motion_data : motion_data)
+  {
+    for (auto& group : p_motion_data->groups)
+    {
+      GroupJointBuffers buffers;
+      buffers.name = group.name;
+
+      for (auto& unit : group.units)
+      {
+        for (auto& joint : unit.joints)
+        {
+          buffers.joint_names.push_back(stripJointName(joint.name));
+          buffers.bindings.push_back(JointBinding{ &joint.state.position, &joint.state.velocity,
+                                                   &joint.command.position, &joint.command.velocity });
+        }
+      }
+
+      const auto num_joints = buffers.bindings.size();
+      buffers.positions.assign(num_joints, 0.0);
+      buffers.velocities.assign(num_joints, 0.0);
+      buffers.position_commands.assign(num_joints, 0.0);
+      buffers.velocity_commands.assign(num_joints, 0.0);
+
+      groups_.push_back(std::move(buffers));
+    }
+  }
+
+  updateStates();
+  holdPositions();
+}
+
+void JointBuffers::updateStates()
+{
+  for (auto& group : groups_)
+  {
+    const std::size_t num_joints = group.bindings.size();
+    const JointBinding* bindings = group.bindings.data();
+    double* positions = group.positions.data();
+    double* velocities = group.velocities.data();
+
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      positions[i] = *bindings[i].state_position;
+      velocities[i] = *bindings[i].state_velocity;
+    }
+  }
+}
+
+void JointBuffers::updateCommands()
+{
+  for (auto& group : groups_)
+  {
+    const std::size_t num_joints = group.bindings.size();
+    const JointBinding* bindings = group.bindings.data();
+    const double* position_commands = group.position_commands.data();
+    const double* velocity_commands = group.velocity_commands.data();
+
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      *bindings[i].command_position = position_commands[i];
+      *bindings[i].command_velocity = velocity_commands[i];
+    }
+  }
+}
+
+void JointBuffers::holdPositions()
+{
+  for (auto& group : groups_)
+  {
+    std::copy(group.positions.begin(), group.positions.end(), group.position_commands.begin());
+    std::fill(group.velocity_commands.begin(), group.velocity_commands.end(), 0.0);
+  }
+}
+
+JointSample JointBuffers::makeSample() const
+{
+  JointSample sample;
+  sample.positions.assign(size(), 0.0);
+  sample.velocities.assign(size(), 0.0);
+  return sample;
+}
+
+void JointBuffers::gatherStates(JointSample& sample) const
+{
+  std::size_t k = 0;
+  for (const auto& group : groups_)
+  {
+    for (const auto& binding : group.bindings)
+    {
+      sample.positions[k] = *binding.state_position;
+      sample.velocities[k] = *binding.state_velocity;
+      ++k;
+    }
+  }
+}
+
+void JointBuffers::scatterCommands(const JointSample& sample) const
+{
+  std::size_t k = 0;
+  for (const auto& group : groups_)
+  {
+    for (const auto& binding : group.bindings)
+    {
+      *binding.command_position = sample.positions[k];
+      *binding.command_velocity = sample.velocities[k];
+      ++k;
+    }
+  }
+}
+
+void JointBuffers::loadStates(const JointSample& sample)
+{
+  auto positions = sample.positions.begin();
+  auto velocities = sample.velocities.begin();
+  for (auto& group : groups_)
+  {
+    const auto num_joints = static_cast<std::ptrdiff_t>(group.positions.size());
+    std::copy(positions, positions + num_joints, group.positions.begin());
+    std::copy(velocities, velocities + num_joints, group.velocities.begin());
+    positions += num_joints;
+    velocities += num_joints;
+  }
+}
+
+void JointBuffers::storeCommands(JointSample& sample) const
+{
+  auto positions = sample.positions.begin();
+  auto velocities = sample.velocities.begin();
+  for (const auto& group : groups_)
+  {
+    positions = std::copy(group.position_commands.begin(), group.position_commands.end(), positions);
+    velocities = std::copy(group.velocity_commands.begin(), group.velocity_commands.end(), velocities);
+  }
+}
+
+std::size_t JointBuffers::size() const
+{
+  std::size_t num_joints = 0;
+  for (const auto& group : groups_)
+  {
+    num_joints += group.bindings.size();
+  }
+  return num_joints;
+}
+
+std::string stripJointName(const std::string& name)
+{
+  // TODO(seng): Consider changing joint names in robot description to match what comes
+  // from the ABB robot description to avoid needing to strip the prefix here
+  const auto pos = name.find("joint");
+  return pos == std::string::npos ? name : name.substr(pos);
+}
+}  // namespace abb_hardware_interface
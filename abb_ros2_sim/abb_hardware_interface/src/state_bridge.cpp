@@ -0,0 +1,217 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/state_bridge.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace abb_hardware_interface
+{
+namespace
+{
+/**
+ * \brief Attempts to read a consistent state, before giving up until the next read.
+ */
+constexpr int MAX_READ_ATTEMPTS = 8;
+
+std::string segmentPath(const std::string& name)
+{
+  return "/" + name;
+}
+}  // namespace
+
+std::string stateBridgeJointName(const std::string& group, const std::string& joint)
+{
+  return group + "/" + stripJointName(joint);
+}
+
+StateBridgeWriter::StateBridgeWriter(const std::string& name, const std::vector<GroupJointBuffers>& groups)
+{
+  std::vector<std::string> joint_names;
+  for (const auto& group : groups)
+  {
+    for (const auto& joint : group.joint_names)
+    {
+      joint_names.push_back(stateBridgeJointName(group.name, joint));
+    }
+  }
+  if (joint_names.size() > STATE_BRIDGE_MAX_JOINTS)
+  {
+    throw std::runtime_error{ "Too many joints for a state bridge (" + std::to_string(joint_names.size()) + ")" };
+  }
+
+  fd_ = shm_open(segmentPath(name).c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  void* mapping = MAP_FAILED;
+  if (fd_ < 0 || ftruncate(fd_, sizeof(StateBridgeSegment)) != 0 ||
+      (mapping = mmap(nullptr, sizeof(StateBridgeSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0)) == MAP_FAILED)
+  {
+    const std::string error = std::strerror(errno);
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+    throw std::runtime_error{ "Failed to create state bridge '" + name + "': " + error };
+  }
+  segment_ = static_cast<StateBridgeSegment*>(mapping);
+
+  // Take the segment over from a previous writer: readers see an odd generation until the joints are set up
+  std::uint32_t generation = segment_->generation.load(std::memory_order_relaxed);
+  generation += (generation % 2 == 0) ? 1 : 0;
+  segment_->generation.store(generation, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  std::memcpy(segment_->magic, STATE_BRIDGE_MAGIC, sizeof(STATE_BRIDGE_MAGIC));
+  segment_->version = STATE_BRIDGE_VERSION;
+  segment_->num_joints = static_cast<std::uint32_t>(joint_names.size());
+  std::memset(segment_->joint_names, 0, sizeof(segment_->joint_names));
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    std::strncpy(segment_->joint_names[i], joint_names[i].c_str(), STATE_BRIDGE_NAME_SIZE - 1);
+  }
+  segment_->sequence.store(segment_->sequence.load(std::memory_order_relaxed) & ~1u, std::memory_order_relaxed);
+  segment_->stamp_ns = 0;
+  segment_->cycle = 0;
+
+  segment_->generation.store(generation + 1, std::memory_order_release);
+}
+
+StateBridgeWriter::~StateBridgeWriter()
+{
+  munmap(segment_, sizeof(StateBridgeSegment));
+  close(fd_);
+}
+
+void StateBridgeWriter::publish(const std::vector<GroupJointBuffers>& groups, const std::int64_t stamp_ns)
+{
+  const std::uint32_t sequence = segment_->sequence.load(std::memory_order_relaxed);
+  segment_->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  segment_->stamp_ns = stamp_ns;
+  segment_->cycle = ++cycle_;
+  std::size_t k = 0;
+  for (const auto& group : groups)
+  {
+    for (std::size_t i = 0; i < group.positions.size() && k < segment_->num_joints; ++i, ++k)
+    {
+      segment_->positions[k] = group.positions[i];
+      segment_->velocities[k] = group.velocities[i];
+    }
+  }
+
+  segment_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+StateBridgeReader::StateBridgeReader(const std::string& name)
+{
+  fd_ = shm_open(segmentPath(name).c_str(), O_RDONLY | O_CLOEXEC, 0);
+  struct stat status;
+  if (fd_ < 0 || fstat(fd_, &status) != 0)
+  {
+    const std::string error = std::strerror(errno);
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+    throw std::runtime_error{ "Failed to open state bridge '" + name + "': " + error };
+  }
+
+  void* mapping = MAP_FAILED;
+  if (static_cast<std::size_t>(status.st_size) < sizeof(StateBridgeSegment) ||
+      (mapping = mmap(nullptr, sizeof(StateBridgeSegment), PROT_READ, MAP_SHARED, fd_, 0)) == MAP_FAILED)
+  {
+    close(fd_);
+    throw std::runtime_error{ "Failed to map state bridge '" + name + "'" };
+  }
+  segment_ = static_cast<const StateBridgeSegment*>(mapping);
+
+  if (std::memcmp(segment_->magic, STATE_BRIDGE_MAGIC, sizeof(STATE_BRIDGE_MAGIC)) != 0 ||
+      segment_->version != STATE_BRIDGE_VERSION)
+  {
+    munmap(mapping, sizeof(StateBridgeSegment));
+    close(fd_);
+    throw std::runtime_error{ "'" + name + "' is not a state bridge of version " +
+                              std::to_string(STATE_BRIDGE_VERSION) };
+  }
+}
+
+StateBridgeReader::~StateBridgeReader()
+{
+  munmap(const_cast<StateBridgeSegment*>(segment_), sizeof(StateBridgeSegment));
+  close(fd_);
+}
+
+std::vector<std::string> StateBridgeReader::jointNames(std::uint32_t& generation) const
+{
+  std::vector<std::string> names;
+  generation = segment_->generation.load(std::memory_order_acquire);
+  if (generation % 2 != 0)
+  {
+    return {};
+  }
+  const std::size_t num_joints = std::min<std::size_t>(segment_->num_joints, STATE_BRIDGE_MAX_JOINTS);
+  for (std::size_t i = 0; i < num_joints; ++i)
+  {
+    names.emplace_back(segment_->joint_names[i], strnlen(segment_->joint_names[i], STATE_BRIDGE_NAME_SIZE));
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (segment_->generation.load(std::memory_order_relaxed) != generation)
+  {
+    return {};
+  }
+  return names;
+}
+
+bool StateBridgeReader::read(StateBridgeSample& sample) const
+{
+  for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; ++attempt)
+  {
+    const std::uint32_t generation = segment_->generation.load(std::memory_order_acquire);
+    const std::uint32_t sequence = segment_->sequence.load(std::memory_order_acquire);
+    if (generation % 2 != 0)
+    {
+      return false;
+    }
+    if (sequence % 2 != 0)
+    {
+      continue;
+    }
+
+    const std::size_t num_joints = std::min<std::size_t>(segment_->num_joints, STATE_BRIDGE_MAX_JOINTS);
+    sample.positions.resize(num_joints);
+    sample.velocities.resize(num_joints);
+    sample.generation = generation;
+    sample.stamp_ns = segment_->stamp_ns;
+    sample.cycle = segment_->cycle;
+    std::memcpy(sample.positions.data(), segment_->positions, num_joints * sizeof(double));
+    std::memcpy(sample.velocities.data(), segment_->velocities, num_joints * sizeof(double));
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (segment_->sequence.load(std::memory_order_relaxed) == sequence &&
+        segment_->generation.load(std::memory_order_relaxed) == generation)
+    {
+      return sample.cycle > 0;
+    }
+  }
+  return false;
+}
+}  // namespace abb_hardware_interface
@@ -0,0 +1,201 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_hardware_interface/telemetry_recorder.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace abb_hardware_interface
+{
+namespace
+{
+std::string errorText(const std::string& what)
+{
+  return what + ": " + std::strerror(errno);
+}
+}  // namespace
+
+TelemetryRecorder::TelemetryRecorder(const std::string& path, const std::uint64_t capacity,
+                                     const TelemetrySource source, const std::vector<TelemetryGroup>& groups)
+  : capacity_(capacity)
+{
+  // The capacity is limited to what a mapping (and a file offset) can hold
+  const std::uint64_t max_capacity =
+      (std::min<std::uint64_t>(std::numeric_limits<std::size_t>::max(), std::numeric_limits<off_t>::max()) -
+       TELEMETRY_HEADER_SIZE) /
+      sizeof(TelemetryRecord);
+  if (capacity == 0 || capacity > max_capacity || groups.size() > TELEMETRY_MAX_GROUPS)
+  {
+    throw std::runtime_error{ "Invalid telemetry file configuration" };
+  }
+
+  fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd_ < 0)
+  {
+    throw std::runtime_error{ errorText("Failed to create telemetry file '" + path + "'") };
+  }
+
+  // Reserve the blocks now, so that a full disk is reported here instead of as a SIGBUS in the control loop
+  // (posix_fallocate returns its error instead of setting errno). Only a file system that can not reserve blocks falls
+  // back to a sparse file.
+  mapping_size_ = TELEMETRY_HEADER_SIZE + static_cast<std::size_t>(capacity) * sizeof(TelemetryRecord);
+  const int allocated = posix_fallocate(fd_, 0, static_cast<off_t>(mapping_size_));
+  if (allocated != 0)
+  {
+    errno = allocated;
+    if ((allocated != EOPNOTSUPP && allocated != EINVAL) || ftruncate(fd_, static_cast<off_t>(mapping_size_)) != 0)
+    {
+      const std::string error = errorText("Failed to allocate telemetry file '" + path + "'");
+      close(fd_);
+      throw std::runtime_error{ error };
+    }
+  }
+
+  mapping_ = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, 0);
+  if (mapping_ == MAP_FAILED)
+  {
+    const std::string error = errorText("Failed to map telemetry file '" + path + "'");
+    close(fd_);
+    throw std::runtime_error{ error };
+  }
+
+  // Touch every page, so that appending never faults them in
+  std::memset(mapping_, 0, mapping_size_);
+  mlock(mapping_, mapping_size_);
+
+  header_ = new (mapping_) TelemetryHeader;
+  records_ = reinterpret_cast<TelemetryRecord*>(static_cast<char*>(mapping_) + TELEMETRY_HEADER_SIZE);
+
+  std::memcpy(header_->magic, TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC));
+  header_->version = TELEMETRY_VERSION;
+  header_->record_size = sizeof(TelemetryRecord);
+  header_->capacity = capacity;
+  header_->written.store(0, std::memory_order_relaxed);
+  header_->start_wall_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+          .count();
+  header_->start_steady_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+  header_->source = static_cast<std::uint32_t>(source);
+  header_->num_groups = static_cast<std::uint32_t>(groups.size());
+  std::copy(groups.begin(), groups.end(), header_->groups);
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+  msync(mapping_, mapping_size_, MS_ASYNC);
+  munmap(mapping_, mapping_size_);
+  close(fd_);
+}
+
+void TelemetryRecorder::append(const TelemetryKind kind, const std::uint16_t group, const std::size_t num_values,
+                               const double* positions, const double* velocities, const double source_time)
+{
+  const std::uint64_t index = written_++;
+  TelemetryRecord& record = records_[index % capacity_];
+
+  // Invalidate the slot before overwriting it, so that readers never accept a torn record
+  record.sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  TelemetrySample& sample = record.sample;
+  const std::size_t count = std::min(num_values, TELEMETRY_MAX_VALUES);
+  sample.stamp_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+  sample.source_time = source_time;
+  sample.group = group;
+  sample.kind = kind;
+  sample.num_values = static_cast<std::uint8_t>(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    sample.positions[i] = positions[i];
+    sample.velocities[i] = velocities ? velocities[i] : 0.0;
+  }
+
+  record.sequence.store(index + 1, std::memory_order_release);
+  header_->written.store(written_, std::memory_order_release);
+}
+
+TelemetryReader::TelemetryReader(const std::string& path)
+{
+  fd_ = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat status;
+  if (fd_ < 0 || fstat(fd_, &status) != 0)
+  {
+    const std::string error = errorText("Failed to open telemetry file '" + path + "'");
+    if (fd_ >= 0)
+    {
+      close(fd_);
+    }
+    throw std::runtime_error{ error };
+  }
+
+  mapping_size_ = static_cast<std::size_t>(status.st_size);
+  if (mapping_size_ < TELEMETRY_HEADER_SIZE ||
+      (mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd_, 0)) == MAP_FAILED)
+  {
+    close(fd_);
+    throw std::runtime_error{ "Failed to map telemetry file '" + path + "'" };
+  }
+  header_ = static_cast<const TelemetryHeader*>(mapping_);
+  records_ = reinterpret_cast<const TelemetryRecord*>(static_cast<const char*>(mapping_) + TELEMETRY_HEADER_SIZE);
+
+  if (std::memcmp(header_->magic, TELEMETRY_MAGIC, sizeof(TELEMETRY_MAGIC)) != 0 ||
+      header_->version != TELEMETRY_VERSION || header_->record_size != sizeof(TelemetryRecord) ||
+      mapping_size_ < TELEMETRY_HEADER_SIZE + header_->capacity * sizeof(TelemetryRecord))
+  {
+    munmap(mapping_, mapping_size_);
+    close(fd_);
+    throw std::runtime_error{ "'" + path + "' is not a telemetry file of version " +
+                              std::to_string(TELEMETRY_VERSION) };
+  }
+}
+
+TelemetryReader::~TelemetryReader()
+{
+  munmap(mapping_, mapping_size_);
+  close(fd_);
+}
+
+std::uint64_t TelemetryReader::oldest() const
+{
+  const std::uint64_t count = written();
+  return count > header_->capacity ? count - header_->capacity : 0;
+}
+
+bool TelemetryReader::read(const std::uint64_t index, TelemetrySample& sample) const
+{
+  const TelemetryRecord& record = records_[index % header_->capacity];
+  if (record.sequence.load(std::memory_order_acquire) != index + 1)
+  {
+    return false;
+  }
+  std::memcpy(&sample, &record.sample, sizeof(sample));
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return record.sequence.load(std::memory_order_relaxed) == index + 1;
+}
+}  // namespace abb_hardware_interface
@@ -40,6 +40,7 @@
 // https://github.com/ros-industrial/abb_robot_driver/blob/master/abb_robot_cpp_utilities/src/verification.cpp
 
 #include <abb_hardware_interface/utilities.hpp>
+#include <algorithm>
 #include <stdexcept>
 
 #include <rclcpp/rclcpp.hpp>
@@ -100,6 +101,34 @@ RobotControllerDescription establishRWSConnection(RWSManager& rws_manager, const
   throw std::runtime_error{ RWS_CONNECTION_ERROR_MESSAGE };
 }
 
+RobotControllerDescription establishRWSConnection(RWSManager& rws_manager, const std::string& robot_controller_id,
+                                                  const std::chrono::steady_clock::time_point deadline)
+{
+  unsigned int attempt{ 0 };
+
+  while (rclcpp::ok() && std::chrono::steady_clock::now() < deadline)
+  {
+    try
+    {
+      return rws_manager.collectAndParseSystemData(robot_controller_id);
+    }
+    catch (const std::runtime_error& exception)
+    {
+      const auto remaining = deadline - std::chrono::steady_clock::now();
+      RCLCPP_WARN_STREAM(LOGGER, RWS_CONNECTION_ERROR_MESSAGE
+                                     << " (attempt " << ++attempt << ", "
+                                     << std::chrono::duration_cast<std::chrono::seconds>(remaining).count()
+                                     << " s left), reason: '" << exception.what() << "'");
+
+      // Don't sleep past the deadline.
+      rclcpp::sleep_for(std::min<std::chrono::nanoseconds>(std::chrono::seconds(RWS_RECONNECTION_WAIT_TIME),
+                                                           std::max<std::chrono::nanoseconds>(remaining, {})));
+    }
+  }
+
+  throw std::runtime_error{ RWS_CONNECTION_ERROR_MESSAGE };
+}
+
 void verifyRobotWareVersion(const RobotWareVersion& rw_version)
 {
   if (rw_version.major_number() == 6 && rw_version.minor_number() < 7 && rw_version.patch_number() < 1)
@@ -0,0 +1,276 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <abb_hardware_interface/egm_channels.hpp>
+#include <abb_hardware_interface/egm_reactor.hpp>
+
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int AXES_PER_GROUP = 6;
+
+/**
+ * \brief First port of the EGM managers, which cannot pick free ports themselves.
+ */
+constexpr std::uint16_t MANAGERS_BASE_PORT = 16511;
+
+/**
+ * \brief Time [ms] to wait for a reply before giving up.
+ */
+constexpr int REPLY_TIMEOUT_MS = 100;
+
+/**
+ * \brief Creates a robot controller description with one TCP robot per mechanical units group, in the same way as
+ * ABBSystemHardware::on_init does from the HardwareInfo.
+ *
+ * \param num_groups number of mechanical units groups (more than one for MultiMove setups).
+ *
+ * \return abb::robot::RobotControllerDescription with the generated description.
+ */
+abb::robot::RobotControllerDescription makeDescription(const int num_groups)
+{
+  abb::robot::RobotControllerDescription description;
+
+  auto header{ description.mutable_header() };
+  header->mutable_robot_ware_version()->set_major_number(7);
+  header->mutable_robot_ware_version()->set_minor_number(3);
+  header->mutable_robot_ware_version()->set_patch_number(2);
+  description.mutable_system_indicators()->mutable_options()->set_egm(true);
+
+  for (int g = 0; g < num_groups; ++g)
+  {
+    auto mug{ description.add_mechanical_units_groups() };
+    mug->set_name("rob" + std::to_string(g + 1));
+
+    auto robot{ mug->mutable_robot() };
+    robot->set_type(abb::robot::MechanicalUnit_Type_TCP_ROBOT);
+    robot->set_axes_total(AXES_PER_GROUP);
+    robot->set_mode(abb::robot::MechanicalUnit_Mode_ACTIVATED);
+
+    for (int i = 0; i < AXES_PER_GROUP; ++i)
+    {
+      abb::robot::StandardizedJoint* p_joint = robot->add_standardized_joints();
+      p_joint->set_standardized_name("joint_" + std::to_string(i + 1));
+      p_joint->set_rotating_move(true);
+      p_joint->set_lower_joint_bound(-3.14);
+      p_joint->set_upper_joint_bound(3.14);
+    }
+  }
+
+  return description;
+}
+
+/**
+ * \brief Robot controller side of the EGM channels, sending the same feedback to every group on the loopback.
+ */
+class RobotSide
+{
+public:
+  explicit RobotSide(const std::vector<std::uint16_t>& ports)
+  {
+    abb::egm::EgmRobot message;
+    message.mutable_header()->set_mtype(abb::egm::EgmHeader::MSGTYPE_DATA);
+    for (int i = 0; i < AXES_PER_GROUP; ++i)
+    {
+      message.mutable_feedback()->mutable_joints()->add_joints(10.0 * i);
+    }
+    message.SerializeToString(&message_);
+
+    for (const auto port : ports)
+    {
+      sockaddr_in address{};
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      address.sin_port = htons(port);
+      const int socket_fd = socket(AF_INET, SOCK_DGRAM, 0);
+      connect(socket_fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address));
+      sockets_.push_back(socket_fd);
+    }
+  }
+
+  ~RobotSide()
+  {
+    for (const int socket_fd : sockets_)
+    {
+      close(socket_fd);
+    }
+  }
+
+  void send(const std::size_t group) { ::send(sockets_[group], message_.data(), message_.size(), 0); }
+
+  /**
+   * \brief Waits for the reply of a group.
+   *
+   * \return bool true if a reply arrived before the timeout.
+   */
+  bool receive(const std::size_t group)
+  {
+    pollfd descriptor{ sockets_[group], POLLIN, 0 };
+    if (::poll(&descriptor, 1, REPLY_TIMEOUT_MS) <= 0)
+    {
+      return false;
+    }
+    return recv(sockets_[group], buffer_, sizeof(buffer_), 0) > 0;
+  }
+
+private:
+  std::vector<int> sockets_;
+  std::string message_;
+  char buffer_[2048];
+};
+
+/**
+ * \brief Reactor with one group per motion data instance, on free ports.
+ */
+struct ReactorSetup
+{
+  explicit ReactorSetup(const int num_groups) : description(makeDescription(num_groups)), motion_data(num_groups)
+  {
+    for (int g = 0; g < num_groups; ++g)
+    {
+      abb::robot::RobotControllerDescription group_description{ description };
+      group_description.clear_mechanical_units_groups();
+      group_description.add_mechanical_units_groups()->CopyFrom(description.mechanical_units_groups(g));
+      abb::robot::initializeMotionData(motion_data[g], group_description);
+
+      reactor.addGroup(description.mechanical_units_groups(g), motion_data[g], 0);
+      ports.push_back(reactor.port(g));
+    }
+
+    // Answer with commands from now on
+    reactor.reply();
+  }
+
+  abb::robot::RobotControllerDescription description;
+  std::vector<abb::robot::MotionData> motion_data;
+  abb_hardware_interface::EGMReactor reactor;
+  std::vector<std::uint16_t> ports;
+};
+
+/**
+ * \brief Measures one EGM cycle of all groups, from the robot sending its feedback to it receiving the commands.
+ */
+void BM_EGMReactorRoundTrip(benchmark::State& state)
+{
+  const auto num_groups = static_cast<std::size_t>(state.range(0));
+  ReactorSetup setup(static_cast<int>(num_groups));
+  RobotSide robot(setup.ports);
+
+  for (auto _ : state)
+  {
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      robot.send(g);
+    }
+    std::size_t fresh = 0;
+    while (fresh < num_groups)
+    {
+      fresh += setup.reactor.poll(REPLY_TIMEOUT_MS);
+    }
+    setup.reactor.reply();
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      if (!robot.receive(g))
+      {
+        state.SkipWithError("No reply from the reactor");
+        return;
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_groups));
+}
+
+/**
+ * \brief Measures a cycle in which only the first group sent a message, which the others must not slow down.
+ */
+void BM_EGMReactorPartialRead(benchmark::State& state)
+{
+  ReactorSetup setup(static_cast<int>(state.range(0)));
+  RobotSide robot(setup.ports);
+
+  for (auto _ : state)
+  {
+    robot.send(0);
+    while (setup.reactor.poll(REPLY_TIMEOUT_MS) == 0)
+    {
+    }
+    setup.reactor.reply();
+    if (!robot.receive(0))
+    {
+      state.SkipWithError("No reply from the reactor");
+      return;
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * \brief Measures the same cycle as BM_EGMReactorRoundTrip with one EGM manager per group, for comparison.
+ *
+ * The managers reply from their own threads, and the cycle is paced by the first group only.
+ */
+void BM_EGMManagersRoundTrip(benchmark::State& state)
+{
+  const auto num_groups = static_cast<std::size_t>(state.range(0));
+  const abb::robot::RobotControllerDescription description = makeDescription(static_cast<int>(num_groups));
+
+  abb_hardware_interface::EGMChannels channels;
+  std::vector<std::uint16_t> ports;
+  for (std::size_t g = 0; g < num_groups; ++g)
+  {
+    ports.push_back(static_cast<std::uint16_t>(MANAGERS_BASE_PORT + g));
+    channels.addChannel(description, description.mechanical_units_groups(static_cast<int>(g)), ports.back());
+  }
+  RobotSide robot(ports);
+
+  for (auto _ : state)
+  {
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      robot.send(g);
+    }
+    channels.waitForMessage(REPLY_TIMEOUT_MS);
+    channels.read();
+    channels.write();
+    for (std::size_t g = 0; g < num_groups; ++g)
+    {
+      if (!robot.receive(g))
+      {
+        state.SkipWithError("No reply from the EGM managers");
+        return;
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_groups));
+}
+}  // namespace
+
+// Argument: number of mechanical units groups.
+BENCHMARK(BM_EGMReactorRoundTrip)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_EGMReactorPartialRead)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_EGMManagersRoundTrip)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+BENCHMARK_MAIN();
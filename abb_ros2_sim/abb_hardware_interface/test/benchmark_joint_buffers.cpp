@@ -0,0 +1,120 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <abb_hardware_interface/joint_buffers.hpp>
+
+#include <string>
+
+namespace
+{
+/**
+ * \brief Creates a robot controller description with one TCP robot per mechanical units group, in the same way as
+ * ABBSystemHardware::on_init does from the HardwareInfo.
+ *
+ * \param num_groups number of mechanical units groups (more than one for MultiMove setups).
+ * \param axes_per_group number of joints of each robot.
+ *
+ * \return abb::robot::RobotControllerDescription with the generated description.
+ */
+abb::robot::RobotControllerDescription makeDescription(const int num_groups, const int axes_per_group)
+{
+  abb::robot::RobotControllerDescription description;
+
+  auto header{ description.mutable_header() };
+  header->mutable_robot_ware_version()->set_major_number(7);
+  header->mutable_robot_ware_version()->set_minor_number(3);
+  header->mutable_robot_ware_version()->set_patch_number(2);
+  description.mutable_system_indicators()->mutable_options()->set_egm(true);
+
+  for (int g = 0; g < num_groups; ++g)
+  {
+    auto mug{ description.add_mechanical_units_groups() };
+    mug->set_name(num_groups == 1 ? "" : "rob" + std::to_string(g + 1));
+
+    auto robot{ mug->mutable_robot() };
+    robot->set_type(abb::robot::MechanicalUnit_Type_TCP_ROBOT);
+    robot->set_axes_total(axes_per_group);
+    robot->set_mode(abb::robot::MechanicalUnit_Mode_ACTIVATED);
+
+    for (int i = 0; i < axes_per_group; ++i)
+    {
+      abb::robot::StandardizedJoint* p_joint = robot->add_standardized_joints();
+      p_joint->set_standardized_name("joint_" + std::to_string(i + 1));
+      p_joint->set_rotating_move(true);
+      p_joint->set_lower_joint_bound(-3.14);
+      p_joint->set_upper_joint_bound(3.14);
+    }
+  }
+
+  return description;
+}
+
+/**
+ * \brief Measures one control cycle worth of buffer traffic, i.e. what read() and write() add on top of EGM.
+ */
+void BM_JointBuffersCycle(benchmark::State& state)
+{
+  abb::robot::MotionData motion_data;
+  abb::robot::initializeMotionData(motion_data,
+                                   makeDescription(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+
+  abb_hardware_interface::JointBuffers joint_buffers;
+  joint_buffers.initialize(motion_data);
+
+  for (auto _ : state)
+  {
+    joint_buffers.updateStates();
+    joint_buffers.updateCommands();
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(joint_buffers.size()));
+}
+
+/**
+ * \brief Measures the previous approach for comparison, i.e. walking the nested motion data structure.
+ */
+void BM_MotionDataTraversal(benchmark::State& state)
+{
+  abb::robot::MotionData motion_data;
+  abb::robot::initializeMotionData(motion_data,
+                                   makeDescription(static_cast<int>(state.range(0)), static_cast<int>(state.range(1))));
+
+  double sink = 0.0;
+  for (auto _ : state)
+  {
+    for (auto& group : motion_data.groups)
+    {
+      for (auto& unit : group.units)
+      {
+        for (auto& joint : unit.joints)
+        {
+          sink += joint.state.position + joint.state.velocity;
+          joint.command.position = sink;
+          joint.command.velocity = 0.0;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sink);
+  }
+}
+}  // namespace
+
+// Arguments: number of mechanical units groups, axes per group.
+BENCHMARK(BM_JointBuffersCycle)->Args({ 1, 6 })->Args({ 1, 7 })->Args({ 2, 6 })->Args({ 4, 6 });
+BENCHMARK(BM_MotionDataTraversal)->Args({ 1, 6 })->Args({ 1, 7 })->Args({ 2, 6 })->Args({ 4, 6 });
+
+BENCHMARK_MAIN();
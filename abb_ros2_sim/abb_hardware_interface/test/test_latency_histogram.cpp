@@ -0,0 +1,67 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_hardware_interface/latency_histogram.hpp>
+
+#include <cstdint>
+
+using abb_hardware_interface::LatencyHistogram;
+
+TEST(LatencyHistogram, BucketsCoverValues)
+{
+  const std::size_t bucket_count = LatencyHistogram::BUCKET_COUNT;
+  for (std::uint64_t value = 0; value < (std::uint64_t{ 1 } << 20); value += 7)
+  {
+    const std::size_t index = LatencyHistogram::bucketIndex(value);
+    ASSERT_LT(index, bucket_count);
+    ASSERT_LE(value, LatencyHistogram::bucketUpperBound(index));
+    if (index > 0)
+    {
+      ASSERT_GT(value, LatencyHistogram::bucketUpperBound(index - 1));
+    }
+  }
+  EXPECT_EQ(LatencyHistogram::bucketIndex(UINT64_MAX), bucket_count - 1);
+}
+
+TEST(LatencyHistogram, RelativeErrorIsBounded)
+{
+  for (std::uint64_t value = 32; value < (std::uint64_t{ 1 } << 36); value = value * 3 / 2)
+  {
+    const double upper = static_cast<double>(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(value)));
+    EXPECT_LE((upper - static_cast<double>(value)) / static_cast<double>(value), 1.0 / 32.0);
+  }
+}
+
+TEST(LatencyHistogram, Summary)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.summarize().count, 0u);
+
+  // 4 ms cycles, with 1 in 100 at 8 ms.
+  for (int i = 0; i < 1000; ++i)
+  {
+    histogram.record(i % 100 == 0 ? 8000000 : 4000000);
+  }
+
+  const LatencyHistogram::Summary summary = histogram.summarize();
+  EXPECT_EQ(summary.count, 1000u);
+  EXPECT_EQ(summary.min, 4000000);
+  EXPECT_EQ(summary.max, 8000000);
+  EXPECT_NEAR(summary.mean, 4040000.0, 1.0);
+  EXPECT_NEAR(summary.p50, 4000000, 4000000 / 32);
+  EXPECT_NEAR(summary.p90, 4000000, 4000000 / 32);
+  EXPECT_NEAR(summary.p999, 8000000, 8000000 / 32);
+}
@@ -0,0 +1,156 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_hardware_interface/state_bridge.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using abb_hardware_interface::GroupJointBuffers;
+using abb_hardware_interface::StateBridgeReader;
+using abb_hardware_interface::StateBridgeSample;
+using abb_hardware_interface::StateBridgeWriter;
+
+namespace
+{
+std::string segmentName()
+{
+  return "test_state_bridge_" + std::to_string(getpid());
+}
+
+GroupJointBuffers makeGroup(const std::string& name, const std::size_t num_joints)
+{
+  GroupJointBuffers group;
+  group.name = name;
+  for (std::size_t i = 0; i < num_joints; ++i)
+  {
+    group.joint_names.push_back("joint_" + std::to_string(i + 1));
+  }
+  group.positions.assign(num_joints, 0.0);
+  group.velocities.assign(num_joints, 0.0);
+  return group;
+}
+}  // namespace
+
+TEST(StateBridge, PublishesJointStates)
+{
+  const std::string name = segmentName();
+  std::vector<GroupJointBuffers> groups{ makeGroup("ROB_1", 6), makeGroup("ROB_2", 2) };
+  StateBridgeWriter writer{ name, groups };
+  StateBridgeReader reader{ name };
+
+  std::uint32_t generation = 0;
+  const auto names = reader.jointNames(generation);
+  ASSERT_EQ(names.size(), 8u);
+  EXPECT_EQ(names[0], "ROB_1/joint_1");
+  EXPECT_EQ(names[7], "ROB_2/joint_2");
+
+  StateBridgeSample sample;
+  EXPECT_FALSE(reader.read(sample));
+
+  groups[0].positions[2] = 1.5;
+  groups[1].velocities[1] = -0.5;
+  writer.publish(groups, 42);
+  ASSERT_TRUE(reader.read(sample));
+  EXPECT_EQ(sample.generation, generation);
+  EXPECT_EQ(sample.stamp_ns, 42);
+  EXPECT_EQ(sample.cycle, 1u);
+  ASSERT_EQ(sample.positions.size(), 8u);
+  EXPECT_DOUBLE_EQ(sample.positions[2], 1.5);
+  EXPECT_DOUBLE_EQ(sample.velocities[7], -0.5);
+  shm_unlink(("/" + name).c_str());
+}
+
+TEST(StateBridge, NewWriterChangesGeneration)
+{
+  const std::string name = segmentName();
+  std::vector<GroupJointBuffers> groups{ makeGroup("ROB_1", 6) };
+  auto writer = std::make_unique<StateBridgeWriter>(name, groups);
+  writer->publish(groups, 1);
+
+  StateBridgeReader reader{ name };
+  StateBridgeSample sample;
+  ASSERT_TRUE(reader.read(sample));
+  const std::uint32_t first_generation = sample.generation;
+
+  // The segment outlives its writer, and is taken over by the next one
+  writer.reset();
+  ASSERT_TRUE(reader.read(sample));
+  groups.push_back(makeGroup("ROB_2", 1));
+  writer = std::make_unique<StateBridgeWriter>(name, groups);
+  EXPECT_FALSE(reader.read(sample));
+
+  writer->publish(groups, 2);
+  ASSERT_TRUE(reader.read(sample));
+  EXPECT_NE(sample.generation, first_generation);
+  EXPECT_EQ(sample.positions.size(), 7u);
+  std::uint32_t generation = 0;
+  EXPECT_EQ(reader.jointNames(generation).back(), "ROB_2/joint_1");
+  EXPECT_EQ(generation, sample.generation);
+  shm_unlink(("/" + name).c_str());
+}
+
+TEST(StateBridge, ReadsAreConsistent)
+{
+  const std::string name = segmentName();
+  std::vector<GroupJointBuffers> groups{ makeGroup("ROB_1", 12) };
+  StateBridgeWriter writer{ name, groups };
+  StateBridgeReader reader{ name };
+
+  std::atomic<bool> running{ true };
+  std::thread publisher{ [&]() {
+    for (std::int64_t i = 1; running; ++i)
+    {
+      groups[0].positions.assign(12, static_cast<double>(i));
+      writer.publish(groups, i);
+    }
+  } };
+
+  // Every accepted state has the same value for all joints, i.e. it was not torn by a concurrent write
+  StateBridgeSample sample;
+  int complete = 0;
+  int torn = 0;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (complete < 10000 && std::chrono::steady_clock::now() < deadline)
+  {
+    if (reader.read(sample))
+    {
+      ++complete;
+      for (const double position : sample.positions)
+      {
+        torn += position != static_cast<double>(sample.stamp_ns) ? 1 : 0;
+      }
+    }
+  }
+  running = false;
+  publisher.join();
+  EXPECT_EQ(complete, 10000);
+  EXPECT_EQ(torn, 0);
+  shm_unlink(("/" + name).c_str());
+}
+
+TEST(StateBridge, RejectsMissingSegments)
+{
+  EXPECT_THROW(StateBridgeReader{ "test_state_bridge_missing" }, std::runtime_error);
+}
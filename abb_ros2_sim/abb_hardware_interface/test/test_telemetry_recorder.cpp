@@ -0,0 +1,134 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_hardware_interface/telemetry_recorder.hpp>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using abb_hardware_interface::TelemetryGroup;
+using abb_hardware_interface::TelemetryKind;
+using abb_hardware_interface::TelemetryReader;
+using abb_hardware_interface::TelemetryRecorder;
+using abb_hardware_interface::TelemetrySample;
+using abb_hardware_interface::TelemetrySource;
+
+namespace
+{
+std::string temporaryPath()
+{
+  return "/tmp/test_telemetry_recorder_" + std::to_string(getpid()) + ".bin";
+}
+
+std::vector<TelemetryGroup> makeGroups()
+{
+  TelemetryGroup group{};
+  std::snprintf(group.name, sizeof(group.name), "rob1");
+  group.num_joints = 7;
+  group.num_robot_joints = 6;
+  group.linear_mask = 1u << 6;
+  return { group };
+}
+}  // namespace
+
+TEST(TelemetryRecorder, RecordsAreReadBack)
+{
+  const std::string path = temporaryPath();
+  {
+    TelemetryRecorder recorder{ path, 16, TelemetrySource::HARDWARE_INTERFACE, makeGroups() };
+    for (int i = 0; i < 5; ++i)
+    {
+      const double positions[7] = { 0.1 * i, 1.0, 2.0, 3.0, 4.0, 5.0, 0.5 };
+      const double velocities[7] = { 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0 };
+      recorder.append(i % 2 ? TelemetryKind::COMMAND : TelemetryKind::FEEDBACK, 0, 7, positions, velocities);
+    }
+    EXPECT_EQ(recorder.written(), 5u);
+  }
+
+  TelemetryReader reader{ path };
+  EXPECT_EQ(reader.source(), TelemetrySource::HARDWARE_INTERFACE);
+  EXPECT_EQ(reader.header().num_groups, 1u);
+  EXPECT_STREQ(reader.header().groups[0].name, "rob1");
+  EXPECT_EQ(reader.header().groups[0].linear_mask, 1u << 6);
+  EXPECT_EQ(reader.written(), 5u);
+  EXPECT_EQ(reader.oldest(), 0u);
+
+  TelemetrySample sample;
+  std::int64_t previous_stamp = 0;
+  for (std::uint64_t i = 0; i < 5; ++i)
+  {
+    ASSERT_TRUE(reader.read(i, sample));
+    EXPECT_EQ(sample.kind, i % 2 ? TelemetryKind::COMMAND : TelemetryKind::FEEDBACK);
+    EXPECT_EQ(sample.num_values, 7u);
+    EXPECT_DOUBLE_EQ(sample.positions[0], 0.1 * static_cast<double>(i));
+    EXPECT_DOUBLE_EQ(sample.velocities[6], -1.0);
+    EXPECT_GE(sample.stamp_ns, previous_stamp);
+    previous_stamp = sample.stamp_ns;
+  }
+  EXPECT_FALSE(reader.read(5, sample));
+  std::remove(path.c_str());
+}
+
+TEST(TelemetryRecorder, RingKeepsNewestRecords)
+{
+  const std::string path = temporaryPath();
+  TelemetryRecorder recorder{ path, 4, TelemetrySource::HARDWARE_INTERFACE, makeGroups() };
+  TelemetryReader reader{ path };
+  for (int i = 0; i < 10; ++i)
+  {
+    const double position = i;
+    recorder.append(TelemetryKind::FEEDBACK, 0, 1, &position, nullptr);
+  }
+
+  // The reader sees the records while they are written
+  EXPECT_EQ(reader.written(), 10u);
+  EXPECT_EQ(reader.oldest(), 6u);
+  TelemetrySample sample;
+  EXPECT_FALSE(reader.read(5, sample));
+  for (std::uint64_t i = 6; i < 10; ++i)
+  {
+    ASSERT_TRUE(reader.read(i, sample));
+    EXPECT_DOUBLE_EQ(sample.positions[0], static_cast<double>(i));
+    EXPECT_DOUBLE_EQ(sample.velocities[0], 0.0);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(TelemetryRecorder, RejectsOverflowingCapacity)
+{
+  const std::string path = temporaryPath();
+  EXPECT_THROW((TelemetryRecorder{ path, 0, TelemetrySource::HARDWARE_INTERFACE, makeGroups() }), std::runtime_error);
+  EXPECT_THROW((TelemetryRecorder{ path, UINT64_MAX / 2, TelemetrySource::HARDWARE_INTERFACE, makeGroups() }),
+               std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(TelemetryRecorder, RejectsOtherFiles)
+{
+  const std::string path = temporaryPath();
+  {
+    std::ofstream file{ path };
+    file << std::string(8192, 'x');
+  }
+  EXPECT_THROW(TelemetryReader{ path }, std::runtime_error);
+  std::remove(path.c_str());
+  EXPECT_THROW(TelemetryReader{ path }, std::runtime_error);
+}
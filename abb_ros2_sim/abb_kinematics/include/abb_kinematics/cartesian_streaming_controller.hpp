@@ -0,0 +1,92 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_kinematics/dls_solver.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <controller_interface/controller_interface.hpp>
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <geometry_msgs/msg/twist_stamped.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp>
+#include <realtime_tools/realtime_buffer.h>
+
+namespace abb_kinematics
+{
+using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
+
+/**
+ * \brief Streams Cartesian velocity or pose targets of tool0 to the joint position and velocity commands.
+ *
+ * Targets arrive on ~/twist and ~/pose, in base_link, and every update integrates the latest one with a DLSSolver
+ * step. The solver starts from the measured positions on activation and then keeps its own command, so the commands
+ * stay smooth between the targets. A twist that is older than command_timeout is dropped and the arm holds its
+ * position, while a pose is tracked until a newer target replaces it.
+ */
+class CartesianStreamingController : public controller_interface::ControllerInterface
+{
+public:
+  CartesianStreamingController() = default;
+
+  CallbackReturn on_init() override;
+
+  controller_interface::InterfaceConfiguration command_interface_configuration() const override;
+
+  controller_interface::InterfaceConfiguration state_interface_configuration() const override;
+
+  CallbackReturn on_configure(const rclcpp_lifecycle::State& previous_state) override;
+
+  CallbackReturn on_activate(const rclcpp_lifecycle::State& previous_state) override;
+
+  CallbackReturn on_deactivate(const rclcpp_lifecycle::State& previous_state) override;
+
+  controller_interface::return_type update(const rclcpp::Time& time, const rclcpp::Duration& period) override;
+
+private:
+  /**
+   * \brief Latest target, written by the subscriptions and read by update().
+   */
+  struct Target
+  {
+    bool is_pose = false;
+    double twist[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    FixedHomogTransf pose;
+    rclcpp::Time received;
+  };
+
+  void twistCallback(const geometry_msgs::msg::TwistStamped::SharedPtr message);
+  void poseCallback(const geometry_msgs::msg::PoseStamped::SharedPtr message);
+
+  std::vector<std::string> joint_names_;
+  std::unique_ptr<Kinematics> kinematics_;
+  std::unique_ptr<DLSSolver> solver_;
+  rclcpp::Duration command_timeout_{ 0, 0 };
+
+  /**
+   * \brief Indices of the loaned interfaces of each joint, in the order of joint_names_.
+   */
+  std::vector<std::size_t> position_commands_;
+  std::vector<std::size_t> velocity_commands_;
+  std::vector<std::size_t> position_states_;
+
+  realtime_tools::RealtimeBuffer<std::shared_ptr<Target>> target_;
+  rclcpp::Subscription<geometry_msgs::msg::TwistStamped>::SharedPtr twist_subscription_;
+  rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr pose_subscription_;
+};
+}  // namespace abb_kinematics
@@ -0,0 +1,121 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_kinematics/matvec/matVec.h>
+
+#include <abb_kinematics/kinematics.hpp>
+
+namespace abb_kinematics
+{
+/**
+ * \brief Integrates Cartesian velocity or pose targets into joint commands with damped least squares steps.
+ *
+ * Each step decomposes the Jacobian at the last command with Mat::SVD, and damps the inverse of the singular values
+ * below a threshold, so that the joint velocities stay bounded near singularities. The joint velocities are then
+ * scaled down to the velocity limits, and the positions clamped to the position limits.
+ *
+ * The solver keeps the last command between steps (the warm start), and all of its matrices are allocated once, so a
+ * step does not allocate. It is not thread safe.
+ */
+class DLSSolver
+{
+public:
+  struct Parameters
+  {
+    /**
+     * \brief Damping [m] at a singularity.
+     */
+    double damping = 0.02;
+
+    /**
+     * \brief Singular value below which the damping starts.
+     */
+    double singular_threshold = 0.05;
+
+    /**
+     * \brief Gains [1/s] of the pose targets, from the position and orientation errors to the velocity.
+     */
+    double linear_gain = 5.0;
+    double angular_gain = 5.0;
+
+    /**
+     * \brief Velocity limits of tool0 [m/s, rad/s] for the pose targets.
+     */
+    double max_linear_velocity = 0.25;
+    double max_angular_velocity = 1.0;
+  };
+
+  DLSSolver(const Kinematics& kinematics, const Parameters& parameters);
+
+  /**
+   * \brief Restarts from joint positions, e.g. the measured ones.
+   */
+  void reset(const JointVector& joints);
+
+  /**
+   * \brief Steps towards a velocity of tool0.
+   *
+   * \param twist linear [m/s] and angular [rad/s] velocity of tool0 in base_link.
+   * \param dt duration [s] of the step.
+   *
+   * \return the joint velocities [rad/s] of the step. The new positions are in joints().
+   */
+  const JointVector& velocityStep(const double twist[6], double dt);
+
+  /**
+   * \brief Steps towards a pose of tool0, at most at the velocity limits of the parameters.
+   *
+   * \param target pose of tool0 in base_link.
+   * \param dt duration [s] of the step.
+   *
+   * \return the joint velocities [rad/s] of the step. The new positions are in joints().
+   */
+  const JointVector& poseStep(const FixedHomogTransf& target, double dt);
+
+  /**
+   * \brief Joint positions after the last step.
+   */
+  const JointVector& joints() const { return joints_; }
+
+  /**
+   * \brief Pose of tool0 at the start of the last step.
+   */
+  const FixedHomogTransf& pose() const { return pose_; }
+
+  /**
+   * \brief Smallest singular value of the Jacobian in the last step.
+   */
+  double minSingularValue() const { return min_singular_value_; }
+
+private:
+  const Kinematics& kinematics_;
+  Parameters parameters_;
+
+  JointVector joints_;
+  JointVector velocities_;
+  FixedHomogTransf pose_;
+  double min_singular_value_;
+
+  /**
+   * \brief Jacobian and its decomposition J = U diag(sigma) V^T.
+   */
+  FixedMat<6, 6> fixed_jacobian_;
+  Mat jacobian_;
+  Mat u_;
+  Vec sigma_;
+  Mat v_;
+};
+}  // namespace abb_kinematics
@@ -0,0 +1,165 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_kinematics/matvec/matVec.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <abb_kinematics/robot_model.hpp>
+
+namespace abb_kinematics
+{
+/**
+ * \brief Closed-form forward and inverse kinematics of a six axis ABB arm, from base_link to tool0.
+ *
+ * The inverse kinematics solves the arm for the wrist center and the spherical wrist for the orientation, which gives
+ * up to eight solutions (front/back, elbow up/down, wrist flip). Only the solutions within the joint limits are
+ * returned. Joints with a range of more than one turn take the equivalent position closest to a seed.
+ *
+ * All methods are const and allocation free, so one instance can be shared between threads.
+ */
+class Kinematics
+{
+public:
+  static constexpr std::size_t MAX_SOLUTIONS = 8;
+
+  /**
+   * \brief Solutions of the inverse kinematics for one pose.
+   */
+  struct Solutions
+  {
+    std::array<JointVector, MAX_SOLUTIONS> joints;
+    std::size_t count = 0;
+  };
+
+  /**
+   * \brief Creates the kinematics of a robot model.
+   *
+   * \param model of the robot. It must outlive the kinematics (the generated models are static).
+   */
+  explicit Kinematics(const RobotModel& model);
+
+  const RobotModel& model() const { return model_; }
+
+  /**
+   * \brief Computes the pose of tool0 in base_link.
+   */
+  FixedHomogTransf forward(const JointVector& joints) const;
+
+  /**
+   * \brief Computes the poses of tool0 for an array of joint positions.
+   *
+   * \param joints positions, count entries.
+   * \param count of joint positions.
+   * \param poses [out] receives count poses.
+   */
+  void forward(const JointVector* joints, std::size_t count, FixedHomogTransf* poses) const;
+
+  /**
+   * \brief Computes the geometric Jacobian of tool0 in base_link.
+   *
+   * \param joints positions.
+   * \param jacobian [out] maps the joint velocities to the linear (rows 0-2) and angular (rows 3-5) velocity of tool0.
+   *
+   * \return the pose of tool0, as forward() would.
+   */
+  FixedHomogTransf jacobian(const JointVector& joints, FixedMat<6, 6>& jacobian) const;
+
+  /**
+   * \brief Computes every solution that reaches a pose of tool0 within the joint limits.
+   *
+   * \param pose of tool0 in base_link.
+   * \param solutions [out] receives the solutions. Joints with a range of more than one turn are taken in
+   * (-pi, pi] when possible.
+   *
+   * \return the number of solutions (0 if the pose is out of reach or every solution is outside the limits).
+   */
+  std::size_t inverse(const FixedHomogTransf& pose, Solutions& solutions) const;
+
+  /**
+   * \brief Computes the solution closest to a seed that reaches a pose of tool0 within the joint limits.
+   *
+   * \param pose of tool0 in base_link.
+   * \param seed positions, usually the current ones. They also resolve the singular configurations.
+   * \param joints [out] receives the solution.
+   *
+   * \return true if there is a solution.
+   */
+  bool inverse(const FixedHomogTransf& pose, const JointVector& seed, JointVector& joints) const;
+
+  /**
+   * \brief Computes the solutions along an array of poses of tool0.
+   *
+   * Each pose takes the solution closest to the one of the previous pose (or the seed), so that a path of poses
+   * gives continuous joint positions. An unreachable pose does not move the seed.
+   *
+   * \param poses of tool0 in base_link, count entries.
+   * \param count of poses.
+   * \param seed positions for the first pose.
+   * \param joints [out] receives count solutions. Unreachable poses get the solution of the previous pose.
+   * \param solved [out] receives count flags, set to 1 where there is a solution.
+   *
+   * \return the number of poses with a solution.
+   */
+  std::size_t inverse(const FixedHomogTransf* poses, std::size_t count, const JointVector& seed, JointVector* joints,
+                      std::uint8_t* solved) const;
+
+  /**
+   * \brief Checks joint positions against the joint limits.
+   */
+  bool withinLimits(const JointVector& joints) const;
+
+private:
+  /**
+   * \brief Computes the raw solutions for a pose, before the joint limits.
+   *
+   * \param seed positions for the singular configurations, or nullptr to use zeros.
+   */
+  std::size_t solve(const FixedHomogTransf& pose, const JointVector* seed,
+                    std::array<JointVector, MAX_SOLUTIONS>& solutions) const;
+
+  /**
+   * \brief Moves each joint to the equivalent position (modulo one turn) within the limits, closest to the seed.
+   *
+   * \return false if there is no such position for some joint.
+   */
+  bool applyLimits(JointVector& joints, const JointVector* seed) const;
+
+  const RobotModel& model_;
+
+  /**
+   * \brief Joint origins, and the transform from link_6 to tool0.
+   */
+  std::array<Vec3, NUM_JOINTS> origins_;
+  FixedHomogTransf tool_;
+
+  /**
+   * \brief Geometry of the arm in its plane: shoulder position relative to the base, upper arm from joint_2 to
+   * joint_3, forearm from joint_3 to the wrist center, and the wrist center to tool0.
+   */
+  double base_x_;
+  double base_height_;
+  double shoulder_x_;
+  double shoulder_z_;
+  double upper_arm_x_;
+  double upper_arm_z_;
+  double forearm_x_;
+  double forearm_z_;
+  double wrist_length_;
+};
+}  // namespace abb_kinematics
@@ -0,0 +1,90 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/pose_stamped.hpp>
+#include <sensor_msgs/msg/joint_state.hpp>
+
+#include <abb_kinematics_msgs/srv/compute_fk.hpp>
+#include <abb_kinematics_msgs/srv/compute_ik.hpp>
+
+#include <abb_kinematics/kinematics.hpp>
+
+namespace abb_kinematics
+{
+/**
+ * \brief ROS 2 interface to the kinematics of one robot model.
+ *
+ * Provides batch forward and inverse kinematics services, and streams the inverse kinematics of target poses as
+ * joint commands. The solutions are seeded with the last one, or with the latest joint states.
+ *
+ * The callbacks share the seed and the buffers, so the node must be spun by a single threaded executor.
+ */
+class KinematicsServer
+{
+public:
+  /**
+   * \brief Creates the services and topics.
+   *
+   * \param node ROS 2 node. Its "robot_model" parameter selects the model (see robotModelNames()), and "prefix" the
+   * prefix of the joint names.
+   *
+   * \throw std::runtime_error if the robot model is unknown.
+   */
+  explicit KinematicsServer(const rclcpp::Node::SharedPtr& node);
+
+private:
+  void computeFK(const abb_kinematics_msgs::srv::ComputeFK::Request::SharedPtr request,
+                 abb_kinematics_msgs::srv::ComputeFK::Response::SharedPtr response);
+
+  void computeIK(const abb_kinematics_msgs::srv::ComputeIK::Request::SharedPtr request,
+                 abb_kinematics_msgs::srv::ComputeIK::Response::SharedPtr response);
+
+  void targetPoseCallback(const geometry_msgs::msg::PoseStamped::SharedPtr message);
+
+  void jointStateCallback(const sensor_msgs::msg::JointState::SharedPtr message);
+
+  rclcpp::Node::SharedPtr node_;
+  Kinematics kinematics_;
+
+  std::vector<std::string> joint_names_;
+
+  /**
+   * \brief Seed of the next inverse kinematics: the last solution, or the latest joint states.
+   */
+  JointVector seed_;
+
+  /**
+   * \brief Buffers of the batch services, reused between requests.
+   */
+  std::vector<JointVector> joints_;
+  std::vector<FixedHomogTransf> poses_;
+  std::vector<std::uint8_t> solved_;
+
+  sensor_msgs::msg::JointState joint_command_;
+
+  rclcpp::Service<abb_kinematics_msgs::srv::ComputeFK>::SharedPtr compute_fk_service_;
+  rclcpp::Service<abb_kinematics_msgs::srv::ComputeIK>::SharedPtr compute_ik_service_;
+  rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr target_pose_subscription_;
+  rclcpp::Subscription<sensor_msgs::msg::JointState>::SharedPtr joint_state_subscription_;
+  rclcpp::Publisher<sensor_msgs::msg::JointState>::SharedPtr joint_command_publisher_;
+};
+}  // namespace abb_kinematics
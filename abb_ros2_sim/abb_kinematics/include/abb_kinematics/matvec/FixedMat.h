@@ -0,0 +1,388 @@
+#if !defined(FIXEDMAT_INCLUDED)
+#define FIXEDMAT_INCLUDED
+
+#include <math.h>
+
+// Fixed-size versions of Vec, Mat, Quaternion, RotMat and HomogTransf.
+// The dimensions are template parameters and the values are stored in the
+// object, so that temporaries need no heap allocation and the small
+// products can be inlined. They have the same operators as the dynamic
+// classes, which remain for general-size algebra, and convert to and from
+// them. Include after the dynamic classes (as matVec.h does).
+
+template <int N>
+class FixedVec
+{
+public:
+	double v[N];
+
+	//Constructors
+	FixedVec() {}
+	explicit FixedVec(const double constant) {for(int i=0;i<N;i++) v[i]=constant;}
+	explicit FixedVec(double const *values) {for(int i=0;i<N;i++) v[i]=values[i];}
+	explicit FixedVec(const Vec &original) {for(int i=0;i<N;i++) v[i]=original[i];}
+
+	//Conversion to the dynamic class
+	Vec toVec() const {return Vec(v,N);}
+	int size() const {return N;}
+
+	// Operators
+	double & operator[](const int i) {return v[i];}
+	const double & operator[](const int i) const {return v[i];}
+	FixedVec & operator = (const double constant) {for(int i=0;i<N;i++) v[i]=constant; return *this;}
+	FixedVec & operator +=(const FixedVec &original) {for(int i=0;i<N;i++) v[i]+=original.v[i]; return *this;}
+	FixedVec & operator -=(const FixedVec &original) {for(int i=0;i<N;i++) v[i]-=original.v[i]; return *this;}
+	FixedVec & operator *=(const double constant) {for(int i=0;i<N;i++) v[i]*=constant; return *this;}
+	FixedVec & operator /=(const double constant) {for(int i=0;i<N;i++) v[i]/=constant; return *this;}
+	FixedVec operator +(const FixedVec &original) const {FixedVec w(*this); return w+=original;}
+	FixedVec operator -(const FixedVec &original) const {FixedVec w(*this); return w-=original;}
+	FixedVec operator -() const {FixedVec w; for(int i=0;i<N;i++) w.v[i]=-v[i]; return w;}
+	double operator *(const FixedVec &original) const // Dot product.
+	{
+		double e=0;
+		for(int i=0;i<N;i++) e+=v[i]*original.v[i];
+		return e;
+	}
+	FixedVec operator *(const double constant) const {FixedVec w(*this); return w*=constant;}
+	FixedVec operator /(const double constant) const {FixedVec w(*this); return w/=constant;}
+	FixedVec operator +(const double constant) const {FixedVec w; for(int i=0;i<N;i++) w.v[i]=v[i]+constant; return w;}
+	FixedVec operator -(const double constant) const {FixedVec w; for(int i=0;i<N;i++) w.v[i]=v[i]-constant; return w;}
+	FixedVec operator ^(const FixedVec &original) const //Cross Product. Only for 3-vectors
+	{
+		FixedVec w(0.0);
+		w.v[0]=v[1]*original.v[2]-v[2]*original.v[1];
+		w.v[1]=v[2]*original.v[0]-v[0]*original.v[2];
+		w.v[2]=v[0]*original.v[1]-v[1]*original.v[0];
+		return w;
+	}
+
+	//Linear Algebra
+	double norm() const {return sqrt((*this)*(*this));}
+	void normalize() {double n=norm(); if(n!=0) *this/=n;}
+};
+
+typedef FixedVec<3> Vec3;
+
+template <int N, int M>
+class FixedMat
+{
+public:
+	double v[N][M];
+
+	// Constructors.
+	FixedMat() {}
+	explicit FixedMat(const double constant) {*this=constant;}
+	explicit FixedMat(double const *values) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]=values[i*M+j];}
+	explicit FixedMat(const Mat &original) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]=original[i][j];}
+
+	//Conversion to the dynamic class
+	Mat toMat() const {return Mat(&v[0][0],N,M);}
+
+	//Operators
+	double* operator[](const int i) {return v[i];}
+	const double* operator[](const int i) const {return v[i];}
+	FixedMat& operator=(const double constant) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]=constant; return *this;}
+	FixedMat& operator+=(const FixedMat &original) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]+=original.v[i][j]; return *this;}
+	FixedMat& operator-=(const FixedMat &original) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]-=original.v[i][j]; return *this;}
+	FixedMat& operator*=(const double constant) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]*=constant; return *this;}
+	FixedMat& operator/=(const double constant) {for(int i=0;i<N;i++) for(int j=0;j<M;j++) v[i][j]/=constant; return *this;}
+	FixedMat operator +(const FixedMat &original) const {FixedMat w(*this); return w+=original;}
+	FixedMat operator -(const FixedMat &original) const {FixedMat w(*this); return w-=original;}
+	FixedMat operator -() const {FixedMat w(*this); return w*=-1.0;}
+	FixedMat operator *(const double constant) const {FixedMat w(*this); return w*=constant;}
+	FixedMat operator /(const double constant) const {FixedMat w(*this); return w/=constant;}
+	template <int P>
+	FixedMat<N,P> operator *(const FixedMat<M,P> &original) const
+	{
+		FixedMat<N,P> w(0.0);
+		for(int i=0;i<N;i++)
+			for(int k=0;k<M;k++)
+				for(int j=0;j<P;j++) w.v[i][j]+=v[i][k]*original.v[k][j];
+		return w;
+	}
+	FixedVec<N> operator *(const FixedVec<M> &original) const
+	{
+		FixedVec<N> w(0.0);
+		for(int i=0;i<N;i++)
+			for(int j=0;j<M;j++) w[i]+=v[i][j]*original[j];
+		return w;
+	}
+
+	//Linear Algebra
+	FixedMat<M,N> transp() const
+	{
+		FixedMat<M,N> w;
+		for(int i=0;i<N;i++) for(int j=0;j<M;j++) w.v[j][i]=v[i][j];
+		return w;
+	}
+	FixedVec<M> getRow(const int n) const {return FixedVec<M>(v[n]);}
+	FixedVec<N> getCol(const int m) const {FixedVec<N> w; for(int i=0;i<N;i++) w[i]=v[i][m]; return w;}
+	void setRow(const int n, const FixedVec<M> &row) {for(int j=0;j<M;j++) v[n][j]=row[j];}
+	void setCol(const int m, const FixedVec<N> &col) {for(int i=0;i<N;i++) v[i][m]=col[i];}
+};
+
+class FixedRotMat;
+
+class FixedQuaternion: public FixedVec<4>
+{
+public:
+	//Constructors
+	FixedQuaternion() {v[0]=1.0; v[1]=0.0; v[2]=0.0; v[3]=0.0;}	//Null rotation
+	FixedQuaternion(const double q0, const double qx, const double qy, const double qz) {v[0]=q0; v[1]=qx; v[2]=qy; v[3]=qz;}
+	FixedQuaternion(const double q0, const Vec3 &vector) {v[0]=q0; v[1]=vector[0]; v[2]=vector[1]; v[3]=vector[2];}
+	explicit FixedQuaternion(double const *values) : FixedVec<4>(values) {}
+	explicit FixedQuaternion(const Vec &original) : FixedVec<4>(original) {}
+	FixedQuaternion(const FixedVec<4> &original) : FixedVec<4>(original) {}	// Conversion constructor
+
+	//Conversion to the dynamic class
+	Quaternion toQuaternion() const {return Quaternion(v);}
+
+	//Operators
+	//(Explicitely Inherited for preserving the output class label)
+	FixedQuaternion operator +(const FixedQuaternion &original) const {return FixedVec<4>::operator+(original);}
+	FixedQuaternion operator -(const FixedQuaternion &original) const {return FixedVec<4>::operator-(original);}
+	FixedQuaternion operator -() const {return FixedVec<4>::operator-();}
+	FixedQuaternion operator *(const double constant) const {return FixedVec<4>::operator*(constant);}
+	FixedQuaternion operator /(const double constant) const {return FixedVec<4>::operator/(constant);}
+	double operator *(const FixedQuaternion &original) const {return FixedVec<4>::operator*(original);}
+	//(New)
+	FixedQuaternion operator ^(const FixedQuaternion &original) const // Quaternion product.
+	{
+		return FixedQuaternion(
+			v[0]*original[0] - v[1]*original[1] - v[2]*original[2] - v[3]*original[3],
+			v[0]*original[1] + v[1]*original[0] + v[2]*original[3] - v[3]*original[2],
+			v[0]*original[2] - v[1]*original[3] + v[2]*original[0] + v[3]*original[1],
+			v[0]*original[3] + v[1]*original[2] - v[2]*original[1] + v[3]*original[0]);
+	}
+
+	//Quaternion Algebra
+	FixedQuaternion conjugate() const {return FixedQuaternion(v[0],-v[1],-v[2],-v[3]);}
+	FixedQuaternion inverse() const
+	{
+		double n=(*this)*(*this);
+		if (n!=0)
+			return conjugate()/n;
+		else
+			return FixedQuaternion(0.0,0.0,0.0,0.0);
+	}
+	double getScalar() const {return v[0];}
+	Vec3 getVector() const {return Vec3(v+1);}
+	void setScalar(const double s) {v[0]=s;}
+	void setVector(const Vec3 &vector) {v[1]=vector[0]; v[2]=vector[1]; v[3]=vector[2];}
+
+	//Transformation
+	double getAngle() const
+	{
+		double a=2*atan2(getVector().norm(),getScalar());
+		if (a>PI)
+			a=2*PI-a;
+		return a;
+	}
+	Vec3 getAxis() const
+	{
+		Vec3 w=getVector();
+		double n=w.norm();
+		if (n!=0)
+			return w/n;
+		else
+			return Vec3(0.0);
+	}
+	FixedRotMat getRotMat() const;
+};
+
+class FixedRotMat: public FixedMat<3,3>
+{
+public:
+	// Constructors
+	FixedRotMat() : FixedMat<3,3>(0.0) {for(int i=0;i<3;i++) v[i][i]=1.0;}	// Null rotation.
+	explicit FixedRotMat(double const *values) : FixedMat<3,3>(values) {}
+	explicit FixedRotMat(const Mat &original) : FixedMat<3,3>(original) {}
+	FixedRotMat(const Vec3 &X, const Vec3 &Y, const Vec3 &Z) {setRefFrame(X,Y,Z);}
+	FixedRotMat(const FixedMat<3,3> &original) : FixedMat<3,3>(original) {}	// Conversion constructor.
+
+	//Conversion to the dynamic class
+	RotMat toRotMat() const {return RotMat(&v[0][0]);}
+
+	//Operators
+	//(Explicitely Inherited for preserving the output class label)
+	FixedRotMat operator +(const FixedRotMat &original) const {return FixedMat<3,3>::operator+(original);}
+	FixedRotMat operator -(const FixedRotMat &original) const {return FixedMat<3,3>::operator-(original);}
+	FixedRotMat operator *(const FixedRotMat &original) const {return FixedMat<3,3>::operator*(original);}
+	Vec3 operator *(const Vec3 &original) const {return FixedMat<3,3>::operator*(original);}
+	FixedRotMat operator *(const double constant) const {return FixedMat<3,3>::operator*(constant);}
+	FixedRotMat operator /(const double constant) const {return FixedMat<3,3>::operator/(constant);}
+
+	void setRefFrame(const Vec3 &X, const Vec3 &Y, const Vec3 &Z) {setCol(0,X); setCol(1,Y); setCol(2,Z);}
+
+	void rotX(const double alfa)
+	{
+		*this=FixedRotMat();
+		v[1][1]=cos(alfa); v[1][2]=-sin(alfa);
+		v[2][1]=sin(alfa); v[2][2]=cos(alfa);
+	}
+	void rotY(const double alfa)
+	{
+		*this=FixedRotMat();
+		v[0][0]=cos(alfa); v[0][2]=sin(alfa);
+		v[2][0]=-sin(alfa); v[2][2]=cos(alfa);
+	}
+	void rotZ(const double alfa)
+	{
+		*this=FixedRotMat();
+		v[0][0]=cos(alfa); v[0][1]=-sin(alfa);
+		v[1][0]=sin(alfa); v[1][1]=cos(alfa);
+	}
+	void setAxisAngle(const Vec3 &vector, const double alfa)
+	{
+		Vec3 auxvec=vector;
+		auxvec.normalize();
+
+		double c,s,t1,t2;
+		c = cos(alfa);
+		s = sin(alfa);
+		t1 = 1-c;
+		t2 = auxvec[0]*t1;
+
+		v[0][0]=t2*auxvec[0] + c;
+		v[1][0]=t2*auxvec[1] + auxvec[2]*s;
+		v[2][0]=t2*auxvec[2] - auxvec[1]*s;
+		v[0][1]=t2*auxvec[1] - auxvec[2]*s;
+		v[1][1]=auxvec[1]*auxvec[1]*t1 + c;
+		v[2][1]=auxvec[1]*auxvec[2]*t1 + auxvec[0]*s;
+		v[0][2]=t2*auxvec[2] + auxvec[1]*s;
+		v[1][2]=auxvec[1]*auxvec[2]*t1 - auxvec[0]*s;
+		v[2][2]=auxvec[2]*auxvec[2]*t1 + c;
+	}
+
+	//Transformations
+	double getAngle() const {return(acos((v[0][0]+v[1][1]+v[2][2]-1)/2));}
+	FixedQuaternion getQuaternion() const
+	{
+		FixedQuaternion q;
+		double t0 = 1.0 + v[0][0] + v[1][1] + v[2][2];
+		double t1 = 1.0 + v[0][0] - v[1][1] - v[2][2];
+		double t2 = 1.0 - v[0][0] + v[1][1] - v[2][2];
+		double t3 = 1.0 - v[0][0] - v[1][1] + v[2][2];
+
+		if (t0 >= t1 && t0 >= t2 && t0 >= t3)
+		{
+			double r = sqrt(t0);
+			double s = 0.5 / r;
+			q[0] = 0.5 * r;
+			q[1] = ( v[2][1] - v[1][2] ) * s;
+			q[2] = ( v[0][2] - v[2][0] ) * s;
+			q[3] = ( v[1][0] - v[0][1] ) * s;
+		}
+		else if (t1 >= t2 && t1 >= t3)
+		{
+			double r = sqrt(t1);
+			double s = 0.5 / r;
+			q[0] = (v[2][1] - v[1][2] ) * s;
+			q[1] = 0.5 * r;
+			q[2] = (v[0][1] + v[1][0] ) * s;
+			q[3] = (v[0][2] + v[2][0] ) * s;
+		}
+		else if (t2 >= t3)
+		{
+			double r = sqrt(t2);
+			double s = 0.5 / r;
+			q[0] = (v[0][2] - v[2][0] ) * s;
+			q[1] = (v[0][1] + v[1][0] ) * s;
+			q[2] = 0.5 * r;
+			q[3] = (v[1][2] + v[2][1] ) * s;
+		}
+		else
+		{
+			double r = sqrt(t3);
+			double s = 0.5 / r;
+			q[0] = (v[1][0] - v[0][1]) * s;
+			q[1] = (v[0][2] + v[2][0] ) * s;
+			q[2] = (v[1][2] + v[2][1] ) * s;
+			q[3] = 0.5 * r;
+		}
+		return q;
+	}
+
+	FixedRotMat inv() const {return transp();}	// Inverse computation redefinition.
+};
+
+inline FixedRotMat FixedQuaternion::getRotMat() const
+{
+	FixedRotMat w;
+	w[0][0]=v[0]*v[0]+v[1]*v[1]-v[2]*v[2]-v[3]*v[3];
+	w[0][1]=2*(v[1]*v[2]-v[0]*v[3]);
+	w[0][2]=2*(v[1]*v[3]+v[0]*v[2]);
+	w[1][0]=2*(v[1]*v[2]+v[0]*v[3]);
+	w[1][1]=v[0]*v[0]-v[1]*v[1]+v[2]*v[2]-v[3]*v[3];
+	w[1][2]=2*(v[2]*v[3]-v[0]*v[1]);
+	w[2][0]=2*(v[1]*v[3]-v[0]*v[2]);
+	w[2][1]=2*(v[2]*v[3]+v[0]*v[1]);
+	w[2][2]=v[0]*v[0]-v[1]*v[1]-v[2]*v[2]+v[3]*v[3];
+	return w;
+}
+
+class FixedHomogTransf: public FixedMat<4,4>
+{
+public:
+	//Constructors
+	FixedHomogTransf() : FixedMat<4,4>(0.0) {for(int i=0;i<4;i++) v[i][i]=1.0;}	// Null translation and rotation.
+	explicit FixedHomogTransf(double const *values) : FixedMat<4,4>(values) {}
+	explicit FixedHomogTransf(const Mat &original) : FixedMat<4,4>(original) {}
+	FixedHomogTransf(const FixedRotMat &rot, const Vec3 &trans) : FixedMat<4,4>(0.0)
+	{
+		setRotation(rot);
+		setTranslation(trans);
+		v[3][3]=1.0;
+	}
+	FixedHomogTransf(const FixedMat<4,4> &original) : FixedMat<4,4>(original) {}	// Conversion constructor.
+
+	//Conversion to the dynamic class
+	HomogTransf toHomogTransf() const {return HomogTransf(&v[0][0]);}
+
+	//Operators
+	//(Explicitely Inherited for preserving the output class label)
+	FixedHomogTransf operator *(const FixedHomogTransf &original) const
+	{
+		// The last row is always 0 0 0 1
+		FixedHomogTransf w;
+		for(int i=0;i<3;i++)
+			for(int j=0;j<4;j++)
+				w.v[i][j]=v[i][0]*original.v[0][j]+v[i][1]*original.v[1][j]+v[i][2]*original.v[2][j]+(j==3?v[i][3]:0.0);
+		return w;
+	}
+	//New Operator
+	Vec3 operator *(const Vec3 &original) const  //Transformation of a point in R3.
+	{
+		Vec3 w;
+		for(int i=0;i<3;i++)
+			w[i]=v[i][0]*original[0]+v[i][1]*original[1]+v[i][2]*original[2]+v[i][3];
+		return w;
+	}
+	FixedVec<4> operator *(const FixedVec<4> &original) const {return FixedMat<4,4>::operator*(original);}
+	FixedHomogTransf operator *(const double constant) const {return FixedMat<4,4>::operator*(constant);}
+	FixedHomogTransf operator /(const double constant) const {return FixedMat<4,4>::operator/(constant);}
+
+	//Interface
+	void setTranslation(const Vec3 &trans) {v[0][3]=trans[0]; v[1][3]=trans[1]; v[2][3]=trans[2];}
+	void setRotation(const FixedRotMat &rot) {for(int i=0;i<3;i++) for(int j=0;j<3;j++) v[i][j]=rot[i][j];}
+	FixedRotMat getRotation() const
+	{
+		FixedRotMat r;
+		for(int i=0;i<3;i++) for(int j=0;j<3;j++) r[i][j]=v[i][j];
+		return r;
+	}
+	Vec3 getTranslation() const {Vec3 w; w[0]=v[0][3]; w[1]=v[1][3]; w[2]=v[2][3]; return w;}
+
+	//Algebra
+	FixedHomogTransf inv() const
+	{
+		FixedHomogTransf h;
+		for(int i=0;i<3;i++)
+			for(int j=0;j<3;j++) h.v[i][j]=v[j][i];
+		for(int i=0;i<3;i++)
+			h.v[i][3]=-(v[0][3]*v[0][i])-(v[1][3]*v[1][i])-(v[2][3]*v[2][i]);
+		return h;
+	}
+};
+
+#endif	// !defined(FIXEDMAT_INCLUDED)
@@ -0,0 +1,49 @@
+#if !defined(MATKERNELS_INCLUDED)
+#define MATKERNELS_INCLUDED
+
+#include <stddef.h>
+
+// Alignment of the matrix storage, in bytes (one AVX register)
+#define MATVEC_ALIGNMENT 32
+
+/** \class namespace
+    \brief Kernels on contiguous, row-major matrices.
+    They back the Mat and HomogTransf operations. AVX2 (and FMA) or NEON
+    versions are compiled when the compiler targets those instruction sets,
+    and portable scalar versions otherwise, or when MATVEC_NO_SIMD is
+    defined. The pointers do not need to be aligned.
+*/
+namespace matKernels
+{
+	// Aligned storage for n doubles. Release it with release().
+	double *allocate(const size_t n);
+	void release(double *p);
+
+	// Name of the instruction set the kernels were compiled for
+	const char *instructionSet();
+
+	// c (n x p) = a (n x m) * b (m x p). c must not overlap a or b.
+	void gemm(const double *a, const double *b, double *c, const int n, const int m, const int p);
+
+	// y (n) = a (n x m) * x (m). y must not overlap a or x.
+	void gemv(const double *a, const double *x, double *y, const int n, const int m);
+
+	// In-place LU decomposition (n x m, n <= m) with partial pivoting, as
+	// Mat::LDU(): the unit lower factor is stored below the diagonal, and
+	// the upper factor on and above it. perm receives the original index
+	// of every row. Returns the sign of the permutation. The elimination
+	// stops at the first zero pivot.
+	int lu(double *a, const int n, const int m, int *perm);
+
+	// Solve a x = b from the decomposition of a square matrix by lu()
+	void luSolve(const double *lu, const int *perm, const int n, const double *b, double *x);
+
+	// c = a * b for 4x4 homogeneous transforms (last row 0 0 0 1)
+	void homogMul(const double *a, const double *b, double *c);
+
+	// result = t[0] * t[1] * ... * t[count-1], for count consecutive 4x4
+	// homogeneous transforms (16 doubles each)
+	void homogChain(const double *t, const int count, double *result);
+}
+
+#endif	// !defined(MATKERNELS_INCLUDED)
@@ -0,0 +1,105 @@
+#if !defined(QUATINTERP_INCLUDED)
+#define QUATINTERP_INCLUDED
+
+#include <math.h>
+
+// Interpolation of unit quaternions, for orientation paths: SLERP between
+// two orientations, SQUAD through a sequence of them, and steps of a
+// bounded angle towards a target. They work on FixedQuaternion values, so
+// they need no heap allocation. All interpolations follow the shorter arc,
+// i.e. q and -q are the same orientation. Include after FixedMat.h (as
+// matVec.h does).
+
+// Above this dot product of the quaternions, SLERP is replaced by a
+// normalized linear blend, since sin(angle) gets too small to divide by.
+// The blend is then off by less than 1e-8 [rad].
+#define QUAT_SLERP_LINEAR_DOT 0.99999
+
+// Angle [rad] of the rotation from q0 to q1, in [0, PI]
+inline double quatAngle(const FixedQuaternion &q0, const FixedQuaternion &q1)
+{
+	double c = fabs(q0*q1);
+	if (c > 1.0)
+		c = 1.0;
+	return 2.0*acos(c);
+}
+
+// Logarithm of a unit quaternion, i.e. (0, axis*angle/2)
+inline FixedQuaternion quatLog(const FixedQuaternion &q)
+{
+	Vec3 w = q.getVector();
+	double s = w.norm();
+	if (s < TOLERANCE)
+		return FixedQuaternion(0.0, Vec3(0.0));
+	return FixedQuaternion(0.0, w*(atan2(s, q.getScalar())/s));
+}
+
+// Exponential of a pure quaternion (0, axis*angle/2), i.e. a unit quaternion
+inline FixedQuaternion quatExp(const FixedQuaternion &q)
+{
+	Vec3 w = q.getVector();
+	double halfAngle = w.norm();
+	if (halfAngle < TOLERANCE)
+	{
+		FixedQuaternion r(1.0, w);
+		r.normalize();
+		return r;
+	}
+	return FixedQuaternion(cos(halfAngle), w*(sin(halfAngle)/halfAngle));
+}
+
+// Spherical linear interpolation from q0 (t = 0) to q1 (t = 1). The
+// angular velocity is constant over t, i.e. the rotation from q0 is
+// t*quatAngle(q0,q1).
+inline FixedQuaternion quatSlerp(const FixedQuaternion &q0, const FixedQuaternion &q1, const double t)
+{
+	double c = q0*q1;
+	FixedQuaternion q2 = (c < 0.0) ? -q1 : q1;
+	c = fabs(c);
+
+	if (c > QUAT_SLERP_LINEAR_DOT)
+	{
+		FixedQuaternion q = q0 + (q2 - q0)*t;
+		q.normalize();
+		return q;
+	}
+
+	double angle = acos(c);
+	double s = sin(angle);
+	return q0*(sin((1.0 - t)*angle)/s) + q2*(sin(t*angle)/s);
+}
+
+// Inner control point of q, for SQUAD through qPrev, q and qNext. The
+// path then has a continuous angular velocity at q.
+inline FixedQuaternion quatSquadControl(const FixedQuaternion &qPrev, const FixedQuaternion &q, const FixedQuaternion &qNext)
+{
+	FixedQuaternion qInv = q.conjugate();
+	FixedQuaternion toNext = quatLog(qInv ^ ((q*qNext < 0.0) ? -qNext : qNext));
+	FixedQuaternion toPrev = quatLog(qInv ^ ((q*qPrev < 0.0) ? -qPrev : qPrev));
+	return q ^ quatExp((toNext + toPrev)*(-0.25));
+}
+
+// Spherical quadrangle interpolation from q0 (t = 0) to q1 (t = 1), with
+// the control points s0 of q0 and s1 of q1 (see quatSquadControl)
+inline FixedQuaternion quatSquad(const FixedQuaternion &q0, const FixedQuaternion &q1,
+	const FixedQuaternion &s0, const FixedQuaternion &s1, const double t)
+{
+	return quatSlerp(quatSlerp(q0, q1, t), quatSlerp(s0, s1, t), 2.0*t*(1.0 - t));
+}
+
+// Rotates from q towards target by at most maxAngle [rad], i.e. steps at
+// a constant angular velocity. Returns true if the step reached the
+// target, which is then the next orientation.
+inline bool quatStep(const FixedQuaternion &q, const FixedQuaternion &target, const double maxAngle, FixedQuaternion &next)
+{
+	double angle = quatAngle(q, target);
+	if (angle <= maxAngle)
+	{
+		next = target;
+		return true;
+	}
+	next = quatSlerp(q, target, maxAngle/angle);
+	return false;
+}
+
+#endif	// !defined(QUATINTERP_INCLUDED)
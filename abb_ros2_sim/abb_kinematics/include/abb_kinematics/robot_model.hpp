@@ -0,0 +1,82 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace abb_kinematics
+{
+constexpr std::size_t NUM_JOINTS = 6;
+
+/**
+ * \brief Joint positions [rad] of a six axis arm.
+ */
+using JointVector = std::array<double, NUM_JOINTS>;
+
+/**
+ * \brief Geometry and limits of one revolute joint, as in the URDF.
+ */
+struct JointModel
+{
+  /**
+   * \brief Position [m] of the joint in its parent link (the joint origins have no rotation).
+   */
+  double origin[3];
+
+  /**
+   * \brief Position limits [rad].
+   */
+  double lower;
+  double upper;
+
+  /**
+   * \brief Velocity limit [rad/s].
+   */
+  double velocity;
+};
+
+/**
+ * \brief Kinematic model of a six axis ABB arm with a spherical wrist.
+ *
+ * The joint axes are z, y, y, x, y, x, and the tool0 frame is rotated 90 degrees about y from link_6, as in the
+ * support packages. The models are generated from their URDF macros when the package is built.
+ */
+struct RobotModel
+{
+  /**
+   * \brief Name of the URDF macro, e.g. "abb_irb1200_5_90".
+   */
+  const char* name;
+
+  JointModel joints[NUM_JOINTS];
+};
+
+/**
+ * \brief Looks up a robot model by the name of its URDF macro.
+ *
+ * \param name of the model, with or without the "abb_" prefix.
+ *
+ * \return the model, or nullptr if there is none with that name.
+ */
+const RobotModel* findRobotModel(const std::string& name);
+
+/**
+ * \brief Names of all robot models.
+ */
+std::vector<std::string> robotModelNames();
+}  // namespace abb_kinematics
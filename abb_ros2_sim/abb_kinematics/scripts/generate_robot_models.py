@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+# Copyright 2026 The abb_ros2 Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generate the robot model table of abb_kinematics from the URDF macros of the support packages.
+
+Every macro must describe a six axis arm with a spherical wrist, laid out like the ABB support packages: joint axes
+z, y, y, x, y, x, no offsets out of the plane of the arm, no rotations in the joint origins, and a tool0 frame rotated
+90 degrees about y from link_6. The closed-form inverse kinematics relies on that layout, so anything else fails the
+build instead of producing wrong solutions.
+"""
+
+import argparse
+import math
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+XACRO_NS = '{http://ros.org/wiki/xacro}'
+EXPECTED_AXES = [(0, 0, 1), (0, 1, 0), (0, 1, 0), (1, 0, 0), (0, 1, 0), (1, 0, 0)]
+TOLERANCE = 1e-9
+
+
+def evaluate(text):
+    """Evaluate a xacro attribute, with ${...} expressions over radians() and pi."""
+    def substitute(match):
+        value = eval(match.group(1), {'__builtins__': {}}, {'radians': math.radians, 'pi': math.pi})
+        return repr(float(value))
+    return re.sub(r'\$\{([^}]*)\}', substitute, text.strip())
+
+
+def numbers(text):
+    return [float(value) for value in evaluate(text).split()]
+
+
+def fail(path, message):
+    sys.exit('%s: %s' % (path, message))
+
+
+def parse_macro(path, macro):
+    joints = {}
+    for joint in macro.iter('joint'):
+        name = joint.get('name', '').replace('${prefix}', '')
+        joints[name] = joint
+
+    model = {'name': macro.get('name'), 'joints': []}
+    for index in range(6):
+        joint = joints.get('joint_%d' % (index + 1))
+        if joint is None or joint.get('type') != 'revolute':
+            fail(path, 'joint_%d is missing or not revolute' % (index + 1))
+        origin = joint.find('origin')
+        xyz = numbers(origin.get('xyz', '0 0 0'))
+        rpy = numbers(origin.get('rpy', '0 0 0'))
+        axis = tuple(int(round(value)) for value in numbers(joint.find('axis').get('xyz')))
+        limit = joint.find('limit')
+        if axis != EXPECTED_AXES[index]:
+            fail(path, 'joint_%d has axis %s, expected %s' % (index + 1, axis, EXPECTED_AXES[index]))
+        if any(abs(value) > TOLERANCE for value in rpy):
+            fail(path, 'joint_%d has a rotated origin' % (index + 1))
+        if abs(xyz[1]) > TOLERANCE:
+            fail(path, 'joint_%d is offset out of the plane of the arm' % (index + 1))
+        model['joints'].append({
+            'origin': xyz,
+            'lower': numbers(limit.get('lower'))[0],
+            'upper': numbers(limit.get('upper'))[0],
+            'velocity': numbers(limit.get('velocity'))[0],
+        })
+
+    # The wrist axes must intersect at the origin of joint_5
+    for index in (4, 5):
+        if abs(model['joints'][index]['origin'][2]) > TOLERANCE:
+            fail(path, 'joint_%d is offset from the wrist axis' % (index + 1))
+
+    # tool0 looks along the axis of joint_6, from the flange
+    tool_rpy = [0.0, 0.0, 0.0]
+    for name in ('joint_6-flange', 'link_6-tool0'):
+        joint = joints.get(name)
+        if joint is None:
+            fail(path, '%s is missing' % name)
+        origin = joint.find('origin')
+        if any(abs(value) > TOLERANCE for value in numbers(origin.get('xyz', '0 0 0'))):
+            fail(path, '%s has a translation' % name)
+        tool_rpy = [a + b for a, b in zip(tool_rpy, numbers(origin.get('rpy', '0 0 0')))]
+    if any(abs(a - b) > TOLERANCE for a, b in zip(tool_rpy, [0.0, math.pi / 2, 0.0])):
+        fail(path, 'tool0 is not rotated 90 degrees about y from link_6')
+    return model
+
+
+def format_joint(joint):
+    return '{ { %r, %r, %r }, %r, %r, %r }' % (tuple(joint['origin']) + (joint['lower'], joint['upper'],
+                                                                       joint['velocity']))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--output', required=True)
+    parser.add_argument('macros', nargs='+', help='URDF macro files (*_macro.xacro)')
+    arguments = parser.parse_args()
+
+    models = []
+    for path in sorted(arguments.macros):
+        root = ET.parse(path).getroot()
+        for macro in root.iter(XACRO_NS + 'macro'):
+            models.append(parse_macro(path, macro))
+    if not models:
+        sys.exit('No robot macros found')
+
+    lines = [
+        '// Generated by generate_robot_models.py from the URDF macros of the support packages. Do not edit.',
+        '',
+        '#pragma once',
+        '',
+        '#include <abb_kinematics/robot_model.hpp>',
+        '',
+        'namespace abb_kinematics',
+        '{',
+        'const RobotModel ROBOT_MODELS[] = {',
+    ]
+    for model in models:
+        lines.append('  { "%s",' % model['name'])
+        lines.append('    { %s } },' % (',\n      '.join(format_joint(joint) for joint in model['joints'])))
+    lines.append('};')
+    lines.append('}  // namespace abb_kinematics')
+
+    with open(arguments.output, 'w') as output:
+        output.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,244 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_kinematics/cartesian_streaming_controller.hpp>
+
+#include <functional>
+
+#include <hardware_interface/types/hardware_interface_type_values.hpp>
+
+namespace abb_kinematics
+{
+namespace
+{
+constexpr double DEFAULT_COMMAND_TIMEOUT = 0.1;
+
+FixedHomogTransf toTransform(const geometry_msgs::msg::Pose& pose)
+{
+  FixedQuaternion rotation(pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  rotation.normalize();
+  Vec3 translation;
+  translation[0] = pose.position.x;
+  translation[1] = pose.position.y;
+  translation[2] = pose.position.z;
+  return FixedHomogTransf(rotation.getRotMat(), translation);
+}
+
+/**
+ * \brief Index of the loaned interface of a joint, or the number of interfaces if there is none.
+ */
+template <typename Interfaces>
+std::size_t findInterface(const Interfaces& interfaces, const std::string& joint, const std::string& name)
+{
+  for (std::size_t i = 0; i < interfaces.size(); ++i)
+  {
+    if (interfaces[i].get_prefix_name() == joint && interfaces[i].get_interface_name() == name)
+    {
+      return i;
+    }
+  }
+  return interfaces.size();
+}
+}  // namespace
+
+CallbackReturn CartesianStreamingController::on_init()
+{
+  try
+  {
+    const DLSSolver::Parameters defaults;
+    auto_declare<std::string>("robot_model", "abb_irb1200_5_90");
+    auto_declare<std::string>("prefix", "");
+    auto_declare<std::vector<std::string>>("joints", std::vector<std::string>());
+    auto_declare<double>("command_timeout", DEFAULT_COMMAND_TIMEOUT);
+    auto_declare<double>("damping", defaults.damping);
+    auto_declare<double>("singular_threshold", defaults.singular_threshold);
+    auto_declare<double>("linear_gain", defaults.linear_gain);
+    auto_declare<double>("angular_gain", defaults.angular_gain);
+    auto_declare<double>("max_linear_velocity", defaults.max_linear_velocity);
+    auto_declare<double>("max_angular_velocity", defaults.max_angular_velocity);
+  }
+  catch (const std::exception& e)
+  {
+    RCLCPP_ERROR(get_node()->get_logger(), "Exception thrown during init stage with message: %s", e.what());
+    return CallbackReturn::ERROR;
+  }
+  return CallbackReturn::SUCCESS;
+}
+
+controller_interface::InterfaceConfiguration CartesianStreamingController::command_interface_configuration() const
+{
+  controller_interface::InterfaceConfiguration configuration;
+  configuration.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  for (const auto& joint : joint_names_)
+  {
+    configuration.names.push_back(joint + "/" + hardware_interface::HW_IF_POSITION);
+    configuration.names.push_back(joint + "/" + hardware_interface::HW_IF_VELOCITY);
+  }
+  return configuration;
+}
+
+controller_interface::InterfaceConfiguration CartesianStreamingController::state_interface_configuration() const
+{
+  controller_interface::InterfaceConfiguration configuration;
+  configuration.type = controller_interface::interface_configuration_type::INDIVIDUAL;
+  for (const auto& joint : joint_names_)
+  {
+    configuration.names.push_back(joint + "/" + hardware_interface::HW_IF_POSITION);
+  }
+  return configuration;
+}
+
+CallbackReturn CartesianStreamingController::on_configure(const rclcpp_lifecycle::State& /* previous_state */)
+{
+  const auto node = get_node();
+  const std::string name = node->get_parameter("robot_model").as_string();
+  const RobotModel* model = findRobotModel(name);
+  if (!model)
+  {
+    RCLCPP_ERROR(node->get_logger(), "Unknown robot model '%s'", name.c_str());
+    return CallbackReturn::ERROR;
+  }
+
+  const std::string prefix = node->get_parameter("prefix").as_string();
+  joint_names_ = node->get_parameter("joints").as_string_array();
+  if (joint_names_.empty())
+  {
+    for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+    {
+      joint_names_.push_back(prefix + "joint_" + std::to_string(i + 1));
+    }
+  }
+  if (joint_names_.size() != NUM_JOINTS)
+  {
+    RCLCPP_ERROR(node->get_logger(), "Expected %zu joints, got %zu", NUM_JOINTS, joint_names_.size());
+    return CallbackReturn::ERROR;
+  }
+
+  DLSSolver::Parameters parameters;
+  parameters.damping = node->get_parameter("damping").as_double();
+  parameters.singular_threshold = node->get_parameter("singular_threshold").as_double();
+  parameters.linear_gain = node->get_parameter("linear_gain").as_double();
+  parameters.angular_gain = node->get_parameter("angular_gain").as_double();
+  parameters.max_linear_velocity = node->get_parameter("max_linear_velocity").as_double();
+  parameters.max_angular_velocity = node->get_parameter("max_angular_velocity").as_double();
+  command_timeout_ = rclcpp::Duration::from_seconds(node->get_parameter("command_timeout").as_double());
+
+  // The solver refers to the kinematics, so it goes first
+  solver_.reset();
+  kinematics_ = std::make_unique<Kinematics>(*model);
+  solver_ = std::make_unique<DLSSolver>(*kinematics_, parameters);
+
+  using std::placeholders::_1;
+  twist_subscription_ = node->create_subscription<geometry_msgs::msg::TwistStamped>(
+      "~/twist", rclcpp::SystemDefaultsQoS(), std::bind(&CartesianStreamingController::twistCallback, this, _1));
+  pose_subscription_ = node->create_subscription<geometry_msgs::msg::PoseStamped>(
+      "~/pose", rclcpp::SystemDefaultsQoS(), std::bind(&CartesianStreamingController::poseCallback, this, _1));
+
+  RCLCPP_INFO_STREAM(node->get_logger(), "Streaming Cartesian targets for " << model->name);
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn CartesianStreamingController::on_activate(const rclcpp_lifecycle::State& /* previous_state */)
+{
+  position_commands_.clear();
+  velocity_commands_.clear();
+  position_states_.clear();
+  JointVector joints;
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    const std::string& joint = joint_names_[j];
+    position_commands_.push_back(findInterface(command_interfaces_, joint, hardware_interface::HW_IF_POSITION));
+    velocity_commands_.push_back(findInterface(command_interfaces_, joint, hardware_interface::HW_IF_VELOCITY));
+    position_states_.push_back(findInterface(state_interfaces_, joint, hardware_interface::HW_IF_POSITION));
+    if (position_commands_[j] == command_interfaces_.size() || velocity_commands_[j] == command_interfaces_.size() ||
+        position_states_[j] == state_interfaces_.size())
+    {
+      RCLCPP_ERROR(get_node()->get_logger(), "Missing interfaces of joint '%s'", joint.c_str());
+      return CallbackReturn::ERROR;
+    }
+    joints[j] = state_interfaces_[position_states_[j]].get_value();
+  }
+
+  // Warm start from the measured positions, without the targets of a previous activation
+  solver_->reset(joints);
+  target_.writeFromNonRT(nullptr);
+  return CallbackReturn::SUCCESS;
+}
+
+CallbackReturn CartesianStreamingController::on_deactivate(const rclcpp_lifecycle::State& /* previous_state */)
+{
+  // Leave the arm at its last position
+  for (std::size_t j = 0; j < velocity_commands_.size(); ++j)
+  {
+    command_interfaces_[velocity_commands_[j]].set_value(0.0);
+  }
+  return CallbackReturn::SUCCESS;
+}
+
+controller_interface::return_type CartesianStreamingController::update(const rclcpp::Time& time,
+                                                                       const rclcpp::Duration& period)
+{
+  static const double STOP[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+  const double dt = period.seconds();
+  const std::shared_ptr<Target> target = *target_.readFromRT();
+  const JointVector* velocities = nullptr;
+  if (target && target->is_pose)
+  {
+    velocities = &solver_->poseStep(target->pose, dt);
+  }
+  else if (target && time - target->received <= command_timeout_)
+  {
+    velocities = &solver_->velocityStep(target->twist, dt);
+  }
+  else
+  {
+    velocities = &solver_->velocityStep(STOP, dt);
+  }
+
+  const JointVector& joints = solver_->joints();
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    command_interfaces_[position_commands_[j]].set_value(joints[j]);
+    command_interfaces_[velocity_commands_[j]].set_value((*velocities)[j]);
+  }
+  return controller_interface::return_type::OK;
+}
+
+void CartesianStreamingController::twistCallback(const geometry_msgs::msg::TwistStamped::SharedPtr message)
+{
+  auto target = std::make_shared<Target>();
+  target->twist[0] = message->twist.linear.x;
+  target->twist[1] = message->twist.linear.y;
+  target->twist[2] = message->twist.linear.z;
+  target->twist[3] = message->twist.angular.x;
+  target->twist[4] = message->twist.angular.y;
+  target->twist[5] = message->twist.angular.z;
+  target->received = get_node()->now();
+  target_.writeFromNonRT(target);
+}
+
+void CartesianStreamingController::poseCallback(const geometry_msgs::msg::PoseStamped::SharedPtr message)
+{
+  auto target = std::make_shared<Target>();
+  target->is_pose = true;
+  target->pose = toTransform(message->pose);
+  target->received = get_node()->now();
+  target_.writeFromNonRT(target);
+}
+}  // namespace abb_kinematics
+
+#include "pluginlib/class_list_macros.hpp"
+
+PLUGINLIB_EXPORT_CLASS(abb_kinematics::CartesianStreamingController, controller_interface::ControllerInterface)
@@ -0,0 +1,167 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_kinematics/dls_solver.hpp>
+
+#include <cmath>
+
+namespace abb_kinematics
+{
+namespace
+{
+/**
+ * \brief Scales a 3D vector down to a maximum norm.
+ */
+void limitNorm(double vector[3], const double max_norm)
+{
+  const double norm = std::sqrt(vector[0] * vector[0] + vector[1] * vector[1] + vector[2] * vector[2]);
+  if (norm > max_norm)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      vector[i] *= max_norm / norm;
+    }
+  }
+}
+}  // namespace
+
+DLSSolver::DLSSolver(const Kinematics& kinematics, const Parameters& parameters)
+  : kinematics_{ kinematics }
+  , parameters_{ parameters }
+  , joints_{}
+  , velocities_{}
+  , min_singular_value_{ 0.0 }
+  , jacobian_(6, 6)
+  , u_(6, 6)
+  , sigma_(6)
+  , v_(6, 6)
+{
+}
+
+void DLSSolver::reset(const JointVector& joints)
+{
+  joints_ = joints;
+  velocities_.fill(0.0);
+}
+
+const JointVector& DLSSolver::velocityStep(const double twist[6], const double dt)
+{
+  pose_ = kinematics_.jacobian(joints_, fixed_jacobian_);
+  for (int i = 0; i < 6; ++i)
+  {
+    for (int j = 0; j < 6; ++j)
+    {
+      jacobian_[i][j] = fixed_jacobian_[i][j];
+    }
+  }
+  jacobian_.SVD(u_, sigma_, v_);
+
+  min_singular_value_ = sigma_[0];
+  for (int i = 1; i < 6; ++i)
+  {
+    min_singular_value_ = std::fmin(min_singular_value_, sigma_[i]);
+  }
+
+  // Damping that grows smoothly from zero at the threshold to its maximum at the singularity
+  double damping = 0.0;
+  if (min_singular_value_ < parameters_.singular_threshold)
+  {
+    const double ratio = min_singular_value_ / parameters_.singular_threshold;
+    damping = (1.0 - ratio * ratio) * parameters_.damping * parameters_.damping;
+  }
+
+  // dq = V diag(sigma / (sigma^2 + damping)) U^T twist
+  velocities_.fill(0.0);
+  for (int i = 0; i < 6; ++i)
+  {
+    double projection = 0.0;
+    for (int k = 0; k < 6; ++k)
+    {
+      projection += u_[k][i] * twist[k];
+    }
+    const double gain = sigma_[i] / (sigma_[i] * sigma_[i] + damping);
+    if (!std::isfinite(gain))
+    {
+      continue;
+    }
+    for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+    {
+      velocities_[j] += v_[j][i] * gain * projection;
+    }
+  }
+
+  // Keep the direction of the motion within the velocity limits
+  double scale = 1.0;
+  const auto& model = kinematics_.model();
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    scale = std::fmax(scale, std::fabs(velocities_[j]) / model.joints[j].velocity);
+  }
+
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    velocities_[j] /= scale;
+    const double next =
+        std::fmax(model.joints[j].lower, std::fmin(model.joints[j].upper, joints_[j] + velocities_[j] * dt));
+    if (dt > 0.0)
+    {
+      velocities_[j] = (next - joints_[j]) / dt;
+    }
+    joints_[j] = next;
+  }
+  return velocities_;
+}
+
+const JointVector& DLSSolver::poseStep(const FixedHomogTransf& target, const double dt)
+{
+  const FixedHomogTransf pose = kinematics_.forward(joints_);
+
+  double twist[6];
+  for (int i = 0; i < 3; ++i)
+  {
+    twist[i] = parameters_.linear_gain * (target[i][3] - pose[i][3]);
+  }
+
+  // Orientation error as a rotation vector, from the quaternion of target * pose^T
+  const FixedRotMat error = target.getRotation() * pose.getRotation().transp();
+  FixedQuaternion rotation = error.getQuaternion();
+  if (rotation[0] < 0.0)
+  {
+    rotation = -rotation;
+  }
+  const double s = std::sqrt(rotation[1] * rotation[1] + rotation[2] * rotation[2] + rotation[3] * rotation[3]);
+  const double factor = (s > 1e-12 ? 2.0 * std::atan2(s, rotation[0]) / s : 2.0);
+  for (int i = 0; i < 3; ++i)
+  {
+    twist[3 + i] = parameters_.angular_gain * factor * rotation[1 + i];
+  }
+
+  // Close the last stretch exactly instead of overshooting it
+  if (dt > 0.0)
+  {
+    for (int i = 0; i < 6; ++i)
+    {
+      const double gain = (i < 3 ? parameters_.linear_gain : parameters_.angular_gain);
+      if (gain * dt > 1.0)
+      {
+        twist[i] /= gain * dt;
+      }
+    }
+  }
+
+  limitNorm(twist, parameters_.max_linear_velocity);
+  limitNorm(twist + 3, parameters_.max_angular_velocity);
+  return velocityStep(twist, dt);
+}
+}  // namespace abb_kinematics
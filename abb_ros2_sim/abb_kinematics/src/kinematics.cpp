@@ -0,0 +1,338 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_kinematics/kinematics.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace abb_kinematics
+{
+namespace
+{
+constexpr double TWO_PI = 2.0 * M_PI;
+
+/**
+ * \brief Below this, the wrist center is taken to be on the axis of joint_1, or joint_5 to be straight.
+ */
+constexpr double SINGULAR_TOLERANCE = 1e-9;
+
+/**
+ * \brief Slack on the joint limits and the reach, for rounding errors.
+ */
+constexpr double LIMIT_TOLERANCE = 1e-9;
+
+FixedRotMat jointRotation(const std::size_t joint, const double position)
+{
+  // Joint axes z, y, y, x, y, x
+  FixedRotMat rotation;
+  switch (joint)
+  {
+    case 0:
+      rotation.rotZ(position);
+      break;
+    case 1:
+    case 2:
+    case 4:
+      rotation.rotY(position);
+      break;
+    default:
+      rotation.rotX(position);
+      break;
+  }
+  return rotation;
+}
+
+double squaredDistance(const JointVector& a, const JointVector& b)
+{
+  double distance = 0.0;
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    distance += (a[i] - b[i]) * (a[i] - b[i]);
+  }
+  return distance;
+}
+}  // namespace
+
+constexpr std::size_t Kinematics::MAX_SOLUTIONS;
+
+Kinematics::Kinematics(const RobotModel& model) : model_{ model }
+{
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    origins_[i] = Vec3(model.joints[i].origin);
+  }
+  FixedRotMat tool_rotation;
+  tool_rotation.rotY(M_PI / 2.0);
+  tool_ = FixedHomogTransf(tool_rotation, Vec3(0.0));
+
+  const auto& o = model.joints;
+  base_x_ = o[0].origin[0];
+  base_height_ = o[0].origin[2];
+  shoulder_x_ = o[1].origin[0];
+  shoulder_z_ = o[1].origin[2];
+  upper_arm_x_ = o[2].origin[0];
+  upper_arm_z_ = o[2].origin[2];
+  forearm_x_ = o[3].origin[0] + o[4].origin[0];
+  forearm_z_ = o[3].origin[2];
+  wrist_length_ = o[5].origin[0];
+}
+
+FixedHomogTransf Kinematics::forward(const JointVector& joints) const
+{
+  FixedHomogTransf pose(jointRotation(0, joints[0]), origins_[0]);
+  for (std::size_t i = 1; i < NUM_JOINTS; ++i)
+  {
+    pose = pose * FixedHomogTransf(jointRotation(i, joints[i]), origins_[i]);
+  }
+  return pose * tool_;
+}
+
+void Kinematics::forward(const JointVector* joints, const std::size_t count, FixedHomogTransf* poses) const
+{
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    poses[i] = forward(joints[i]);
+  }
+}
+
+FixedHomogTransf Kinematics::jacobian(const JointVector& joints, FixedMat<6, 6>& jacobian) const
+{
+  // Column of the joint axes in their link frames (z, y, y, x, y, x)
+  static const int AXES[NUM_JOINTS] = { 2, 1, 1, 0, 1, 0 };
+
+  std::array<Vec3, NUM_JOINTS> axes;
+  std::array<Vec3, NUM_JOINTS> positions;
+  FixedHomogTransf frame;
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    frame = frame * FixedHomogTransf(jointRotation(i, joints[i]), origins_[i]);
+    for (int k = 0; k < 3; ++k)
+    {
+      axes[i][k] = frame[k][AXES[i]];
+      positions[i][k] = frame[k][3];
+    }
+  }
+  const FixedHomogTransf pose = frame * tool_;
+
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    const Vec3& z = axes[i];
+    const double dx = pose[0][3] - positions[i][0];
+    const double dy = pose[1][3] - positions[i][1];
+    const double dz = pose[2][3] - positions[i][2];
+    jacobian[0][i] = z[1] * dz - z[2] * dy;
+    jacobian[1][i] = z[2] * dx - z[0] * dz;
+    jacobian[2][i] = z[0] * dy - z[1] * dx;
+    jacobian[3][i] = z[0];
+    jacobian[4][i] = z[1];
+    jacobian[5][i] = z[2];
+  }
+  return pose;
+}
+
+std::size_t Kinematics::solve(const FixedHomogTransf& pose, const JointVector* seed,
+                              std::array<JointVector, MAX_SOLUTIONS>& solutions) const
+{
+  // The wrist center is behind tool0, along its z axis (the axis of joint_6)
+  const double wx = pose[0][3] - wrist_length_ * pose[0][2] - base_x_;
+  const double wy = pose[1][3] - wrist_length_ * pose[1][2];
+  const double wz = pose[2][3] - wrist_length_ * pose[2][2] - base_height_;
+
+  // link_6 in base_link, i.e. tool0 without its rotation about y
+  FixedRotMat link_6;
+  for (int i = 0; i < 3; ++i)
+  {
+    link_6[i][0] = pose[i][2];
+    link_6[i][1] = pose[i][1];
+    link_6[i][2] = -pose[i][0];
+  }
+
+  double base_angle = (seed ? (*seed)[0] : 0.0);
+  if (std::hypot(wx, wy) > SINGULAR_TOLERANCE)
+  {
+    base_angle = std::atan2(wy, wx);
+  }
+
+  // Constants of the elbow: |u|^2 = |upper|^2 + |forearm|^2 + 2 (p cos(q3) + q sin(q3))
+  const double p = upper_arm_x_ * forearm_x_ + upper_arm_z_ * forearm_z_;
+  const double q = upper_arm_x_ * forearm_z_ - upper_arm_z_ * forearm_x_;
+  const double elbow_radius = std::hypot(p, q);
+  const double elbow_phase = std::atan2(q, p);
+  const double lengths = upper_arm_x_ * upper_arm_x_ + upper_arm_z_ * upper_arm_z_ + forearm_x_ * forearm_x_ +
+                         forearm_z_ * forearm_z_;
+
+  std::size_t count = 0;
+  for (int back = 0; back < 2; ++back)
+  {
+    // Facing the wrist center, or turned away from it with the arm reaching over
+    const double q1 = base_angle + (back ? M_PI : 0.0);
+    const double c1 = std::cos(q1);
+    const double s1 = std::sin(q1);
+    const double ux = wx * c1 + wy * s1 - shoulder_x_;
+    const double uz = wz - shoulder_z_;
+
+    double cosine = ((ux * ux + uz * uz - lengths) / 2.0) / elbow_radius;
+    if (std::fabs(cosine) > 1.0 + LIMIT_TOLERANCE)
+    {
+      continue;
+    }
+    cosine = std::fmax(-1.0, std::fmin(1.0, cosine));
+    const double elbow_offset = std::acos(cosine);
+
+    for (int down = 0; down < 2; ++down)
+    {
+      const double q3 = elbow_phase + (down ? -elbow_offset : elbow_offset);
+      const double c3 = std::cos(q3);
+      const double s3 = std::sin(q3);
+
+      // Rotations about y turn the arm plane clockwise: u = Ry(q2) (upper + Ry(q3) forearm)
+      const double ax = upper_arm_x_ + forearm_x_ * c3 + forearm_z_ * s3;
+      const double az = upper_arm_z_ - forearm_x_ * s3 + forearm_z_ * c3;
+      const double q2 = std::atan2(az, ax) - std::atan2(uz, ux);
+
+      // The wrist rotation Rx(q4) Ry(q5) Rx(q6) = (Rz(q1) Ry(q2 + q3))^T link_6
+      FixedRotMat arm;
+      arm.rotY(q2 + q3);
+      FixedRotMat base;
+      base.rotZ(q1);
+      const FixedRotMat wrist = (base * arm).transp() * link_6;
+
+      const double s5 = std::hypot(wrist[1][0], wrist[2][0]);
+      if (s5 > SINGULAR_TOLERANCE)
+      {
+        const double q5 = std::atan2(s5, wrist[0][0]);
+        const double q4 = std::atan2(wrist[1][0], -wrist[2][0]);
+        const double q6 = std::atan2(wrist[0][1], wrist[0][2]);
+        solutions[count++] = { q1, q2, q3, q4, q5, q6 };
+        solutions[count++] = { q1, q2, q3, q4 + M_PI, -q5, q6 + M_PI };
+      }
+      else
+      {
+        // Joints 4 and 6 are aligned, only their sum (or difference) is known
+        const double q4 = (seed ? (*seed)[3] : 0.0);
+        const double angle = std::atan2(wrist[2][1], wrist[1][1]);
+        if (wrist[0][0] > 0.0)
+        {
+          solutions[count++] = { q1, q2, q3, q4, 0.0, angle - q4 };
+        }
+        else
+        {
+          solutions[count++] = { q1, q2, q3, q4, M_PI, q4 - angle };
+        }
+      }
+    }
+  }
+  return count;
+}
+
+bool Kinematics::applyLimits(JointVector& joints, const JointVector* seed) const
+{
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    const double lower = model_.joints[i].lower - LIMIT_TOLERANCE;
+    const double upper = model_.joints[i].upper + LIMIT_TOLERANCE;
+    const double target = (seed ? (*seed)[i] : 0.0);
+
+    // Closest equivalent position to the target, then the neighbouring turns
+    double position = joints[i] + TWO_PI * std::round((target - joints[i]) / TWO_PI);
+    double best = std::numeric_limits<double>::quiet_NaN();
+    for (int turn = -1; turn <= 1; ++turn)
+    {
+      const double candidate = position + turn * TWO_PI;
+      if (candidate >= lower && candidate <= upper &&
+          (std::isnan(best) || std::fabs(candidate - target) < std::fabs(best - target)))
+      {
+        best = candidate;
+      }
+    }
+    if (std::isnan(best))
+    {
+      return false;
+    }
+    joints[i] = std::fmax(model_.joints[i].lower, std::fmin(model_.joints[i].upper, best));
+  }
+  return true;
+}
+
+std::size_t Kinematics::inverse(const FixedHomogTransf& pose, Solutions& solutions) const
+{
+  std::array<JointVector, MAX_SOLUTIONS> raw;
+  const std::size_t count = solve(pose, nullptr, raw);
+
+  solutions.count = 0;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (applyLimits(raw[i], nullptr))
+    {
+      solutions.joints[solutions.count++] = raw[i];
+    }
+  }
+  return solutions.count;
+}
+
+bool Kinematics::inverse(const FixedHomogTransf& pose, const JointVector& seed, JointVector& joints) const
+{
+  std::array<JointVector, MAX_SOLUTIONS> raw;
+  const std::size_t count = solve(pose, &seed, raw);
+
+  double best = std::numeric_limits<double>::infinity();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (applyLimits(raw[i], &seed))
+    {
+      const double distance = squaredDistance(raw[i], seed);
+      if (distance < best)
+      {
+        best = distance;
+        joints = raw[i];
+      }
+    }
+  }
+  return best < std::numeric_limits<double>::infinity();
+}
+
+std::size_t Kinematics::inverse(const FixedHomogTransf* poses, const std::size_t count, const JointVector& seed,
+                                JointVector* joints, std::uint8_t* solved) const
+{
+  JointVector previous = seed;
+  std::size_t reached = 0;
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    solved[i] = inverse(poses[i], previous, joints[i]) ? 1 : 0;
+    if (solved[i])
+    {
+      previous = joints[i];
+      ++reached;
+    }
+    else
+    {
+      joints[i] = previous;
+    }
+  }
+  return reached;
+}
+
+bool Kinematics::withinLimits(const JointVector& joints) const
+{
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    if (joints[i] < model_.joints[i].lower || joints[i] > model_.joints[i].upper)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace abb_kinematics
@@ -0,0 +1,214 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_kinematics/kinematics_server.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace abb_kinematics
+{
+namespace
+{
+const RobotModel& declareRobotModel(const rclcpp::Node::SharedPtr& node)
+{
+  const std::string name = node->declare_parameter<std::string>("robot_model", "abb_irb1200_5_90");
+  const RobotModel* model = findRobotModel(name);
+  if (!model)
+  {
+    std::string names;
+    for (const auto& known : robotModelNames())
+    {
+      names += " " + known;
+    }
+    throw std::runtime_error("Unknown robot model '" + name + "', expected one of:" + names);
+  }
+  return *model;
+}
+
+FixedHomogTransf toTransform(const geometry_msgs::msg::Pose& pose)
+{
+  FixedQuaternion rotation(pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+  rotation.normalize();
+  Vec3 translation;
+  translation[0] = pose.position.x;
+  translation[1] = pose.position.y;
+  translation[2] = pose.position.z;
+  return FixedHomogTransf(rotation.getRotMat(), translation);
+}
+
+geometry_msgs::msg::Pose toPose(const FixedHomogTransf& transform)
+{
+  const FixedQuaternion rotation = transform.getRotation().getQuaternion();
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = transform[0][3];
+  pose.position.y = transform[1][3];
+  pose.position.z = transform[2][3];
+  pose.orientation.w = rotation[0];
+  pose.orientation.x = rotation[1];
+  pose.orientation.y = rotation[2];
+  pose.orientation.z = rotation[3];
+  return pose;
+}
+}  // namespace
+
+KinematicsServer::KinematicsServer(const rclcpp::Node::SharedPtr& node)
+  : node_{ node }, kinematics_{ declareRobotModel(node) }, seed_{}
+{
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+
+  const std::string prefix = node_->declare_parameter<std::string>("prefix", "");
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    joint_names_.push_back(prefix + "joint_" + std::to_string(i + 1));
+  }
+  joint_command_.name = joint_names_;
+  joint_command_.position.resize(NUM_JOINTS);
+
+  compute_fk_service_ = node_->create_service<abb_kinematics_msgs::srv::ComputeFK>(
+      "~/compute_fk", std::bind(&KinematicsServer::computeFK, this, _1, _2));
+  compute_ik_service_ = node_->create_service<abb_kinematics_msgs::srv::ComputeIK>(
+      "~/compute_ik", std::bind(&KinematicsServer::computeIK, this, _1, _2));
+
+  target_pose_subscription_ = node_->create_subscription<geometry_msgs::msg::PoseStamped>(
+      "~/target_pose", rclcpp::SensorDataQoS(), std::bind(&KinematicsServer::targetPoseCallback, this, _1));
+  joint_state_subscription_ = node_->create_subscription<sensor_msgs::msg::JointState>(
+      "joint_states", rclcpp::SensorDataQoS(), std::bind(&KinematicsServer::jointStateCallback, this, _1));
+  joint_command_publisher_ = node_->create_publisher<sensor_msgs::msg::JointState>("~/joint_command", 10);
+
+  RCLCPP_INFO_STREAM(node_->get_logger(), "Kinematics of " << kinematics_.model().name << " ready");
+}
+
+void KinematicsServer::computeFK(const abb_kinematics_msgs::srv::ComputeFK::Request::SharedPtr request,
+                                 abb_kinematics_msgs::srv::ComputeFK::Response::SharedPtr response)
+{
+  if (request->joint_positions.size() % NUM_JOINTS != 0)
+  {
+    response->success = false;
+    response->message = "Expected " + std::to_string(NUM_JOINTS) + " joint positions per pose";
+    return;
+  }
+
+  const std::size_t count = request->joint_positions.size() / NUM_JOINTS;
+  joints_.resize(count);
+  poses_.resize(count);
+  for (std::size_t k = 0; k < count; ++k)
+  {
+    std::copy_n(&request->joint_positions[k * NUM_JOINTS], NUM_JOINTS, joints_[k].begin());
+  }
+  kinematics_.forward(joints_.data(), count, poses_.data());
+
+  response->poses.resize(count);
+  for (std::size_t k = 0; k < count; ++k)
+  {
+    response->poses[k] = toPose(poses_[k]);
+  }
+  response->success = true;
+}
+
+void KinematicsServer::computeIK(const abb_kinematics_msgs::srv::ComputeIK::Request::SharedPtr request,
+                                 abb_kinematics_msgs::srv::ComputeIK::Response::SharedPtr response)
+{
+  if (!request->seed.empty() && request->seed.size() != NUM_JOINTS)
+  {
+    response->success = false;
+    response->message = "Expected " + std::to_string(NUM_JOINTS) + " seed positions";
+    return;
+  }
+
+  const std::size_t count = request->poses.size();
+  poses_.resize(count);
+  for (std::size_t k = 0; k < count; ++k)
+  {
+    poses_[k] = toTransform(request->poses[k]);
+  }
+
+  JointVector seed = seed_;
+  if (!request->seed.empty())
+  {
+    std::copy_n(request->seed.begin(), NUM_JOINTS, seed.begin());
+  }
+
+  std::size_t reached = 0;
+  response->solution_counts.resize(count);
+  response->joint_positions.clear();
+  if (request->all_solutions)
+  {
+    Kinematics::Solutions solutions;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+      response->solution_counts[k] = kinematics_.inverse(poses_[k], solutions);
+      reached += (solutions.count > 0 ? 1 : 0);
+      for (std::size_t i = 0; i < solutions.count; ++i)
+      {
+        response->joint_positions.insert(response->joint_positions.end(), solutions.joints[i].begin(),
+                                         solutions.joints[i].end());
+      }
+    }
+  }
+  else
+  {
+    joints_.resize(count);
+    solved_.resize(count);
+    reached = kinematics_.inverse(poses_.data(), count, seed, joints_.data(), solved_.data());
+    response->joint_positions.reserve(count * NUM_JOINTS);
+    for (std::size_t k = 0; k < count; ++k)
+    {
+      response->solution_counts[k] = solved_[k];
+      if (solved_[k])
+      {
+        response->joint_positions.insert(response->joint_positions.end(), joints_[k].begin(), joints_[k].end());
+        seed_ = joints_[k];
+      }
+    }
+  }
+
+  response->success = (reached == count);
+  if (!response->success)
+  {
+    response->message = std::to_string(count - reached) + " of " + std::to_string(count) + " poses have no solution";
+  }
+}
+
+void KinematicsServer::targetPoseCallback(const geometry_msgs::msg::PoseStamped::SharedPtr message)
+{
+  JointVector joints;
+  if (!kinematics_.inverse(toTransform(message->pose), seed_, joints))
+  {
+    RCLCPP_WARN_THROTTLE(node_->get_logger(), *node_->get_clock(), 1000, "No solution for the target pose");
+    return;
+  }
+  seed_ = joints;
+
+  joint_command_.header.stamp = message->header.stamp;
+  std::copy(joints.begin(), joints.end(), joint_command_.position.begin());
+  joint_command_publisher_->publish(joint_command_);
+}
+
+void KinematicsServer::jointStateCallback(const sensor_msgs::msg::JointState::SharedPtr message)
+{
+  for (std::size_t i = 0; i < message->name.size() && i < message->position.size(); ++i)
+  {
+    for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+    {
+      if (message->name[i] == joint_names_[j])
+      {
+        seed_[j] = message->position[i];
+      }
+    }
+  }
+}
+}  // namespace abb_kinematics
@@ -0,0 +1,231 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "MatKernels.h"
+
+#if !defined(MATVEC_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define MATVEC_AVX2
+#elif !defined(MATVEC_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MATVEC_NEON
+#endif
+
+double *matKernels::allocate(const size_t n)
+{
+	void *p = 0;
+	if (posix_memalign(&p, MATVEC_ALIGNMENT, (n > 0 ? n : 1) * sizeof(double)) != 0)
+		return 0;
+	return (double *)p;
+}
+
+void matKernels::release(double *p)
+{
+	free(p);
+}
+
+const char *matKernels::instructionSet()
+{
+#if defined(MATVEC_AVX2) && defined(__FMA__)
+	return "AVX2+FMA";
+#elif defined(MATVEC_AVX2)
+	return "AVX2";
+#elif defined(MATVEC_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
+
+// y += alpha * x, on n elements
+static inline void axpy(const double alpha, const double *x, double *y, const int n)
+{
+	int j = 0;
+#if defined(MATVEC_AVX2)
+	__m256d a = _mm256_set1_pd(alpha);
+	for (; j + 4 <= n; j += 4)
+	{
+#if defined(__FMA__)
+		__m256d r = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j));
+#else
+		__m256d r = _mm256_add_pd(_mm256_mul_pd(a, _mm256_loadu_pd(x + j)), _mm256_loadu_pd(y + j));
+#endif
+		_mm256_storeu_pd(y + j, r);
+	}
+#elif defined(MATVEC_NEON)
+	float64x2_t a = vdupq_n_f64(alpha);
+	for (; j + 2 <= n; j += 2)
+		vst1q_f64(y + j, vfmaq_f64(vld1q_f64(y + j), a, vld1q_f64(x + j)));
+#endif
+	for (; j < n; j++)
+		y[j] += alpha * x[j];
+}
+
+// Dot product of n elements
+static inline double dot(const double *x, const double *y, const int n)
+{
+	int j = 0;
+	double e = 0.0;
+#if defined(MATVEC_AVX2)
+	__m256d s = _mm256_setzero_pd();
+	for (; j + 4 <= n; j += 4)
+	{
+#if defined(__FMA__)
+		s = _mm256_fmadd_pd(_mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j), s);
+#else
+		s = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j)), s);
+#endif
+	}
+	__m128d h = _mm_add_pd(_mm256_castpd256_pd128(s), _mm256_extractf128_pd(s, 1));
+	e = _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+#elif defined(MATVEC_NEON)
+	float64x2_t s = vdupq_n_f64(0.0);
+	for (; j + 2 <= n; j += 2)
+		s = vfmaq_f64(s, vld1q_f64(x + j), vld1q_f64(y + j));
+	e = vaddvq_f64(s);
+#endif
+	for (; j < n; j++)
+		e += x[j] * y[j];
+	return e;
+}
+
+void matKernels::gemm(const double *a, const double *b, double *c, const int n, const int m, const int p)
+{
+	// Rows of c are accumulated from rows of b, so that the inner loop
+	// runs over contiguous memory
+	memset(c, 0, n * p * sizeof(double));
+	for (int i = 0; i < n; i++)
+		for (int k = 0; k < m; k++)
+			axpy(a[i * m + k], b + k * p, c + i * p, p);
+}
+
+void matKernels::gemv(const double *a, const double *x, double *y, const int n, const int m)
+{
+	for (int i = 0; i < n; i++)
+		y[i] = dot(a + i * m, x, m);
+}
+
+int matKernels::lu(double *a, const int n, const int m, int *perm)
+{
+	int i, k, l;
+	int sign = 1;
+	for (i = 0; i < n; i++)
+		perm[i] = i;
+
+	for (i = 0; i < n - 1; i++)
+	{
+		// Look for the maximum pivoting element in the column
+		double maxPivot = fabs(a[i * m + i]);
+		int pivot = i;
+		for (k = i + 1; k < n; k++)
+		{
+			if (fabs(a[k * m + i]) > maxPivot)
+			{
+				maxPivot = fabs(a[k * m + i]);
+				pivot = k;
+			}
+		}
+
+		// Interchange the rows
+		if (pivot != i)
+		{
+			sign = -sign;
+			for (int j = 0; j < m; j++)
+			{
+				double aux = a[i * m + j];
+				a[i * m + j] = a[pivot * m + j];
+				a[pivot * m + j] = aux;
+			}
+			int aux = perm[pivot];
+			perm[pivot] = perm[i];
+			perm[i] = aux;
+		}
+
+		// Eliminate the column below the diagonal, keeping the multipliers
+		double d = a[i * m + i];
+		if (d == 0)
+			break;
+		for (l = i + 1; l < n; l++)
+		{
+			double f = a[l * m + i] / d;
+			a[l * m + i] = f;
+			axpy(-f, a + i * m + i + 1, a + l * m + i + 1, m - i - 1);
+		}
+	}
+	return sign;
+}
+
+void matKernels::luSolve(const double *lu, const int *perm, const int n, const double *b, double *x)
+{
+	int i;
+	// Forward substitution with the unit lower factor
+	for (i = 0; i < n; i++)
+		x[i] = b[perm[i]] - dot(lu + i * n, x, i);
+
+	// Back substitution with the upper factor
+	for (i = n - 1; i >= 0; i--)
+		x[i] = (x[i] - dot(lu + i * n + i + 1, x + i + 1, n - i - 1)) / lu[i * n + i];
+}
+
+void matKernels::homogMul(const double *a, const double *b, double *c)
+{
+#if defined(MATVEC_AVX2)
+	// One row of a 4x4 matrix per register
+	__m256d b0 = _mm256_loadu_pd(b);
+	__m256d b1 = _mm256_loadu_pd(b + 4);
+	__m256d b2 = _mm256_loadu_pd(b + 8);
+	__m256d b3 = _mm256_loadu_pd(b + 12);
+	for (int i = 0; i < 4; i++)
+	{
+		const double *r = a + 4 * i;
+		__m256d s = _mm256_mul_pd(_mm256_set1_pd(r[0]), b0);
+#if defined(__FMA__)
+		s = _mm256_fmadd_pd(_mm256_set1_pd(r[1]), b1, s);
+		s = _mm256_fmadd_pd(_mm256_set1_pd(r[2]), b2, s);
+		s = _mm256_fmadd_pd(_mm256_set1_pd(r[3]), b3, s);
+#else
+		s = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(r[1]), b1), s);
+		s = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(r[2]), b2), s);
+		s = _mm256_add_pd(_mm256_mul_pd(_mm256_set1_pd(r[3]), b3), s);
+#endif
+		_mm256_storeu_pd(c + 4 * i, s);
+	}
+#elif defined(MATVEC_NEON)
+	for (int i = 0; i < 4; i++)
+	{
+		const double *r = a + 4 * i;
+		for (int h = 0; h < 4; h += 2)
+		{
+			float64x2_t s = vmulq_n_f64(vld1q_f64(b + h), r[0]);
+			s = vfmaq_n_f64(s, vld1q_f64(b + 4 + h), r[1]);
+			s = vfmaq_n_f64(s, vld1q_f64(b + 8 + h), r[2]);
+			s = vfmaq_n_f64(s, vld1q_f64(b + 12 + h), r[3]);
+			vst1q_f64(c + 4 * i + h, s);
+		}
+	}
+#else
+	for (int i = 0; i < 4; i++)
+		for (int j = 0; j < 4; j++)
+			c[4 * i + j] = a[4 * i] * b[j] + a[4 * i + 1] * b[4 + j] + a[4 * i + 2] * b[8 + j] + a[4 * i + 3] * b[12 + j];
+#endif
+}
+
+void matKernels::homogChain(const double *t, const int count, double *result)
+{
+	double accum[16];
+	double next[16];
+	if (count <= 0)
+	{
+		memset(result, 0, 16 * sizeof(double));
+		result[0] = result[5] = result[10] = result[15] = 1.0;
+		return;
+	}
+	memcpy(accum, t, 16 * sizeof(double));
+	for (int k = 1; k < count; k++)
+	{
+		homogMul(accum, t + 16 * k, next);
+		memcpy(accum, next, 16 * sizeof(double));
+	}
+	memcpy(result, accum, 16 * sizeof(double));
+}
@@ -0,0 +1,43 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_kinematics/robot_model.hpp>
+
+// Generated at build time
+#include <abb_kinematics/robot_models.hpp>
+
+namespace abb_kinematics
+{
+const RobotModel* findRobotModel(const std::string& name)
+{
+  for (const auto& model : ROBOT_MODELS)
+  {
+    if (name == model.name || "abb_" + name == model.name)
+    {
+      return &model;
+    }
+  }
+  return nullptr;
+}
+
+std::vector<std::string> robotModelNames()
+{
+  std::vector<std::string> names;
+  for (const auto& model : ROBOT_MODELS)
+  {
+    names.emplace_back(model.name);
+  }
+  return names;
+}
+}  // namespace abb_kinematics
@@ -0,0 +1,113 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_kinematics/dls_solver.hpp>
+
+#include <cmath>
+
+using abb_kinematics::DLSSolver;
+using abb_kinematics::JointVector;
+using abb_kinematics::Kinematics;
+using abb_kinematics::NUM_JOINTS;
+
+namespace
+{
+const Kinematics& irb1200()
+{
+  static const Kinematics kinematics(*abb_kinematics::findRobotModel("abb_irb1200_5_90"));
+  return kinematics;
+}
+}  // namespace
+
+TEST(Jacobian, MatchesFiniteDifferences)
+{
+  const JointVector joints = { 0.4, 0.3, -0.6, 1.1, 0.7, -0.5 };
+  FixedMat<6, 6> jacobian;
+  const FixedHomogTransf pose = irb1200().jacobian(joints, jacobian);
+
+  const double step = 1e-7;
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    JointVector moved = joints;
+    moved[j] += step;
+    const FixedHomogTransf next = irb1200().forward(moved);
+
+    // Linear velocity from the translation, angular velocity from dR R^T
+    for (int i = 0; i < 3; ++i)
+    {
+      EXPECT_NEAR((next[i][3] - pose[i][3]) / step, jacobian[i][j], 1e-5);
+    }
+    const FixedMat<3, 3> rate = (next.getRotation() - pose.getRotation()) * pose.getRotation().transp() / step;
+    EXPECT_NEAR(rate[2][1], jacobian[3][j], 1e-5);
+    EXPECT_NEAR(rate[0][2], jacobian[4][j], 1e-5);
+    EXPECT_NEAR(rate[1][0], jacobian[5][j], 1e-5);
+  }
+}
+
+TEST(DLSSolver, FollowsTwist)
+{
+  DLSSolver solver(irb1200(), DLSSolver::Parameters());
+  solver.reset({ 0.0, 0.2, -0.3, 0.0, 0.8, 0.0 });
+  const FixedHomogTransf start = irb1200().forward(solver.joints());
+
+  // 2 s at 250 Hz along y
+  const double twist[6] = { 0.0, 0.05, 0.0, 0.0, 0.0, 0.0 };
+  for (int k = 0; k < 500; ++k)
+  {
+    solver.velocityStep(twist, 0.004);
+  }
+  const FixedHomogTransf end = irb1200().forward(solver.joints());
+  EXPECT_NEAR(end[0][3], start[0][3], 1e-3);
+  EXPECT_NEAR(end[1][3], start[1][3] + 0.1, 1e-3);
+  EXPECT_NEAR(end[2][3], start[2][3], 1e-3);
+}
+
+TEST(DLSSolver, ConvergesToPose)
+{
+  const JointVector goal = { 0.5, 0.4, -0.2, 0.6, 0.9, -0.4 };
+  const FixedHomogTransf target = irb1200().forward(goal);
+
+  DLSSolver solver(irb1200(), DLSSolver::Parameters());
+  solver.reset({ 0.3, 0.2, -0.4, 0.4, 0.7, -0.2 });
+  for (int k = 0; k < 2000; ++k)
+  {
+    solver.poseStep(target, 0.004);
+  }
+  const FixedHomogTransf pose = irb1200().forward(solver.joints());
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      EXPECT_NEAR(pose[i][j], target[i][j], 1e-6);
+    }
+  }
+}
+
+TEST(DLSSolver, BoundedAtSingularity)
+{
+  // Straight wrist: joints 4 and 6 aligned
+  DLSSolver solver(irb1200(), DLSSolver::Parameters());
+  solver.reset({ 0.0, 0.2, -0.3, 0.0, 0.0, 0.0 });
+
+  const double twist[6] = { 0.0, 0.0, 0.0, 0.0, 0.3, 0.2 };
+  const JointVector& velocities = solver.velocityStep(twist, 0.004);
+  EXPECT_LT(solver.minSingularValue(), 1e-6);
+  for (std::size_t j = 0; j < NUM_JOINTS; ++j)
+  {
+    EXPECT_TRUE(std::isfinite(velocities[j]));
+    EXPECT_LE(std::fabs(velocities[j]), irb1200().model().joints[j].velocity + 1e-9);
+  }
+}
@@ -0,0 +1,161 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_kinematics/kinematics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+using abb_kinematics::JointVector;
+using abb_kinematics::Kinematics;
+using abb_kinematics::NUM_JOINTS;
+
+namespace
+{
+double poseError(const FixedHomogTransf& a, const FixedHomogTransf& b)
+{
+  double error = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      error = std::fmax(error, std::fabs(a[i][j] - b[i][j]));
+    }
+  }
+  return error;
+}
+
+JointVector randomJoints(const Kinematics& kinematics, std::mt19937& generator)
+{
+  JointVector joints;
+  for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+  {
+    const auto& joint = kinematics.model().joints[i];
+    std::uniform_real_distribution<double> distribution(joint.lower, joint.upper);
+    joints[i] = distribution(generator);
+  }
+  // Keep away from the straight wrist, where joints 4 and 6 are not unique
+  if (std::fabs(joints[4]) < 0.05)
+  {
+    joints[4] = 0.05;
+  }
+  return joints;
+}
+}  // namespace
+
+TEST(RobotModel, GeneratedFromSupportPackages)
+{
+  const auto names = abb_kinematics::robotModelNames();
+  EXPECT_NE(std::find(names.begin(), names.end(), "abb_irb1200_5_90"), names.end());
+  EXPECT_NE(std::find(names.begin(), names.end(), "abb_irb4600_60_205"), names.end());
+  EXPECT_NE(abb_kinematics::findRobotModel("irb1200_5_90"), nullptr);
+  EXPECT_EQ(abb_kinematics::findRobotModel("irb9999"), nullptr);
+}
+
+TEST(Kinematics, ForwardAtZero)
+{
+  Kinematics kinematics(*abb_kinematics::findRobotModel("abb_irb1200_5_90"));
+  const FixedHomogTransf pose = kinematics.forward(JointVector{});
+
+  // Upper arm up, forearm forward, tool0 looking along x
+  EXPECT_NEAR(pose[0][3], 0.451 + 0.082, 1e-12);
+  EXPECT_NEAR(pose[1][3], 0.0, 1e-12);
+  EXPECT_NEAR(pose[2][3], 0.3991 + 0.448 + 0.042, 1e-12);
+  EXPECT_NEAR(pose[0][2], 1.0, 1e-12);
+}
+
+TEST(Kinematics, InverseRecoversForward)
+{
+  std::mt19937 generator(42);
+  for (const auto& name : abb_kinematics::robotModelNames())
+  {
+    Kinematics kinematics(*abb_kinematics::findRobotModel(name));
+    for (int sample = 0; sample < 500; ++sample)
+    {
+      const JointVector joints = randomJoints(kinematics, generator);
+      const FixedHomogTransf pose = kinematics.forward(joints);
+
+      Kinematics::Solutions solutions;
+      ASSERT_GT(kinematics.inverse(pose, solutions), 0u) << name;
+      for (std::size_t i = 0; i < solutions.count; ++i)
+      {
+        EXPECT_TRUE(kinematics.withinLimits(solutions.joints[i])) << name;
+        EXPECT_LT(poseError(kinematics.forward(solutions.joints[i]), pose), 1e-9) << name;
+      }
+
+      // Seeded with the original positions, the closest solution is the original one
+      JointVector closest;
+      ASSERT_TRUE(kinematics.inverse(pose, joints, closest)) << name;
+      for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+      {
+        EXPECT_NEAR(closest[i], joints[i], 1e-7) << name << " joint " << i;
+      }
+    }
+  }
+}
+
+TEST(Kinematics, StraightWrist)
+{
+  Kinematics kinematics(*abb_kinematics::findRobotModel("abb_irb1200_5_90"));
+  const JointVector joints = { 0.3, 0.2, -0.4, 0.7, 0.0, -0.2 };
+  const FixedHomogTransf pose = kinematics.forward(joints);
+
+  JointVector solution;
+  ASSERT_TRUE(kinematics.inverse(pose, joints, solution));
+  EXPECT_LT(poseError(kinematics.forward(solution), pose), 1e-9);
+  EXPECT_NEAR(solution[3], joints[3], 1e-9);
+  EXPECT_NEAR(solution[5], joints[5], 1e-9);
+}
+
+TEST(Kinematics, OutOfReach)
+{
+  Kinematics kinematics(*abb_kinematics::findRobotModel("abb_irb1200_5_90"));
+  FixedHomogTransf pose = kinematics.forward(JointVector{});
+  pose[0][3] = 3.0;
+
+  Kinematics::Solutions solutions;
+  EXPECT_EQ(kinematics.inverse(pose, solutions), 0u);
+}
+
+TEST(Kinematics, BatchFollowsPath)
+{
+  Kinematics kinematics(*abb_kinematics::findRobotModel("abb_irb4600_40_255"));
+
+  // A path through joint space, including turns of joints 4 and 6 beyond pi
+  const std::size_t count = 200;
+  std::vector<JointVector> path(count);
+  for (std::size_t k = 0; k < count; ++k)
+  {
+    const double t = static_cast<double>(k) / (count - 1);
+    path[k] = { -1.0 + 2.0 * t, 0.3, -0.5 + 0.4 * t, -4.0 + 8.0 * t, 0.6, 5.0 - 9.0 * t };
+  }
+  std::vector<FixedHomogTransf> poses(count);
+  kinematics.forward(path.data(), count, poses.data());
+
+  std::vector<JointVector> joints(count);
+  std::vector<std::uint8_t> solved(count);
+  ASSERT_EQ(kinematics.inverse(poses.data(), count, path[0], joints.data(), solved.data()), count);
+  for (std::size_t k = 0; k < count; ++k)
+  {
+    for (std::size_t i = 0; i < NUM_JOINTS; ++i)
+    {
+      EXPECT_NEAR(joints[k][i], path[k][i], 1e-7) << "pose " << k << " joint " << i;
+    }
+  }
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace abb_rws_client
+{
+/**
+ * \brief State of the chunked file transfers, i.e. the files being downloaded and the file being uploaded.
+ *
+ * At most MAX_DOWNLOADS downloads (keyed by filename, so that clients downloading different files alternately do not
+ * retrieve them again for every chunk) and one upload are held at a time. Each is limited to a maximum size, so that
+ * the memory used by the transfers is bounded.
+ */
+class FileTransfer
+{
+public:
+  /**
+   * \brief Default chunk size [bytes].
+   */
+  static constexpr std::size_t DEFAULT_CHUNK_SIZE{ 256 * 1024 };
+
+  /**
+   * \brief Maximum chunk size [bytes].
+   */
+  static constexpr std::size_t MAX_CHUNK_SIZE{ 4 * 1024 * 1024 };
+
+  /**
+   * \brief Maximum number of files held for downloading, beyond which the least recently used one is dropped.
+   */
+  static constexpr std::size_t MAX_DOWNLOADS{ 4 };
+
+  /**
+   * \brief Creates the transfer state.
+   *
+   * \param max_file_size [bytes] of files to transfer.
+   *
+   * \throw std::invalid_argument if max_file_size is 0.
+   */
+  explicit FileTransfer(std::size_t max_file_size);
+
+  /**
+   * \brief Checks if a file is being downloaded, and available from the given offset.
+   *
+   * \param filename of the file.
+   * \param offset [bytes] to read from.
+   *
+   * \return bool true if the file is available.
+   */
+  bool hasDownload(const std::string& filename, std::size_t offset) const;
+
+  /**
+   * \brief Starts downloading a file, replacing any earlier download of it.
+   *
+   * \param filename of the file.
+   * \param contents of the file, as retrieved from the robot controller.
+   *
+   * \return bool true if the file was accepted, false if it exceeds the maximum file size.
+   */
+  bool startDownload(const std::string& filename, std::string&& contents);
+
+  /**
+   * \brief Reads a chunk of a file being downloaded. Its download ends when the last chunk is read.
+   *
+   * \param filename of the file.
+   * \param offset [bytes] to read from. Must be available (see hasDownload).
+   * \param max_size [bytes] of the chunk, or 0 for the default chunk size.
+   * \param chunk for containing the chunk.
+   * \param total_size for containing the size [bytes] of the whole file.
+   *
+   * \return bool true if this was the last chunk.
+   */
+  bool readChunk(const std::string& filename, std::size_t offset, std::size_t max_size, std::string& chunk,
+                 std::size_t& total_size);
+
+  /**
+   * \brief Adds a chunk to the file being uploaded.
+   *
+   * \param filename of the file.
+   * \param offset [bytes] of the chunk. 0 restarts the upload, otherwise it must match uploadSize.
+   * \param chunk to add.
+   *
+   * \return bool true if the chunk was added, false if the offset does not match or the file would exceed the maximum
+   * file size.
+   */
+  bool addChunk(const std::string& filename, std::size_t offset, const std::string& chunk);
+
+  /**
+   * \brief Gets the number of bytes staged for a file being uploaded.
+   *
+   * \param filename of the file.
+   *
+   * \return std::size_t with the staged size [bytes] (0 if the file is not being uploaded).
+   */
+  std::size_t uploadSize(const std::string& filename) const;
+
+  /**
+   * \brief Ends the upload, and hands over the staged contents.
+   *
+   * \return std::string with the contents of the uploaded file.
+   */
+  std::string finishUpload();
+
+  /**
+   * \brief Compresses data with zlib.
+   *
+   * \param data to compress.
+   * \param compressed for containing the compressed data.
+   *
+   * \return bool true if the data was compressed.
+   */
+  static bool compress(const std::string& data, std::vector<uint8_t>& compressed);
+
+  /**
+   * \brief Decompresses zlib compressed data.
+   *
+   * \param compressed data to decompress.
+   * \param max_size [bytes] of the decompressed data.
+   * \param data for containing the decompressed data.
+   *
+   * \return bool true if the data was decompressed, false if it is invalid or exceeds max_size.
+   */
+  static bool decompress(const std::vector<uint8_t>& compressed, std::size_t max_size, std::string& data);
+
+private:
+  /**
+   * \brief A file being downloaded.
+   */
+  struct Download
+  {
+    std::string filename;
+    std::string contents;
+  };
+
+  /**
+   * \brief Finds the download of a file.
+   *
+   * \param filename of the file.
+   *
+   * \return std::list<Download>::iterator to the download, or the end if the file is not being downloaded.
+   */
+  std::list<Download>::iterator findDownload(const std::string& filename);
+  std::list<Download>::const_iterator findDownload(const std::string& filename) const;
+
+  std::size_t max_file_size_;
+
+  /**
+   * \brief The downloads, most recently used first.
+   */
+  std::list<Download> downloads_;
+
+  std::string upload_filename_;
+  std::string upload_contents_;
+};
+}  // namespace abb_rws_client
@@ -0,0 +1,126 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <abb_egm_rws_managers/system_data_parser.h>
+#include <abb_robot_msgs/msg/system_state.hpp>
+#include <abb_rws_client_msgs/msg/fleet_state.hpp>
+
+#include <abb_rws_client/poll_scheduler.hpp>
+#include <abb_rws_client/rws_session_pool.hpp>
+
+namespace abb_rws_client
+{
+/**
+ * \brief Polls the system states of many robot controllers, and publishes them combined as a fleet state.
+ *
+ * It replaces a state publisher per controller (and a process each) with one node: every controller has an RWS
+ * session of its own, and the polls of all controllers are run on a shared pool of threads, with their deadlines
+ * staggered over the polling period. A slow or unreachable controller therefore only occupies one thread at a time,
+ * and the fleet state then reports it as disconnected or stale, with the age of its last successful poll.
+ */
+class FleetStateAggregator
+{
+public:
+  /**
+   * \brief Creates the aggregator, and starts polling.
+   *
+   * The controllers are read from the node's parameters: "controllers" lists their names, and for each name
+   * "<name>.robot_ip" and "<name>.robot_port" give its RWS server. No connection is made before the first poll.
+   *
+   * \param node ROS 2 node.
+   *
+   * \throw std::runtime_error if a controller has no IP address, or a rate is not positive.
+   */
+  explicit FleetStateAggregator(const rclcpp::Node::SharedPtr& node);
+
+  /**
+   * \brief Stops polling.
+   */
+  ~FleetStateAggregator();
+
+private:
+  /**
+   * \brief A polled robot controller.
+   */
+  struct Controller
+  {
+    std::string name;
+    std::string robot_ip;
+    unsigned short robot_port = 0;
+
+    std::unique_ptr<RWSSessionPool> sessions;
+
+    /**
+     * \brief Runtime data, only used by the controller's polls (which never overlap). No motion data is collected,
+     * since the fleet state only holds the system states.
+     */
+    abb::robot::SystemStateData system_state_data;
+    abb::robot::MotionData motion_data;
+
+    /**
+     * \brief Serializes the state below between the polls and the publishing.
+     */
+    std::mutex mutex;
+    abb_robot_msgs::msg::SystemState system_state;
+    bool connected = false;
+    bool updated = false;
+    std::uint32_t failed_polls = 0;
+    rclcpp::Time last_update;
+  };
+
+  /**
+   * \brief Polls the system state of a controller via RWS.
+   *
+   * \param controller to poll.
+   */
+  void poll(Controller& controller);
+
+  /**
+   * \brief Timer callback for publishing the fleet state.
+   */
+  void publish();
+
+  rclcpp::Node::SharedPtr node_;
+
+  std::vector<std::unique_ptr<Controller>> controllers_;
+
+  /**
+   * \brief Age [s] above which the system state of a controller is not fresh.
+   */
+  double stale_timeout_;
+
+  /**
+   * \brief Publisher for the fleet state, and its message, which is reused between publications.
+   */
+  rclcpp::Publisher<abb_rws_client_msgs::msg::FleetState>::SharedPtr fleet_state_pub_;
+  abb_rws_client_msgs::msg::FleetState fleet_state_msg_;
+  rclcpp::TimerBase::SharedPtr timer_;
+
+  /**
+   * \brief Runs the polls, declared last so that its threads are stopped before the controllers are destroyed.
+   */
+  std::unique_ptr<PollScheduler> scheduler_;
+};
+}  // namespace abb_rws_client
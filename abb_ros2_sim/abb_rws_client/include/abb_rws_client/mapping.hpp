@@ -102,6 +102,14 @@ unsigned int mapStateMachineSGCommand(const unsigned int command);
  */
 abb_rapid_msgs::msg::Pos map(const rws::Pos& rws_pos);
 
+/**
+ * \brief Maps a RAPID 'pos' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_pos to map.
+ * \param[out] ros_pos for containing the mapped data.
+ */
+void map(const rws::Pos& rws_pos, abb_rapid_msgs::msg::Pos& ros_pos);
+
 /**
  * \brief Maps a RAPID 'orient' data type from RWS to ROS representation.
  *
@@ -111,6 +119,14 @@ abb_rapid_msgs::msg::Pos map(const rws::Pos& rws_pos);
  */
 abb_rapid_msgs::msg::Orient map(const rws::Orient& rws_orient);
 
+/**
+ * \brief Maps a RAPID 'orient' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_orient to map.
+ * \param[out] ros_orient for containing the mapped data.
+ */
+void map(const rws::Orient& rws_orient, abb_rapid_msgs::msg::Orient& ros_orient);
+
 /**
  * \brief Maps a RAPID 'pose' data type from RWS to ROS representation.
  *
@@ -120,6 +136,14 @@ abb_rapid_msgs::msg::Orient map(const rws::Orient& rws_orient);
  */
 abb_rapid_msgs::msg::Pose map(const rws::Pose& rws_pose);
 
+/**
+ * \brief Maps a RAPID 'pose' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_pose to map.
+ * \param[out] ros_pose for containing the mapped data.
+ */
+void map(const rws::Pose& rws_pose, abb_rapid_msgs::msg::Pose& ros_pose);
+
 /**
  * \brief Maps a RAPID 'loaddata' data type from RWS to ROS representation.
  *
@@ -129,6 +153,14 @@ abb_rapid_msgs::msg::Pose map(const rws::Pose& rws_pose);
  */
 abb_rapid_msgs::msg::LoadData map(const rws::LoadData& rws_loaddata);
 
+/**
+ * \brief Maps a RAPID 'loaddata' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_loaddata to map.
+ * \param[out] ros_loaddata for containing the mapped data.
+ */
+void map(const rws::LoadData& rws_loaddata, abb_rapid_msgs::msg::LoadData& ros_loaddata);
+
 /**
  * \brief Maps a RAPID 'tooldata' data type from RWS to ROS representation.
  *
@@ -138,6 +170,14 @@ abb_rapid_msgs::msg::LoadData map(const rws::LoadData& rws_loaddata);
  */
 abb_rapid_msgs::msg::ToolData map(const rws::ToolData& rws_tooldata);
 
+/**
+ * \brief Maps a RAPID 'tooldata' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_tooldata to map.
+ * \param[out] ros_tooldata for containing the mapped data.
+ */
+void map(const rws::ToolData& rws_tooldata, abb_rapid_msgs::msg::ToolData& ros_tooldata);
+
 /**
  * \brief Maps a RAPID 'wobjdata' data type from RWS to ROS representation.
  *
@@ -147,6 +187,14 @@ abb_rapid_msgs::msg::ToolData map(const rws::ToolData& rws_tooldata);
  */
 abb_rapid_msgs::msg::WObjData map(const rws::WObjData& rws_wobjdata);
 
+/**
+ * \brief Maps a RAPID 'wobjdata' data type from RWS to ROS representation, in place.
+ *
+ * \param rws_wobjdata to map.
+ * \param[out] ros_wobjdata for containing the mapped data.
+ */
+void map(const rws::WObjData& rws_wobjdata, abb_rapid_msgs::msg::WObjData& ros_wobjdata);
+
 /**
  * \brief Maps a RobotWare StateMachine Add-In RAPID 'EGMSettings' data type from RWS to ROS
  * representation.
@@ -157,6 +205,16 @@ abb_rapid_msgs::msg::WObjData map(const rws::WObjData& rws_wobjdata);
  */
 abb_rapid_sm_addin_msgs::msg::EGMSettings map(const rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings);
 
+/**
+ * \brief Maps a RobotWare StateMachine Add-In RAPID 'EGMSettings' data type from RWS to ROS
+ * representation, in place (i.e. without temporary messages for the nested data).
+ *
+ * \param rws_egm_settings to map.
+ * \param[out] ros_egm_settings for containing the mapped data.
+ */
+void map(const rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings,
+         abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings);
+
 /**
  * \brief Maps a RAPID 'pos' data type from ROS to RWS representation.
  *
@@ -166,6 +224,14 @@ abb_rapid_sm_addin_msgs::msg::EGMSettings map(const rws::RWSStateMachineInterfac
  */
 rws::Pos map(const abb_rapid_msgs::msg::Pos& ros_pos);
 
+/**
+ * \brief Maps a RAPID 'pos' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_pos to map.
+ * \param[out] rws_pos for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::Pos& ros_pos, rws::Pos& rws_pos);
+
 /**
  * \brief Maps a RAPID 'orient' data type from ROS to RWS representation.
  *
@@ -175,6 +241,14 @@ rws::Pos map(const abb_rapid_msgs::msg::Pos& ros_pos);
  */
 rws::Orient map(const abb_rapid_msgs::msg::Orient& ros_orient);
 
+/**
+ * \brief Maps a RAPID 'orient' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_orient to map.
+ * \param[out] rws_orient for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::Orient& ros_orient, rws::Orient& rws_orient);
+
 /**
  * \brief Maps a RAPID 'pose' data type from ROS to RWS representation.
  *
@@ -184,6 +258,14 @@ rws::Orient map(const abb_rapid_msgs::msg::Orient& ros_orient);
  */
 rws::Pose map(const abb_rapid_msgs::msg::Pose& ros_pose);
 
+/**
+ * \brief Maps a RAPID 'pose' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_pose to map.
+ * \param[out] rws_pose for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::Pose& ros_pose, rws::Pose& rws_pose);
+
 /**
  * \brief Maps a RAPID 'loaddata' data type from ROS to RWS representation.
  *
@@ -193,6 +275,14 @@ rws::Pose map(const abb_rapid_msgs::msg::Pose& ros_pose);
  */
 rws::LoadData map(const abb_rapid_msgs::msg::LoadData& ros_loaddata);
 
+/**
+ * \brief Maps a RAPID 'loaddata' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_loaddata to map.
+ * \param[out] rws_loaddata for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::LoadData& ros_loaddata, rws::LoadData& rws_loaddata);
+
 /**
  * \brief Maps a RAPID 'tooldata' data type from ROS to RWS representation.
  *
@@ -202,6 +292,14 @@ rws::LoadData map(const abb_rapid_msgs::msg::LoadData& ros_loaddata);
  */
 rws::ToolData map(const abb_rapid_msgs::msg::ToolData& ros_tooldata);
 
+/**
+ * \brief Maps a RAPID 'tooldata' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_tooldata to map.
+ * \param[out] rws_tooldata for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::ToolData& ros_tooldata, rws::ToolData& rws_tooldata);
+
 /**
  * \brief Maps a RAPID 'wobjdata' data type from ROS to RWS representation.
  *
@@ -211,6 +309,14 @@ rws::ToolData map(const abb_rapid_msgs::msg::ToolData& ros_tooldata);
  */
 rws::WObjData map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata);
 
+/**
+ * \brief Maps a RAPID 'wobjdata' data type from ROS to RWS representation, in place.
+ *
+ * \param ros_wobjdata to map.
+ * \param[out] rws_wobjdata for containing the mapped data.
+ */
+void map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata, rws::WObjData& rws_wobjdata);
+
 /**
  * \brief Maps a RobotWare StateMachine Add-In RAPID 'EGMSettings' data type from ROS to RWS
  * representation.
@@ -221,6 +327,16 @@ rws::WObjData map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata);
  */
 rws::RWSStateMachineInterface::EGMSettings map(const abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings);
 
+/**
+ * \brief Maps a RobotWare StateMachine Add-In RAPID 'EGMSettings' data type from ROS to RWS
+ * representation, in place (i.e. without temporary RAPID records for the nested data).
+ *
+ * \param ros_egm_settings to map.
+ * \param[out] rws_egm_settings for containing the mapped data.
+ */
+void map(const abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings,
+         rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings);
+
 /**
  * \brief Maps EGM state to ROS representation.
  *
@@ -0,0 +1,109 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace abb_rws_client
+{
+/**
+ * \brief Runs periodic tasks (e.g. the polls of many robot controllers) on a shared pool of threads.
+ *
+ * Each task has a deadline, and the threads run the task with the earliest deadline that is due. The first deadlines
+ * of the tasks are staggered over their period, so that polls of the same rate are spread evenly instead of all
+ * being due at the same time. A task is never run concurrently with itself: its next deadline is only scheduled once
+ * it returned, and the deadlines it missed meanwhile are skipped instead of being caught up in a burst.
+ */
+class PollScheduler
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * \brief Creates a scheduler, without starting its threads yet.
+   *
+   * \param num_threads number of threads running the tasks (at least one).
+   */
+  explicit PollScheduler(std::size_t num_threads);
+
+  PollScheduler(const PollScheduler&) = delete;
+  PollScheduler& operator=(const PollScheduler&) = delete;
+
+  /**
+   * \brief Stops the threads, after their current tasks.
+   */
+  ~PollScheduler();
+
+  /**
+   * \brief Adds a periodic task, before the scheduler is started.
+   *
+   * \param task to run, which should not throw (exceptions are swallowed, to keep the thread alive).
+   * \param period between the deadlines of the task.
+   */
+  void add(std::function<void()> task, Clock::duration period);
+
+  /**
+   * \brief Starts the threads, with the first deadline of task i of n at i / n of its period from now.
+   */
+  void start();
+
+  /**
+   * \brief Stops the threads, after their current tasks.
+   */
+  void stop();
+
+private:
+  /**
+   * \brief A scheduled deadline of a task.
+   */
+  struct Deadline
+  {
+    Clock::time_point time;
+    std::size_t task;
+
+    bool operator>(const Deadline& other) const
+    {
+      return time > other.time;
+    }
+  };
+
+  /**
+   * \brief Loop of each thread.
+   */
+  void work();
+
+  const std::size_t num_threads_;
+
+  std::vector<std::function<void()>> tasks_;
+  std::vector<Clock::duration> periods_;
+
+  /**
+   * \brief Deadlines of the tasks that are not running, the earliest first.
+   */
+  std::priority_queue<Deadline, std::vector<Deadline>, std::greater<Deadline>> deadlines_;
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  bool stopping_ = false;
+  std::vector<std::thread> threads_;
+};
+}  // namespace abb_rws_client
@@ -0,0 +1,110 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <abb_robot_msgs/msg/rapid_symbol_path.hpp>
+
+namespace abb_rws_client
+{
+/**
+ * \brief Least recently used cache of resolved RAPID symbols, i.e. of symbols whose RAPID data type is known.
+ *
+ * A typed RWS read or write of a RAPID symbol first asks the robot controller for the symbol's properties, to verify
+ * its data type. For a cached symbol that request is skipped, and the value is transferred as a raw string instead.
+ *
+ * The cache must be cleared when the RAPID program may have changed (e.g. on a program pointer reset, or when modules
+ * are loaded), since a symbol may then have been removed or redeclared with another data type.
+ */
+class RAPIDSymbolCache
+{
+public:
+  /**
+   * \brief Creates an empty cache.
+   *
+   * \param capacity maximum number of cached symbols (at least one).
+   */
+  explicit RAPIDSymbolCache(std::size_t capacity);
+
+  /**
+   * \brief Checks if a symbol is cached with a RAPID data type, and marks it as recently used if so.
+   *
+   * \param path of the symbol.
+   * \param data_type expected RAPID data type (e.g. "num").
+   *
+   * \return bool true if the symbol is cached with the data type.
+   */
+  bool contains(const abb_robot_msgs::msg::RAPIDSymbolPath& path, const std::string& data_type);
+
+  /**
+   * \brief Gets the current generation of the cache, which changes whenever the cache is cleared.
+   *
+   * \return std::uint64_t with the generation.
+   */
+  std::uint64_t generation() const;
+
+  /**
+   * \brief Caches a symbol, evicting the least recently used symbol if the cache is full.
+   *
+   * \param path of the symbol.
+   * \param data_type RAPID data type of the symbol.
+   * \param generation of the cache before the data type was resolved, so that a symbol resolved before the cache was
+   * cleared is not cached.
+   */
+  void insert(const abb_robot_msgs::msg::RAPIDSymbolPath& path, const std::string& data_type,
+              std::uint64_t generation);
+
+  /**
+   * \brief Removes a symbol, e.g. after a failed request for it.
+   *
+   * \param path of the symbol.
+   */
+  void erase(const abb_robot_msgs::msg::RAPIDSymbolPath& path);
+
+  /**
+   * \brief Removes all symbols.
+   */
+  void clear();
+
+private:
+  /**
+   * \brief A cached symbol.
+   */
+  struct Entry
+  {
+    std::string key;
+    std::string data_type;
+  };
+
+  static std::string makeKey(const abb_robot_msgs::msg::RAPIDSymbolPath& path);
+
+  const std::size_t capacity_;
+
+  mutable std::mutex mutex_;
+
+  /**
+   * \brief Cached symbols, the most recently used first.
+   */
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  std::uint64_t generation_ = 0;
+};
+}  // namespace abb_rws_client
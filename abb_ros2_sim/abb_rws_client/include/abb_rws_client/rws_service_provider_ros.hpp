@@ -40,6 +40,9 @@
 
 #pragma once
 
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -49,6 +52,7 @@
 #include <abb_egm_rws_managers/system_data_parser.h>
 
 #include <abb_rapid_sm_addin_msgs/msg/runtime_state.hpp>
+#include <abb_robot_msgs/msg/service_responses.hpp>
 #include <abb_robot_msgs/msg/system_state.hpp>
 
 #include <abb_rapid_sm_addin_msgs/srv/get_egm_settings.hpp>
@@ -75,6 +79,15 @@
 #include <abb_robot_msgs/srv/set_speed_ratio.hpp>
 #include <abb_robot_msgs/srv/trigger_with_result_code.hpp>
 
+#include <abb_rws_client_msgs/srv/get_file_chunk.hpp>
+#include <abb_rws_client_msgs/srv/get_rapid_symbols.hpp>
+#include <abb_rws_client_msgs/srv/set_file_chunk.hpp>
+#include <abb_rws_client_msgs/srv/set_rapid_symbols.hpp>
+
+#include <abb_rws_client/file_transfer.hpp>
+#include <abb_rws_client/rapid_symbol_cache.hpp>
+#include <abb_rws_client/rws_session_pool.hpp>
+
 namespace abb_rws_client
 {
 class RWSServiceProviderROS
@@ -86,14 +99,91 @@ public:
    * \param node ROS 2 node.
    * \param robot_ip IP address for the robot controller's RWS server.
    * \param robot_poty Port number for the robot controller's RWS server.
+   * \param sessions pool of RWS sessions, shared with e.g. the state publisher (nullptr for a pool of its own).
    */
-  RWSServiceProviderROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip, unsigned short robot_port);
+  RWSServiceProviderROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip, unsigned short robot_port,
+                        std::shared_ptr<RWSSessionPool> sessions = nullptr);
 
   RWSServiceProviderROS() = delete;
 
   virtual ~RWSServiceProviderROS() = default;
 
 private:
+  /**
+   * \brief Categories of services, which are executed independently of each other in concurrent mode.
+   */
+  enum class ServiceCategory
+  {
+    QUERY,          ///< Read-only queries (e.g. RAPID symbols and the speed ratio).
+    IO,             ///< IO-signals, and writes of RAPID symbols and settings.
+    FILE_TRANSFER,  ///< File transfers.
+    MOTION          ///< Motion-critical commands (e.g. motors, RAPID execution and EGM).
+  };
+
+  /**
+   * \brief Number of service categories.
+   */
+  static constexpr std::size_t NUM_SERVICE_CATEGORIES{ 4 };
+
+  /**
+   * \brief Sets up the callback groups for the service categories.
+   *
+   * \param concurrent whether each category gets its own callback group. Otherwise all services share the node's
+   * default callback group.
+   */
+  void initializeCallbackGroups(bool concurrent);
+
+  /**
+   * \brief Gets the callback group for a service category.
+   *
+   * \param category of the service.
+   *
+   * \return rclcpp::CallbackGroup::SharedPtr for the category (nullptr for the node's default group).
+   */
+  rclcpp::CallbackGroup::SharedPtr callbackGroup(ServiceCategory category) const;
+
+  /**
+   * \brief Creates a service, whose requests are recorded in the endpoint metrics of the session pool.
+   *
+   * A request counts as an error if it does not succeed, i.e. its result code is not RC_SUCCESS.
+   *
+   * \param name of the service, e.g. "~/get_io_signal" (recorded as endpoint "get_io_signal").
+   * \param callback for the requests.
+   * \param category of the service.
+   *
+   * \return rclcpp::ServiceBase::SharedPtr with the service.
+   */
+  template <typename ServiceT>
+  rclcpp::ServiceBase::SharedPtr
+  createService(const std::string& name,
+                bool (RWSServiceProviderROS::*callback)(const typename ServiceT::Request::SharedPtr,
+                                                        typename ServiceT::Response::SharedPtr),
+                ServiceCategory category)
+  {
+    EndpointMetrics& metrics = sessions_->endpoint(name.compare(0, 2, "~/") == 0 ? name.substr(2) : name);
+    return node_->create_service<ServiceT>(
+        name,
+        [this, callback, &metrics](const typename ServiceT::Request::SharedPtr req,
+                                   typename ServiceT::Response::SharedPtr res) {
+          const auto start = std::chrono::steady_clock::now();
+          const auto elapsed_ns = [&start]() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                .count();
+          };
+          try
+          {
+            (this->*callback)(req, res);
+          }
+          catch (...)
+          {
+            metrics.record(elapsed_ns(), true);
+            throw;
+          }
+          metrics.record(elapsed_ns(), res->result_code != abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS);
+        },
+        rmw_qos_profile_services_default, callbackGroup(category));
+  }
+
   /**
    * \brief Callback for robot controller system state messages.
    *
@@ -122,6 +212,20 @@ private:
    */
   bool getFileContents(const abb_robot_msgs::srv::GetFileContents::Request::SharedPtr req,
                        abb_robot_msgs::srv::GetFileContents::Response::SharedPtr res);
+
+  /**
+   * \brief Gets a chunk of a file, for transferring large files piece by piece.
+   *
+   * The file must be located in the robot controller's home directory. It is retrieved from the robot controller when
+   * the transfer starts (or if it is not held anymore when resuming), and then served in chunks.
+   *
+   * \param req request to process.
+   * \param res response for containing the result.
+   *
+   * \return bool true if the request was processed.
+   */
+  bool getFileChunk(const abb_rws_client_msgs::srv::GetFileChunk::Request::SharedPtr req,
+                    abb_rws_client_msgs::srv::GetFileChunk::Response::SharedPtr res);
   /**
    * \brief Gets an IO-signal.
    *
@@ -188,6 +292,20 @@ private:
   bool getRAPIDSymbol(const abb_robot_msgs::srv::GetRAPIDSymbol::Request::SharedPtr req,
                       abb_robot_msgs::srv::GetRAPIDSymbol::Response::SharedPtr res);
 
+  /**
+   * \brief Gets several RAPID symbols, in one batch.
+   *
+   * All symbols are read within one RWS service call, i.e. on the same RWS session and without other requests
+   * interleaving.
+   *
+   * \param req request to process.
+   * \param res response for containing the results.
+   *
+   * \return bool true if the request was processed.
+   */
+  bool getRAPIDSymbols(const abb_rws_client_msgs::srv::GetRAPIDSymbols::Request::SharedPtr req,
+                       abb_rws_client_msgs::srv::GetRAPIDSymbols::Response::SharedPtr res);
+
   /**
    * \brief Gets a description of the connected robot controller.
    *
@@ -264,6 +382,20 @@ private:
   bool setFileContents(const abb_robot_msgs::srv::SetFileContents::Request::SharedPtr req,
                        abb_robot_msgs::srv::SetFileContents::Response::SharedPtr res);
 
+  /**
+   * \brief Sets a chunk of a file, for transferring large files piece by piece.
+   *
+   * The chunks are staged until the last one is received, and the whole file is then uploaded to the robot
+   * controller's home directory.
+   *
+   * \param req request to process.
+   * \param res response for containing the result.
+   *
+   * \return bool true if the request was processed.
+   */
+  bool setFileChunk(const abb_rws_client_msgs::srv::SetFileChunk::Request::SharedPtr req,
+                    abb_rws_client_msgs::srv::SetFileChunk::Response::SharedPtr res);
+
   /**
    * \brief Sets an IO-signal.
    *
@@ -352,6 +484,20 @@ private:
   bool setRAPIDSymbol(const abb_robot_msgs::srv::SetRAPIDSymbol::Request::SharedPtr req,
                       abb_robot_msgs::srv::SetRAPIDSymbol::Response::SharedPtr res);
 
+  /**
+   * \brief Sets several RAPID symbols, in one batch.
+   *
+   * All symbols are written within one RWS service call, i.e. on the same RWS session and without other requests
+   * interleaving.
+   *
+   * \param req request to process.
+   * \param res response for containing the results.
+   *
+   * \return bool true if the request was processed.
+   */
+  bool setRAPIDSymbols(const abb_rws_client_msgs::srv::SetRAPIDSymbols::Request::SharedPtr req,
+                       abb_rws_client_msgs::srv::SetRAPIDSymbols::Response::SharedPtr res);
+
   /**
    * \brief Sets the controller speed ratio (in the range [0, 100]) for RAPID motions.
    *
@@ -630,21 +776,70 @@ private:
   bool verifyRAPIDStopped(uint16_t& result_code, std::string& message);
 
   /**
-   * \brief Verify that the RWS communication manager is ready.
+   * \brief Verify that the RWS sessions are ready.
    *
    * \param[out] result_code numerical error code.
    * \param[out] message container for possible error message.
    *
-   * \return bool true if the RWS communication manager is ready.
+   * \return bool true if the RWS sessions are ready.
    */
   bool verifyRWSManagerReady(uint16_t& result_code, std::string& message);
 
+  /**
+   * \brief Sets the overall result of a batch request from the results of its items.
+   *
+   * \param result_codes of the items.
+   * \param result_code for containing the overall result code.
+   * \param message for containing the overall result message.
+   */
+  void setBatchResult(const std::vector<uint16_t>& result_codes, uint16_t& result_code, std::string& message);
+
+  /**
+   * \brief Reads a typed RAPID symbol, skipping the data type verification if the symbol is cached.
+   *
+   * \param interface of the RWS session.
+   * \param path of the symbol.
+   * \param[out] data for containing the value.
+   *
+   * \return bool true if the symbol was read.
+   */
+  bool getRAPIDSymbolData(abb::rws::RWSStateMachineInterface& interface,
+                          const abb_robot_msgs::msg::RAPIDSymbolPath& path, abb::rws::RAPIDSymbolDataAbstract& data);
+
+  /**
+   * \brief Writes a typed RAPID symbol, skipping the data type verification if the symbol is cached.
+   *
+   * \param interface of the RWS session.
+   * \param path of the symbol.
+   * \param data with the value.
+   *
+   * \return bool true if the symbol was written.
+   */
+  bool setRAPIDSymbolData(abb::rws::RWSStateMachineInterface& interface,
+                          const abb_robot_msgs::msg::RAPIDSymbolPath& path,
+                          const abb::rws::RAPIDSymbolDataAbstract& data);
+
   rclcpp::Node::SharedPtr node_;
 
   /**
-   * \brief Manager for handling RWS communication with the robot controller.
+   * \brief Pool of RWS sessions for handling RWS communication with the robot controller.
+   */
+  std::shared_ptr<RWSSessionPool> sessions_;
+
+  /**
+   * \brief Callback groups for the service categories (nullptr for the node's default group).
+   */
+  std::vector<rclcpp::CallbackGroup::SharedPtr> callback_groups_;
+
+  /**
+   * \brief State of the chunked file transfers (only accessed by the file transfer services).
+   */
+  std::unique_ptr<FileTransfer> file_transfer_;
+
+  /**
+   * \brief Data types of recently used RAPID symbols (nullptr if disabled).
    */
-  abb::robot::RWSManager rws_manager_;
+  std::unique_ptr<RAPIDSymbolCache> rapid_symbol_cache_;
 
   /**
    * \brief Description of the connected robot controller.
@@ -680,6 +875,11 @@ private:
    * \brief The latest known RobotWare StateMachine Add-In runtime state.
    */
   abb_rapid_sm_addin_msgs::msg::RuntimeState runtime_state_;
+
+  /**
+   * \brief Protects the latest known states, which are read by concurrently executed services.
+   */
+  std::mutex state_mutex_;
 };
 
 }  // namespace abb_rws_client
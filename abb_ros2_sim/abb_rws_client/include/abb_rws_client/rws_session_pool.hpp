@@ -0,0 +1,226 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <abb_egm_rws_managers/rws_manager.h>
+#include <abb_hardware_interface/description_cache.hpp>
+#include <abb_hardware_interface/latency_histogram.hpp>
+
+namespace abb_rws_client
+{
+/**
+ * \brief Request counters of one RWS endpoint (e.g. a ROS service, or a poll of the state publisher).
+ */
+struct EndpointMetrics
+{
+  /**
+   * \brief Records a request.
+   *
+   * \param latency_ns of the request [ns].
+   * \param failed whether the request failed.
+   */
+  void record(std::int64_t latency_ns, bool failed)
+  {
+    latency.record(latency_ns);
+    if (failed)
+    {
+      errors.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  abb_hardware_interface::LatencyHistogram latency;
+  std::atomic<std::uint64_t> errors{ 0 };
+};
+
+/**
+ * \brief Snapshot of an endpoint's counters.
+ */
+struct EndpointSummary
+{
+  std::string name;
+  abb_hardware_interface::LatencyHistogram::Summary latency;
+  std::uint64_t errors = 0;
+};
+
+/**
+ * \brief Pool of RWS sessions, shared by the services and the state publisher of an RWS client.
+ *
+ * Each session is an RWS manager, which logs in with its first request and then keeps its (keep-alive) HTTP
+ * connection and session cookie. Sessions are only created when all existing ones are busy, so a client whose
+ * requests never overlap logs in once, and concurrent requests never wait for each other up to the pool size.
+ *
+ * A session whose request threw (e.g. because the connection was lost, or the robot controller dropped the login)
+ * is replaced by a fresh one the next time it is handed out, i.e. sessions re-authenticate lazily.
+ *
+ * The pool also keeps latency and error counters per endpoint, for the diagnostics.
+ */
+class RWSSessionPool
+{
+public:
+  /**
+   * \brief Creates a pool, without logging in yet.
+   *
+   * \param robot_ip IP address for the robot controller's RWS server.
+   * \param robot_port Port number for the robot controller's RWS server.
+   * \param max_sessions maximum number of concurrent RWS sessions (at least one).
+   */
+  RWSSessionPool(const std::string& robot_ip, unsigned short robot_port, std::size_t max_sessions);
+
+  RWSSessionPool(const RWSSessionPool&) = delete;
+  RWSSessionPool& operator=(const RWSSessionPool&) = delete;
+
+  /**
+   * \brief Gets the description of the robot controller, which is only retrieved for the first caller.
+   *
+   * \param robot_id user nickname/identifier of the robot controller.
+   * \param no_connection_timeout whether to wait indefinitely for the robot controller.
+   * \param cache_dir directory of the description cache (empty to always retrieve the description via RWS).
+   *
+   * \return abb::robot::RobotControllerDescription of the robot controller.
+   *
+   * \throw std::runtime_error if the description could not be retrieved.
+   */
+  abb::robot::RobotControllerDescription describe(const std::string& robot_id, bool no_connection_timeout,
+                                                  const std::string& cache_dir);
+
+  /**
+   * \brief Runs a task on a free session, waiting for one if all sessions are busy.
+   *
+   * \param task to run.
+   *
+   * \throw any exception of the task, after which the session is replaced.
+   */
+  void run(const std::function<void(abb::robot::RWSManager&)>& task);
+
+  /**
+   * \brief Runs a task on a free session, and records it for an endpoint (a thrown exception counts as an error).
+   *
+   * \param metrics of the endpoint.
+   * \param task to run.
+   *
+   * \throw any exception of the task, after which the session is replaced.
+   */
+  void run(EndpointMetrics& metrics, const std::function<void(abb::robot::RWSManager&)>& task);
+
+  /**
+   * \brief Runs an RWS service on a free session (see run()).
+   *
+   * \param service to run.
+   */
+  void runService(const std::function<void(abb::rws::RWSStateMachineInterface&)>& service);
+
+  /**
+   * \brief Runs a motion-critical RWS service, which never waits for a busy session to be returned.
+   *
+   * If all sessions are busy, the service runs as a priority service of a busy session's RWS manager instead, i.e.
+   * it only waits for that session's current request.
+   *
+   * \param service to run.
+   */
+  void runPriorityService(const std::function<void(abb::rws::RWSStateMachineInterface&)>& service);
+
+  /**
+   * \brief Checks if the sessions are ready for requests.
+   *
+   * \return bool false if every existing session reports its interface as not ready.
+   */
+  bool isInterfaceReady() const;
+
+  /**
+   * \brief Gets the counters of an endpoint, which are created on first use.
+   *
+   * \param name of the endpoint.
+   *
+   * \return EndpointMetrics& of the endpoint, valid for the lifetime of the pool.
+   */
+  EndpointMetrics& endpoint(const std::string& name);
+
+  /**
+   * \brief Summarizes the counters of all endpoints.
+   *
+   * \return std::vector<EndpointSummary> with a summary per endpoint, ordered by name.
+   */
+  std::vector<EndpointSummary> summarize() const;
+
+  /**
+   * \brief Gets the number of sessions created so far (including replaced ones), each of which logs in once.
+   *
+   * \return std::uint64_t with the number.
+   */
+  std::uint64_t logins() const;
+
+private:
+  /**
+   * \brief A pooled RWS session.
+   */
+  struct Session
+  {
+    /**
+     * \brief Shared, since the description cache keeps revalidating with the session it was created with.
+     */
+    std::shared_ptr<abb::robot::RWSManager> rws_manager;
+    bool in_use = false;
+    bool stale = false;
+  };
+
+  /**
+   * \brief Hands out a free session, creating or replacing it as needed.
+   *
+   * \return Session& that is in use by the caller.
+   */
+  Session& acquire();
+
+  /**
+   * \brief Returns a session to the pool.
+   *
+   * \param session to return.
+   * \param failed whether the session's request threw, so that the session is replaced before its next use.
+   */
+  void release(Session& session, bool failed);
+
+  std::shared_ptr<abb::robot::RWSManager> makeManager();
+
+  const std::string robot_ip_;
+  const unsigned short robot_port_;
+  const std::size_t max_sessions_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable released_;
+  std::vector<std::unique_ptr<Session>> sessions_;
+  std::uint64_t logins_ = 0;
+
+  /**
+   * \brief Description of the robot controller, and the cache it came from (with its revalidating session).
+   */
+  std::mutex description_mutex_;
+  std::unique_ptr<abb::robot::RobotControllerDescription> description_;
+  std::shared_ptr<abb::robot::RWSManager> description_manager_;
+  std::unique_ptr<abb::robot::utilities::DescriptionCache> description_cache_;
+
+  mutable std::mutex endpoints_mutex_;
+  std::map<std::string, std::unique_ptr<EndpointMetrics>> endpoints_;
+};
+}  // namespace abb_rws_client
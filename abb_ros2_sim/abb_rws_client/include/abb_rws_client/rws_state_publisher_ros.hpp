@@ -40,17 +40,27 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/joint_state.hpp>
 
 #include <abb_egm_rws_managers/rws_manager.h>
 #include <abb_egm_rws_managers/system_data_parser.h>
+#include <abb_hardware_interface/state_bridge.hpp>
 
 #include <abb_rapid_sm_addin_msgs/msg/runtime_state.hpp>
 #include <abb_robot_msgs/msg/rapid_task_state.hpp>
 #include <abb_robot_msgs/msg/system_state.hpp>
+#include <abb_rws_client_msgs/msg/subscribed_values.hpp>
+
+#include <abb_rws_client/rws_session_pool.hpp>
+#include <abb_rws_client/rws_subscriber.hpp>
 
 namespace abb_rws_client
 {
@@ -63,8 +73,15 @@ public:
    * \param node ROS 2 node.
    * \param robot_ip IP address for the robot controller's RWS server.
    * \param robot_poty Port number for the robot controller's RWS server.
+   * \param sessions pool of RWS sessions, shared with e.g. the services (nullptr for a pool of its own).
+   */
+  RWSStatePublisherROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip, unsigned short robot_port,
+                       std::shared_ptr<RWSSessionPool> sessions = nullptr);
+
+  /**
+   * \brief Stops the RWS subscription (if any).
    */
-  RWSStatePublisherROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip, unsigned short robot_port);
+  ~RWSStatePublisherROS();
 
 private:
   /**
@@ -72,13 +89,88 @@ private:
    */
   void timer_callback();
 
+  /**
+   * \brief Timer callback for publishing the joint states from the state bridge, while it has fresh ones.
+   */
+  void bridge_timer_callback();
+
+  /**
+   * \brief Resolves the joints of the state bridge's current generation to the joints of the joint state message.
+   *
+   * \return bool true if all joints were found.
+   */
+  bool mapStateBridgeJoints();
+
+  /**
+   * \brief Sizes the reused messages from the robot controller description.
+   */
+  void initializeMessages();
+
+  /**
+   * \brief Sets up the RWS subscription for the system state and the watched IO-signals and RAPID symbols.
+   *
+   * \param robot_ip IP address for the robot controller's RWS server.
+   * \param robot_port Port number for the robot controller's RWS server.
+   */
+  void initializeSubscription(const std::string& robot_ip, unsigned short robot_port);
+
+  /**
+   * \brief Collects the runtime data via RWS and publishes it.
+   *
+   * \param fallback_poll whether this is a periodic poll. While the RWS subscription is active, it is skipped if the
+   * fallback is not due yet and the state bridge has the joint states, and it reads the subscribed values only when
+   * the fallback is due.
+   */
+  void refresh(bool fallback_poll);
+
+  /**
+   * \brief Applies RWS subscription events to the system state and the subscribed values, and publishes the changes.
+   *
+   * \param events to apply.
+   *
+   * \return bool true if all the events could be applied, otherwise nothing is applied and a full refresh is needed.
+   */
+  bool applyEvents(const std::vector<RWSSubscriber::Event>& events);
+
+  /**
+   * \brief Applies an RWS subscription event to a subscribed IO-signal or RAPID symbol, reading only that symbol.
+   *
+   * \param event to apply.
+   * \param values to apply it to.
+   * \param changed set to true if the value changed.
+   *
+   * \return bool true if the event is about one of the subscribed values, and it could be applied.
+   *
+   * \throw std::runtime_error if reading the RAPID symbol failed.
+   */
+  bool applySubscribedValueEvent(const RWSSubscriber::Event& event, abb_rws_client_msgs::msg::SubscribedValues& values,
+                                 bool& changed);
+
+  /**
+   * \brief Reads the watched IO-signals and RAPID symbols, and publishes them if any of them changed.
+   *
+   * \param stamp to publish with.
+   */
+  void refreshSubscribedValues(const rclcpp::Time& stamp);
+
   rclcpp::Node::SharedPtr node_;
   rclcpp::TimerBase::SharedPtr timer_;
 
   /**
-   * \brief Manager for handling RWS communication with the robot controller.
+   * \brief Serializes refreshes from the polling timer and from RWS subscription events.
+   */
+  std::mutex refresh_mutex_;
+
+  /**
+   * \brief Pool of RWS sessions for handling RWS communication with the robot controller.
+   */
+  std::shared_ptr<RWSSessionPool> sessions_;
+
+  /**
+   * \brief Endpoint metrics of the polls.
    */
-  abb::robot::RWSManager rws_manager_;
+  EndpointMetrics* runtime_data_metrics_{ nullptr };
+  EndpointMetrics* subscribed_values_metrics_{ nullptr };
 
   /**
    * \brief Description of the connected robot controller.
@@ -111,6 +203,100 @@ private:
    * \brief Data about the robot controller's system state.
    */
   abb::robot::SystemStateData system_state_data_;
+
+  /**
+   * \brief Optional RWS subscription, which pushes changes of the system state and the subscribed values.
+   */
+  std::unique_ptr<RWSSubscriber> rws_subscriber_;
+
+  /**
+   * \brief Whether the RobotWare StateMachine Add-In is present in the system.
+   */
+  bool has_sm_addin_{ false };
+
+  /**
+   * \brief Whether unchanged system and runtime states are skipped when publishing.
+   */
+  bool publish_on_change_only_{ false };
+
+  /**
+   * \brief Whether the states have been published at least once.
+   */
+  bool published_state_{ false };
+
+  /**
+   * \brief Messages reused between refreshes, to avoid allocating for every refresh.
+   */
+  sensor_msgs::msg::JointState joint_state_msg_;
+  abb_robot_msgs::msg::SystemState system_state_msg_;
+  abb_rapid_sm_addin_msgs::msg::RuntimeState sm_runtime_state_msg_;
+
+  /**
+   * \brief Period for polling while the RWS subscription is active.
+   */
+  std::chrono::steady_clock::duration fallback_polling_period_;
+
+  /**
+   * \brief Time of the last refresh that also served as the fallback for the RWS subscription.
+   */
+  std::chrono::steady_clock::time_point last_fallback_poll_;
+
+  /**
+   * \brief Serializes the joint state message between refreshes and the state bridge.
+   */
+  std::mutex joint_state_mutex_;
+
+  /**
+   * \brief Name of the optional shared memory segment, in which the hardware interface publishes its joint states.
+   */
+  std::string state_bridge_name_;
+
+  /**
+   * \brief The state bridge, once it could be opened.
+   */
+  std::unique_ptr<abb_hardware_interface::StateBridgeReader> state_bridge_;
+
+  /**
+   * \brief Timer for reading the state bridge, in its own callback group so that RWS requests do not delay it.
+   */
+  rclcpp::CallbackGroup::SharedPtr bridge_callback_group_;
+  rclcpp::TimerBase::SharedPtr bridge_timer_;
+
+  /**
+   * \brief Age up to which the state bridge's joint states are used, instead of the ones polled via RWS.
+   */
+  std::chrono::steady_clock::duration state_bridge_timeout_;
+
+  /**
+   * \brief Time of the next attempt to open the state bridge.
+   */
+  std::chrono::steady_clock::time_point next_bridge_attempt_;
+
+  /**
+   * \brief Index into the state bridge's joints for each joint of the joint state message, valid for the generation.
+   */
+  std::vector<std::size_t> bridge_indices_;
+  std::uint32_t bridge_generation_{ 0 };
+  bool bridge_mapped_{ false };
+  abb_hardware_interface::StateBridgeSample bridge_sample_;
+
+  /**
+   * \brief Whether the joint states come from the state bridge, instead of the ones polled via RWS. Written by the
+   * bridge timer and read by the refreshes, which run in other callback groups.
+   */
+  std::atomic<bool> bridge_active_{ false };
+
+  /**
+   * \brief Publisher for the watched IO-signals and RAPID symbols.
+   *
+   * Note: Only used in subscription mode, if any IO-signals or RAPID symbols are watched.
+   */
+  rclcpp::Publisher<abb_rws_client_msgs::msg::SubscribedValues>::SharedPtr subscribed_values_pub_;
+
+  /**
+   * \brief Last published values of the watched IO-signals and RAPID symbols.
+   */
+  abb_rws_client_msgs::msg::SubscribedValues subscribed_values_msg_;
 };
 
 }  // namespace abb_rws_client
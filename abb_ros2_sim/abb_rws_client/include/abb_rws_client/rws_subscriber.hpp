@@ -0,0 +1,172 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_librws/rws_client.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace abb_rws_client
+{
+/**
+ * \brief Receives events pushed by the robot controller via an RWS subscription (i.e. a WebSocket).
+ *
+ * The subscription uses its own RWS session, so that waiting for events never blocks other RWS communication. If the
+ * subscription cannot be started, or is lost, it is restarted after a back-off period. Users are expected to keep
+ * polling at a low rate as a fallback, since events can be missed while the subscription is down.
+ */
+class RWSSubscriber
+{
+public:
+  /**
+   * \brief A change of a subscribed resource, as pushed by the robot controller.
+   */
+  struct Event
+  {
+    /**
+     * \brief URI of the resource that changed (e.g. "/rw/panel/ctrlstate").
+     */
+    std::string resource;
+
+    /**
+     * \brief The resource's new value (e.g. "motoron"), or empty if the event does not carry it (e.g. for RAPID
+     * symbols).
+     */
+    std::string value;
+  };
+
+  /**
+   * \brief Callback for received events. Called from the subscriber's thread.
+   *
+   * The argument contains the changes that the event was about, which may be empty if they could not be extracted
+   * from the event.
+   */
+  using EventCallback = std::function<void(const std::vector<Event>&)>;
+
+  /**
+   * \brief Resources added by addSystemState().
+   */
+  static constexpr const char* CTRLSTATE_RESOURCE = "/rw/panel/ctrlstate";
+  static constexpr const char* OPMODE_RESOURCE = "/rw/panel/opmode";
+  static constexpr const char* EXECUTION_STATE_RESOURCE = "/rw/rapid/execution;ctrlexecstate";
+
+  /**
+   * \brief Callback for changes of the subscription's state (true when it is active).
+   */
+  using StateCallback = std::function<void(bool)>;
+
+  /**
+   * \brief Creates a subscriber.
+   *
+   * \param robot_ip IP address for the robot controller's RWS server.
+   * \param robot_port Port number for the robot controller's RWS server.
+   * \param username for the RWS session.
+   * \param password for the RWS session.
+   */
+  RWSSubscriber(const std::string& robot_ip, unsigned short robot_port, const std::string& username,
+                const std::string& password);
+
+  /**
+   * \brief Stops the subscription.
+   */
+  ~RWSSubscriber();
+
+  /**
+   * \brief Adds the controller state (motors on/off), operation mode and RAPID execution state to the subscription.
+   */
+  void addSystemState();
+
+  /**
+   * \brief Adds an IO-signal to the subscription.
+   *
+   * \param signal name of the IO-signal.
+   */
+  void addIOSignal(const std::string& signal);
+
+  /**
+   * \brief Adds a RAPID persistent symbol to the subscription.
+   *
+   * \param task name of the RAPID task.
+   * \param module name of the RAPID module.
+   * \param symbol name of the RAPID symbol.
+   */
+  void addRAPIDSymbol(const std::string& task, const std::string& module, const std::string& symbol);
+
+  /**
+   * \brief Starts the subscription thread. Resources can not be added after this.
+   *
+   * \param on_event called for each received event.
+   * \param on_state_change called when the subscription becomes active or inactive.
+   */
+  void start(const EventCallback& on_event, const StateCallback& on_state_change);
+
+  /**
+   * \brief Ends the subscription and joins the subscription thread.
+   */
+  void stop();
+
+  /**
+   * \brief Checks if the subscription is active, i.e. if events are being received.
+   *
+   * \return bool true if active.
+   */
+  bool isActive() const { return active_; }
+
+  /**
+   * \brief Time to wait before restarting a failed subscription.
+   */
+  static constexpr std::chrono::milliseconds RETRY_PERIOD{ 2000 };
+
+private:
+  /**
+   * \brief Runs the subscription, and restarts it if it fails, until stopped.
+   */
+  void run();
+
+  /**
+   * \brief Extracts the changed resources, and their new values, from an event.
+   *
+   * \param result of waiting for the event.
+   *
+   * \return std::vector<Event> with the changes.
+   */
+  static std::vector<Event> extractEvents(const abb::rws::RWSClient::RWSResult& result);
+
+  /**
+   * \brief Marks the subscription as active or inactive, and notifies the state callback on changes.
+   *
+   * \param active state to set.
+   */
+  void setActive(bool active);
+
+  abb::rws::RWSClient client_;
+  abb::rws::RWSClient::SubscriptionResources resources_;
+  EventCallback on_event_;
+  StateCallback on_state_change_;
+
+  std::mutex stop_mutex_;
+  std::condition_variable stop_condition_;
+  std::atomic<bool> running_{ false };
+  std::atomic<bool> active_{ false };
+  std::thread thread_;
+};
+}  // namespace abb_rws_client
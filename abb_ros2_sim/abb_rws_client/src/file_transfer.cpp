@@ -0,0 +1,160 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/file_transfer.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace abb_rws_client
+{
+constexpr std::size_t FileTransfer::DEFAULT_CHUNK_SIZE;
+constexpr std::size_t FileTransfer::MAX_CHUNK_SIZE;
+constexpr std::size_t FileTransfer::MAX_DOWNLOADS;
+
+FileTransfer::FileTransfer(std::size_t max_file_size) : max_file_size_{ max_file_size }
+{
+  if (max_file_size_ == 0)
+  {
+    throw std::invalid_argument{ "The maximum file size must be positive" };
+  }
+}
+
+bool FileTransfer::hasDownload(const std::string& filename, std::size_t offset) const
+{
+  const auto it = findDownload(filename);
+  return it != downloads_.end() && offset <= it->contents.size();
+}
+
+bool FileTransfer::startDownload(const std::string& filename, std::string&& contents)
+{
+  const auto it = findDownload(filename);
+  if (it != downloads_.end())
+  {
+    downloads_.erase(it);
+  }
+
+  if (contents.size() > max_file_size_)
+  {
+    return false;
+  }
+
+  if (downloads_.size() >= MAX_DOWNLOADS)
+  {
+    downloads_.pop_back();
+  }
+  downloads_.push_front(Download{ filename, std::move(contents) });
+  return true;
+}
+
+bool FileTransfer::readChunk(const std::string& filename, std::size_t offset, std::size_t max_size,
+                             std::string& chunk, std::size_t& total_size)
+{
+  const std::size_t chunk_size = std::min(max_size == 0 ? DEFAULT_CHUNK_SIZE : max_size, MAX_CHUNK_SIZE);
+
+  const auto it = findDownload(filename);
+  downloads_.splice(downloads_.begin(), downloads_, it);
+
+  total_size = it->contents.size();
+  chunk.assign(it->contents, offset, chunk_size);
+
+  const bool eof = offset + chunk.size() >= total_size;
+  if (eof)
+  {
+    // Releases the memory as soon as the transfer is done (a later request for the file retrieves it again).
+    downloads_.erase(it);
+  }
+  return eof;
+}
+
+bool FileTransfer::addChunk(const std::string& filename, std::size_t offset, const std::string& chunk)
+{
+  if (offset == 0)
+  {
+    upload_filename_ = filename;
+    upload_contents_.clear();
+  }
+  else if (filename != upload_filename_ || offset != upload_contents_.size())
+  {
+    return false;
+  }
+
+  if (upload_contents_.size() + chunk.size() > max_file_size_)
+  {
+    return false;
+  }
+
+  upload_contents_.append(chunk);
+  return true;
+}
+
+std::size_t FileTransfer::uploadSize(const std::string& filename) const
+{
+  return filename == upload_filename_ ? upload_contents_.size() : 0;
+}
+
+std::string FileTransfer::finishUpload()
+{
+  upload_filename_.clear();
+  std::string contents;
+  contents.swap(upload_contents_);
+  return contents;
+}
+
+std::list<FileTransfer::Download>::iterator FileTransfer::findDownload(const std::string& filename)
+{
+  return std::find_if(downloads_.begin(), downloads_.end(),
+                      [&filename](const Download& download) { return download.filename == filename; });
+}
+
+std::list<FileTransfer::Download>::const_iterator FileTransfer::findDownload(const std::string& filename) const
+{
+  return std::find_if(downloads_.begin(), downloads_.end(),
+                      [&filename](const Download& download) { return download.filename == filename; });
+}
+
+bool FileTransfer::compress(const std::string& data, std::vector<uint8_t>& compressed)
+{
+  uLongf compressed_size = compressBound(data.size());
+  compressed.resize(compressed_size);
+
+  if (compress2(compressed.data(), &compressed_size, reinterpret_cast<const Bytef*>(data.data()), data.size(),
+                Z_BEST_SPEED) != Z_OK)
+  {
+    return false;
+  }
+
+  compressed.resize(compressed_size);
+  return true;
+}
+
+bool FileTransfer::decompress(const std::vector<uint8_t>& compressed, std::size_t max_size, std::string& data)
+{
+  // The chunk's uncompressed size is not sent along, so it is decompressed into a buffer of the maximum size.
+  data.resize(max_size);
+  uLongf data_size = max_size;
+
+  if (uncompress(reinterpret_cast<Bytef*>(&data[0]), &data_size, compressed.data(), compressed.size()) != Z_OK)
+  {
+    data.clear();
+    return false;
+  }
+
+  data.resize(data_size);
+  return true;
+}
+}  // namespace abb_rws_client
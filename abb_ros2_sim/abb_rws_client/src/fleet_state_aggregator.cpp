@@ -0,0 +1,181 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/fleet_state_aggregator.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <abb_rws_client/mapping.hpp>
+
+namespace
+{
+/**
+ * \brief Time [s] for throttled ROS logging.
+ */
+constexpr double THROTTLE_TIME{ 10.0 };
+}  // namespace
+
+namespace abb_rws_client
+{
+FleetStateAggregator::FleetStateAggregator(const rclcpp::Node::SharedPtr& node) : node_(node)
+{
+  const auto names = node_->declare_parameter<std::vector<std::string>>("controllers", std::vector<std::string>{});
+  const double polling_rate = node_->declare_parameter<double>("polling_rate", 5.0);
+  const double publish_rate = node_->declare_parameter<double>("publish_rate", 5.0);
+  const int poll_threads = node_->declare_parameter<int>("poll_threads", 4);
+  stale_timeout_ = node_->declare_parameter<double>("stale_timeout", 2.0);
+  if (polling_rate <= 0.0 || publish_rate <= 0.0)
+  {
+    throw std::runtime_error{ "The polling_rate and publish_rate must be positive" };
+  }
+
+  controllers_.reserve(names.size());
+  for (const auto& name : names)
+  {
+    auto controller = std::make_unique<Controller>();
+    controller->name = name;
+    controller->robot_ip = node_->declare_parameter<std::string>(name + ".robot_ip", std::string{});
+    controller->robot_port = static_cast<unsigned short>(node_->declare_parameter<int>(name + ".robot_port", 80));
+    if (controller->robot_ip.empty())
+    {
+      throw std::runtime_error{ "No robot_ip for controller '" + name + "'" };
+    }
+
+    // A single session per controller, since its polls never overlap
+    controller->sessions = std::make_unique<RWSSessionPool>(controller->robot_ip, controller->robot_port, 1);
+    controller->last_update = rclcpp::Time(0, 0, node_->get_clock()->get_clock_type());
+    controllers_.push_back(std::move(controller));
+  }
+
+  fleet_state_msg_.controllers.resize(controllers_.size());
+  for (std::size_t i = 0; i < controllers_.size(); ++i)
+  {
+    auto& state = fleet_state_msg_.controllers[i];
+    state.name = controllers_[i]->name;
+    state.robot_ip = controllers_[i]->robot_ip;
+    state.robot_port = controllers_[i]->robot_port;
+  }
+
+  fleet_state_pub_ = node_->create_publisher<abb_rws_client_msgs::msg::FleetState>("~/fleet_states", 10);
+  timer_ = node_->create_wall_timer(std::chrono::duration<double>(1.0 / publish_rate),
+                                    std::bind(&FleetStateAggregator::publish, this));
+
+  // More threads than controllers would only idle
+  const auto num_threads = std::min<std::size_t>(static_cast<std::size_t>(std::max(poll_threads, 1)),
+                                                 std::max<std::size_t>(controllers_.size(), 1));
+  const auto period =
+      std::chrono::duration_cast<PollScheduler::Clock::duration>(std::chrono::duration<double>(1.0 / polling_rate));
+  scheduler_ = std::make_unique<PollScheduler>(num_threads);
+  for (auto& controller : controllers_)
+  {
+    Controller* polled = controller.get();
+    scheduler_->add([this, polled]() { poll(*polled); }, period);
+  }
+  scheduler_->start();
+
+  RCLCPP_INFO(node_->get_logger(), "Polling %zu robot controllers at %.2f Hz on %zu threads", controllers_.size(),
+              polling_rate, num_threads);
+}
+
+FleetStateAggregator::~FleetStateAggregator()
+{
+  scheduler_->stop();
+}
+
+void FleetStateAggregator::poll(Controller& controller)
+{
+  try
+  {
+    controller.sessions->run([&controller](abb::robot::RWSManager& rws_manager) {
+      rws_manager.collectAndUpdateRuntimeData(controller.system_state_data, controller.motion_data);
+    });
+  }
+  catch (const std::exception& exception)
+  {
+    {
+      std::lock_guard<std::mutex> lock{ controller.mutex };
+      controller.connected = false;
+      ++controller.failed_polls;
+    }
+    auto& clk = *node_->get_clock();
+    RCLCPP_WARN_STREAM_THROTTLE(node_->get_logger(), clk, THROTTLE_TIME,
+                                "Polling of robot controller '" << controller.name << "' via RWS failed with '"
+                                                                << exception.what() << "' (will try again later)");
+    return;
+  }
+
+  const auto& data = controller.system_state_data;
+  std::lock_guard<std::mutex> lock{ controller.mutex };
+  auto& state = controller.system_state;
+  state.motors_on = data.motors_on.isTrue();
+  state.auto_mode = data.auto_mode.isTrue();
+  state.rapid_running = data.rapid_running.isTrue();
+
+  state.rapid_tasks.resize(data.rapid_tasks.size());
+  for (std::size_t i = 0; i < data.rapid_tasks.size(); ++i)
+  {
+    const auto& task = data.rapid_tasks[i];
+    auto& task_state = state.rapid_tasks[i];
+    task_state.name = task.name;
+    task_state.activated = task.is_active;
+    task_state.execution_state = abb::robot::utilities::map(task.execution_state);
+    task_state.motion_task = task.is_motion_task;
+  }
+
+  state.mechanical_units.resize(data.mechanical_units.size());
+  auto unit_state = state.mechanical_units.begin();
+  for (const auto& unit : data.mechanical_units)
+  {
+    unit_state->name = unit.first;
+    unit_state->activated = unit.second.active;
+    ++unit_state;
+  }
+
+  controller.connected = true;
+  controller.updated = true;
+  controller.failed_polls = 0;
+  controller.last_update = node_->get_clock()->now();
+  state.header.stamp = controller.last_update;
+}
+
+void FleetStateAggregator::publish()
+{
+  const auto now = node_->get_clock()->now();
+  for (std::size_t i = 0; i < controllers_.size(); ++i)
+  {
+    Controller& controller = *controllers_[i];
+    auto& state = fleet_state_msg_.controllers[i];
+
+    std::lock_guard<std::mutex> lock{ controller.mutex };
+    state.connected = controller.connected;
+    state.failed_polls = controller.failed_polls;
+    if (controller.updated)
+    {
+      state.last_update = controller.last_update;
+      state.age = (now - controller.last_update).seconds();
+      state.fresh = state.age <= stale_timeout_;
+      state.system_state = controller.system_state;
+    }
+    else
+    {
+      state.age = -1.0;
+      state.fresh = false;
+    }
+  }
+
+  fleet_state_msg_.header.stamp = now;
+  fleet_state_pub_->publish(fleet_state_msg_);
+}
+}  // namespace abb_rws_client
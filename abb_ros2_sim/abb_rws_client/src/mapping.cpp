@@ -127,79 +127,108 @@ uint8_t mapStateMachineEGMAction(const rws::RAPIDNum& action)
   }
 }
 
-abb_rapid_msgs::msg::Pos map(const rws::Pos& rws_pos)
+void map(const rws::Pos& rws_pos, abb_rapid_msgs::msg::Pos& ros_pos)
 {
-  abb_rapid_msgs::msg::Pos ros_pos;
   ros_pos.x = rws_pos.x.value;
   ros_pos.y = rws_pos.y.value;
   ros_pos.z = rws_pos.z.value;
+}
+
+abb_rapid_msgs::msg::Pos map(const rws::Pos& rws_pos)
+{
+  abb_rapid_msgs::msg::Pos ros_pos;
+  map(rws_pos, ros_pos);
   return ros_pos;
 }
 
-abb_rapid_msgs::msg::Orient map(const rws::Orient& rws_orient)
+void map(const rws::Orient& rws_orient, abb_rapid_msgs::msg::Orient& ros_orient)
 {
-  abb_rapid_msgs::msg::Orient ros_orient;
   ros_orient.q1 = rws_orient.q1.value;
   ros_orient.q2 = rws_orient.q2.value;
   ros_orient.q3 = rws_orient.q3.value;
   ros_orient.q4 = rws_orient.q4.value;
+}
+
+abb_rapid_msgs::msg::Orient map(const rws::Orient& rws_orient)
+{
+  abb_rapid_msgs::msg::Orient ros_orient;
+  map(rws_orient, ros_orient);
   return ros_orient;
 }
 
+void map(const rws::Pose& rws_pose, abb_rapid_msgs::msg::Pose& ros_pose)
+{
+  map(rws_pose.pos, ros_pose.trans);
+  map(rws_pose.rot, ros_pose.rot);
+}
+
 abb_rapid_msgs::msg::Pose map(const rws::Pose& rws_pose)
 {
   abb_rapid_msgs::msg::Pose ros_pose;
-  ros_pose.trans = map(rws_pose.pos);
-  ros_pose.rot = map(rws_pose.rot);
+  map(rws_pose, ros_pose);
   return ros_pose;
 }
 
-abb_rapid_msgs::msg::LoadData map(const rws::LoadData& rws_loaddata)
+void map(const rws::LoadData& rws_loaddata, abb_rapid_msgs::msg::LoadData& ros_loaddata)
 {
-  abb_rapid_msgs::msg::LoadData ros_loaddata;
   ros_loaddata.mass = rws_loaddata.mass.value;
-  ros_loaddata.cog = map(rws_loaddata.cog);
-  ros_loaddata.aom = map(rws_loaddata.aom);
+  map(rws_loaddata.cog, ros_loaddata.cog);
+  map(rws_loaddata.aom, ros_loaddata.aom);
   ros_loaddata.ix = rws_loaddata.ix.value;
   ros_loaddata.iy = rws_loaddata.iy.value;
   ros_loaddata.iz = rws_loaddata.iz.value;
+}
+
+abb_rapid_msgs::msg::LoadData map(const rws::LoadData& rws_loaddata)
+{
+  abb_rapid_msgs::msg::LoadData ros_loaddata;
+  map(rws_loaddata, ros_loaddata);
   return ros_loaddata;
 }
 
+void map(const rws::ToolData& rws_tooldata, abb_rapid_msgs::msg::ToolData& ros_tooldata)
+{
+  ros_tooldata.robhold = rws_tooldata.robhold.value;
+  map(rws_tooldata.tframe, ros_tooldata.tframe);
+  map(rws_tooldata.tload, ros_tooldata.tload);
+}
+
 abb_rapid_msgs::msg::ToolData map(const rws::ToolData& rws_tooldata)
 {
   abb_rapid_msgs::msg::ToolData ros_tooldata;
-  ros_tooldata.robhold = rws_tooldata.robhold.value;
-  ros_tooldata.tframe = map(rws_tooldata.tframe);
-  ros_tooldata.tload = map(rws_tooldata.tload);
+  map(rws_tooldata, ros_tooldata);
   return ros_tooldata;
 }
 
-abb_rapid_msgs::msg::WObjData map(const rws::WObjData& rws_wobjdata)
+void map(const rws::WObjData& rws_wobjdata, abb_rapid_msgs::msg::WObjData& ros_wobjdata)
 {
-  abb_rapid_msgs::msg::WObjData ros_wobjdata;
   ros_wobjdata.robhold = rws_wobjdata.robhold.value;
   ros_wobjdata.ufprog = rws_wobjdata.ufprog.value;
   ros_wobjdata.ufmec = rws_wobjdata.ufmec.value;
-  ros_wobjdata.uframe = map(rws_wobjdata.uframe);
-  ros_wobjdata.oframe = map(rws_wobjdata.oframe);
-  return ros_wobjdata;
+  map(rws_wobjdata.uframe, ros_wobjdata.uframe);
+  map(rws_wobjdata.oframe, ros_wobjdata.oframe);
 }
 
-abb_rapid_sm_addin_msgs::msg::EGMSettings map(const rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings)
+abb_rapid_msgs::msg::WObjData map(const rws::WObjData& rws_wobjdata)
 {
-  abb_rapid_sm_addin_msgs::msg::EGMSettings ros_egm_settings;
+  abb_rapid_msgs::msg::WObjData ros_wobjdata;
+  map(rws_wobjdata, ros_wobjdata);
+  return ros_wobjdata;
+}
 
+void map(const rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings,
+         abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings)
+{
   ros_egm_settings.allow_egm_motions = rws_egm_settings.allow_egm_motions.value;
   ros_egm_settings.use_presync = rws_egm_settings.use_presync.value;
 
   ros_egm_settings.setup_uc.use_filtering = rws_egm_settings.setup_uc.use_filtering.value;
   ros_egm_settings.setup_uc.comm_timeout = rws_egm_settings.setup_uc.comm_timeout.value;
 
-  ros_egm_settings.activate.tool = utilities::map(rws_egm_settings.activate.tool);
-  ros_egm_settings.activate.wobj = utilities::map(rws_egm_settings.activate.wobj);
-  ros_egm_settings.activate.correction_frame = utilities::map(rws_egm_settings.activate.correction_frame);
-  ros_egm_settings.activate.sensor_frame = utilities::map(rws_egm_settings.activate.sensor_frame);
+  utilities::map(rws_egm_settings.activate.tool, ros_egm_settings.activate.tool);
+  utilities::map(rws_egm_settings.activate.wobj, ros_egm_settings.activate.wobj);
+  utilities::map(rws_egm_settings.activate.correction_frame, ros_egm_settings.activate.correction_frame);
+  utilities::map(rws_egm_settings.activate.sensor_frame, ros_egm_settings.activate.sensor_frame);
   ros_egm_settings.activate.cond_min_max = rws_egm_settings.activate.cond_min_max.value;
   ros_egm_settings.activate.lp_filter = rws_egm_settings.activate.lp_filter.value;
   ros_egm_settings.activate.sample_rate = rws_egm_settings.activate.sample_rate.value;
@@ -207,11 +236,16 @@ abb_rapid_sm_addin_msgs::msg::EGMSettings map(const rws::RWSStateMachineInterfac
 
   ros_egm_settings.run.cond_time = rws_egm_settings.run.cond_time.value;
   ros_egm_settings.run.ramp_in_time = rws_egm_settings.run.ramp_in_time.value;
-  ros_egm_settings.run.offset = utilities::map(rws_egm_settings.run.offset);
+  utilities::map(rws_egm_settings.run.offset, ros_egm_settings.run.offset);
   ros_egm_settings.run.pos_corr_gain = rws_egm_settings.run.pos_corr_gain.value;
 
   ros_egm_settings.stop.ramp_out_time = rws_egm_settings.stop.ramp_out_time.value;
+}
 
+abb_rapid_sm_addin_msgs::msg::EGMSettings map(const rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings)
+{
+  abb_rapid_sm_addin_msgs::msg::EGMSettings ros_egm_settings;
+  map(rws_egm_settings, ros_egm_settings);
   return ros_egm_settings;
 }
 
@@ -267,79 +301,108 @@ unsigned int mapStateMachineSGCommand(const unsigned int command)
   }
 }
 
-rws::Pos map(const abb_rapid_msgs::msg::Pos& ros_pos)
+void map(const abb_rapid_msgs::msg::Pos& ros_pos, rws::Pos& rws_pos)
 {
-  rws::Pos rws_pos;
   rws_pos.x.value = ros_pos.x;
   rws_pos.y.value = ros_pos.y;
   rws_pos.z.value = ros_pos.z;
+}
+
+rws::Pos map(const abb_rapid_msgs::msg::Pos& ros_pos)
+{
+  rws::Pos rws_pos;
+  map(ros_pos, rws_pos);
   return rws_pos;
 }
 
-rws::Orient map(const abb_rapid_msgs::msg::Orient& ros_orient)
+void map(const abb_rapid_msgs::msg::Orient& ros_orient, rws::Orient& rws_orient)
 {
-  rws::Orient rws_orient;
   rws_orient.q1 = ros_orient.q1;
   rws_orient.q2 = ros_orient.q2;
   rws_orient.q3 = ros_orient.q3;
   rws_orient.q4 = ros_orient.q4;
+}
+
+rws::Orient map(const abb_rapid_msgs::msg::Orient& ros_orient)
+{
+  rws::Orient rws_orient;
+  map(ros_orient, rws_orient);
   return rws_orient;
 }
 
+void map(const abb_rapid_msgs::msg::Pose& ros_pose, rws::Pose& rws_pose)
+{
+  map(ros_pose.trans, rws_pose.pos);
+  map(ros_pose.rot, rws_pose.rot);
+}
+
 rws::Pose map(const abb_rapid_msgs::msg::Pose& ros_pose)
 {
   rws::Pose rws_pose;
-  rws_pose.pos = map(ros_pose.trans);
-  rws_pose.rot = map(ros_pose.rot);
+  map(ros_pose, rws_pose);
   return rws_pose;
 }
 
-rws::LoadData map(const abb_rapid_msgs::msg::LoadData& ros_loaddata)
+void map(const abb_rapid_msgs::msg::LoadData& ros_loaddata, rws::LoadData& rws_loaddata)
 {
-  rws::LoadData rws_loaddata;
   rws_loaddata.mass.value = ros_loaddata.mass;
-  rws_loaddata.cog = map(ros_loaddata.cog);
-  rws_loaddata.aom = map(ros_loaddata.aom);
+  map(ros_loaddata.cog, rws_loaddata.cog);
+  map(ros_loaddata.aom, rws_loaddata.aom);
   rws_loaddata.ix.value = ros_loaddata.ix;
   rws_loaddata.iy.value = ros_loaddata.iy;
   rws_loaddata.iz.value = ros_loaddata.iz;
+}
+
+rws::LoadData map(const abb_rapid_msgs::msg::LoadData& ros_loaddata)
+{
+  rws::LoadData rws_loaddata;
+  map(ros_loaddata, rws_loaddata);
   return rws_loaddata;
 }
 
+void map(const abb_rapid_msgs::msg::ToolData& ros_tooldata, rws::ToolData& rws_tooldata)
+{
+  rws_tooldata.robhold = ros_tooldata.robhold;
+  map(ros_tooldata.tframe, rws_tooldata.tframe);
+  map(ros_tooldata.tload, rws_tooldata.tload);
+}
+
 rws::ToolData map(const abb_rapid_msgs::msg::ToolData& ros_tooldata)
 {
   rws::ToolData rws_tooldata;
-  rws_tooldata.robhold = ros_tooldata.robhold;
-  rws_tooldata.tframe = map(ros_tooldata.tframe);
-  rws_tooldata.tload = map(ros_tooldata.tload);
+  map(ros_tooldata, rws_tooldata);
   return rws_tooldata;
 }
 
-rws::WObjData map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata)
+void map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata, rws::WObjData& rws_wobjdata)
 {
-  rws::WObjData rws_wobjdata;
   rws_wobjdata.robhold.value = ros_wobjdata.robhold;
   rws_wobjdata.ufprog.value = ros_wobjdata.ufprog;
   rws_wobjdata.ufmec.value = ros_wobjdata.ufmec;
-  rws_wobjdata.uframe = map(ros_wobjdata.uframe);
-  rws_wobjdata.oframe = map(ros_wobjdata.oframe);
-  return rws_wobjdata;
+  map(ros_wobjdata.uframe, rws_wobjdata.uframe);
+  map(ros_wobjdata.oframe, rws_wobjdata.oframe);
 }
 
-rws::RWSStateMachineInterface::EGMSettings map(const abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings)
+rws::WObjData map(const abb_rapid_msgs::msg::WObjData& ros_wobjdata)
 {
-  rws::RWSStateMachineInterface::EGMSettings rws_egm_settings;
+  rws::WObjData rws_wobjdata;
+  map(ros_wobjdata, rws_wobjdata);
+  return rws_wobjdata;
+}
 
+void map(const abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings,
+         rws::RWSStateMachineInterface::EGMSettings& rws_egm_settings)
+{
   rws_egm_settings.allow_egm_motions.value = ros_egm_settings.allow_egm_motions;
   rws_egm_settings.use_presync.value = ros_egm_settings.use_presync;
 
   rws_egm_settings.setup_uc.use_filtering.value = ros_egm_settings.setup_uc.use_filtering;
   rws_egm_settings.setup_uc.comm_timeout.value = ros_egm_settings.setup_uc.comm_timeout;
 
-  rws_egm_settings.activate.tool = utilities::map(ros_egm_settings.activate.tool);
-  rws_egm_settings.activate.wobj = utilities::map(ros_egm_settings.activate.wobj);
-  rws_egm_settings.activate.correction_frame = utilities::map(ros_egm_settings.activate.correction_frame);
-  rws_egm_settings.activate.sensor_frame = utilities::map(ros_egm_settings.activate.sensor_frame);
+  utilities::map(ros_egm_settings.activate.tool, rws_egm_settings.activate.tool);
+  utilities::map(ros_egm_settings.activate.wobj, rws_egm_settings.activate.wobj);
+  utilities::map(ros_egm_settings.activate.correction_frame, rws_egm_settings.activate.correction_frame);
+  utilities::map(ros_egm_settings.activate.sensor_frame, rws_egm_settings.activate.sensor_frame);
   rws_egm_settings.activate.cond_min_max = ros_egm_settings.activate.cond_min_max;
   rws_egm_settings.activate.lp_filter = ros_egm_settings.activate.lp_filter;
   rws_egm_settings.activate.sample_rate = ros_egm_settings.activate.sample_rate;
@@ -347,11 +410,16 @@ rws::RWSStateMachineInterface::EGMSettings map(const abb_rapid_sm_addin_msgs::ms
 
   rws_egm_settings.run.cond_time = ros_egm_settings.run.cond_time;
   rws_egm_settings.run.ramp_in_time = ros_egm_settings.run.ramp_in_time;
-  rws_egm_settings.run.offset = utilities::map(ros_egm_settings.run.offset);
+  utilities::map(ros_egm_settings.run.offset, rws_egm_settings.run.offset);
   rws_egm_settings.run.pos_corr_gain = ros_egm_settings.run.pos_corr_gain;
 
   rws_egm_settings.stop.ramp_out_time = ros_egm_settings.stop.ramp_out_time;
+}
 
+rws::RWSStateMachineInterface::EGMSettings map(const abb_rapid_sm_addin_msgs::msg::EGMSettings& ros_egm_settings)
+{
+  rws::RWSStateMachineInterface::EGMSettings rws_egm_settings;
+  map(ros_egm_settings, rws_egm_settings);
   return rws_egm_settings;
 }
 
@@ -0,0 +1,112 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/poll_scheduler.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace abb_rws_client
+{
+PollScheduler::PollScheduler(const std::size_t num_threads) : num_threads_(std::max<std::size_t>(num_threads, 1))
+{
+}
+
+PollScheduler::~PollScheduler()
+{
+  stop();
+}
+
+void PollScheduler::add(std::function<void()> task, const Clock::duration period)
+{
+  tasks_.push_back(std::move(task));
+  periods_.push_back(std::max(period, Clock::duration{ 1 }));
+}
+
+void PollScheduler::start()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    const auto now = Clock::now();
+    const auto num_tasks = static_cast<Clock::rep>(tasks_.size());
+    for (std::size_t i = 0; i < tasks_.size(); ++i)
+    {
+      deadlines_.push(Deadline{ now + periods_[i] * static_cast<Clock::rep>(i) / num_tasks, i });
+    }
+  }
+
+  threads_.reserve(num_threads_);
+  for (std::size_t i = 0; i < num_threads_; ++i)
+  {
+    threads_.emplace_back(&PollScheduler::work, this);
+  }
+}
+
+void PollScheduler::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    stopping_ = true;
+  }
+  changed_.notify_all();
+  for (auto& thread : threads_)
+  {
+    thread.join();
+  }
+  threads_.clear();
+}
+
+void PollScheduler::work()
+{
+  std::unique_lock<std::mutex> lock{ mutex_ };
+  while (!stopping_)
+  {
+    if (deadlines_.empty())
+    {
+      changed_.wait(lock);
+      continue;
+    }
+
+    // The earliest deadline may change while waiting for it, so it is looked up again after every wake up
+    const Deadline next = deadlines_.top();
+    if (Clock::now() < next.time)
+    {
+      changed_.wait_until(lock, next.time);
+      continue;
+    }
+    deadlines_.pop();
+
+    lock.unlock();
+    try
+    {
+      tasks_[next.task]();
+    }
+    catch (...)
+    {
+    }
+    lock.lock();
+
+    // Deadlines missed by a long task are skipped, which keeps the task's phase in the stagger
+    const auto period = periods_[next.task];
+    auto time = next.time + period;
+    const auto now = Clock::now();
+    if (time <= now)
+    {
+      time += period * ((now - time) / period + 1);
+    }
+    deadlines_.push(Deadline{ time, next.task });
+    changed_.notify_one();
+  }
+}
+}  // namespace abb_rws_client
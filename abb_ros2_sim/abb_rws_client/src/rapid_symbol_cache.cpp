@@ -0,0 +1,98 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/rapid_symbol_cache.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace abb_rws_client
+{
+RAPIDSymbolCache::RAPIDSymbolCache(const std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1))
+{
+  index_.reserve(capacity_);
+}
+
+bool RAPIDSymbolCache::contains(const abb_robot_msgs::msg::RAPIDSymbolPath& path, const std::string& data_type)
+{
+  const std::string key = makeKey(path);
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  const auto it = index_.find(key);
+  if (it == index_.end() || it->second->data_type != data_type)
+  {
+    return false;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return true;
+}
+
+std::uint64_t RAPIDSymbolCache::generation() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return generation_;
+}
+
+void RAPIDSymbolCache::insert(const abb_robot_msgs::msg::RAPIDSymbolPath& path, const std::string& data_type,
+                              const std::uint64_t generation)
+{
+  std::string key = makeKey(path);
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  if (generation != generation_)
+  {
+    return;
+  }
+
+  const auto it = index_.find(key);
+  if (it != index_.end())
+  {
+    it->second->data_type = data_type;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+
+  if (entries_.size() >= capacity_)
+  {
+    index_.erase(entries_.back().key);
+    entries_.pop_back();
+  }
+  entries_.push_front(Entry{ std::move(key), data_type });
+  index_.emplace(entries_.front().key, entries_.begin());
+}
+
+void RAPIDSymbolCache::erase(const abb_robot_msgs::msg::RAPIDSymbolPath& path)
+{
+  const std::string key = makeKey(path);
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  const auto it = index_.find(key);
+  if (it != index_.end())
+  {
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+}
+
+void RAPIDSymbolCache::clear()
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  entries_.clear();
+  index_.clear();
+  ++generation_;
+}
+
+std::string RAPIDSymbolCache::makeKey(const abb_robot_msgs::msg::RAPIDSymbolPath& path)
+{
+  // RAPID identifiers can not contain '/', so the key is unambiguous
+  return path.task + "/" + path.module + "/" + path.symbol;
+}
+}  // namespace abb_rws_client
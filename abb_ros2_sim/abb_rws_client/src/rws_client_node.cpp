@@ -1,8 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
+#include <diagnostic_msgs/msg/diagnostic_status.hpp>
+#include <diagnostic_msgs/msg/key_value.hpp>
 #include <rclcpp/rclcpp.hpp>
 
 #include <abb_rws_client/rws_service_provider_ros.hpp>
+#include <abb_rws_client/rws_session_pool.hpp>
 #include <abb_rws_client/rws_state_publisher_ros.hpp>
 
+namespace
+{
+diagnostic_msgs::msg::KeyValue makeKeyValue(const std::string& key, const std::string& value)
+{
+  diagnostic_msgs::msg::KeyValue key_value;
+  key_value.key = key;
+  key_value.value = value;
+  return key_value;
+}
+
+/**
+ * \brief Builds a diagnostic status per RWS endpoint, with its latencies in milliseconds.
+ *
+ * \param sessions with the endpoint metrics.
+ * \param hardware_id for the statuses.
+ * \param last_errors error counts at the previous publication, used to detect new errors.
+ *
+ * \return diagnostic_msgs::msg::DiagnosticArray with the statuses.
+ */
+diagnostic_msgs::msg::DiagnosticArray makeDiagnostics(const abb_rws_client::RWSSessionPool& sessions,
+                                                      const std::string& hardware_id,
+                                                      std::map<std::string, std::uint64_t>& last_errors)
+{
+  const auto to_ms = [](const double value_ns) { return std::to_string(value_ns * 1e-6); };
+
+  diagnostic_msgs::msg::DiagnosticArray array;
+  for (const auto& endpoint : sessions.summarize())
+  {
+    diagnostic_msgs::msg::DiagnosticStatus status;
+    status.name = "rws_client: " + endpoint.name;
+    status.hardware_id = hardware_id;
+
+    auto& last = last_errors[endpoint.name];
+    if (endpoint.errors != last)
+    {
+      status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+      status.message = "Failed requests since last report";
+    }
+    else
+    {
+      status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+      status.message = "OK";
+    }
+    last = endpoint.errors;
+
+    status.values.push_back(makeKeyValue("requests", std::to_string(endpoint.latency.count)));
+    status.values.push_back(makeKeyValue("errors", std::to_string(endpoint.errors)));
+    status.values.push_back(makeKeyValue("mean [ms]", to_ms(endpoint.latency.mean)));
+    status.values.push_back(makeKeyValue("p50 [ms]", to_ms(endpoint.latency.p50)));
+    status.values.push_back(makeKeyValue("p90 [ms]", to_ms(endpoint.latency.p90)));
+    status.values.push_back(makeKeyValue("p99 [ms]", to_ms(endpoint.latency.p99)));
+    status.values.push_back(makeKeyValue("max [ms]", to_ms(endpoint.latency.max)));
+    array.status.push_back(status);
+  }
+
+  diagnostic_msgs::msg::DiagnosticStatus status;
+  status.name = "rws_client: sessions";
+  status.hardware_id = hardware_id;
+  status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  status.message = "OK";
+  status.values.push_back(makeKeyValue("logins", std::to_string(sessions.logins())));
+  array.status.push_back(status);
+  return array;
+}
+}  // namespace
+
 int main(int argc, char** argv)
 {
   rclcpp::init(argc, argv);
@@ -11,14 +89,44 @@ int main(int argc, char** argv)
 
   client_node->declare_parameter("robot_nickname", std::string{});
   client_node->declare_parameter("no_connection_timeout", false);
+  client_node->declare_parameter("description_cache_dir", std::string{});
   std::string robot_ip = client_node->declare_parameter<std::string>("robot_ip", "127.0.0.1");
   int robot_port = client_node->declare_parameter<int>("robot_port", 65535);
+  int rws_sessions = client_node->declare_parameter<int>("rws_sessions", 5);
+  bool publish_diagnostics = client_node->declare_parameter<bool>("publish_diagnostics", false);
+  double diagnostics_period = client_node->declare_parameter<double>("diagnostics_period", 5.0);
+  if (publish_diagnostics && diagnostics_period <= 0.0)
+  {
+    throw std::runtime_error{ "The diagnostics_period must be positive" };
+  }
 
   client_node->get_parameter<std::string>("robot_ip", robot_ip);
   client_node->get_parameter<int>("robot_port", robot_port);
 
-  abb_rws_client::RWSServiceProviderROS srv_provider(client_node, robot_ip, robot_port);
-  abb_rws_client::RWSStatePublisherROS state_publisher(client_node, robot_ip, robot_port);
+  // The services and the state publisher share the RWS sessions, so that the client logs in once rather than per
+  // component, and its requests are only spread over more sessions while they overlap.
+  auto sessions = std::make_shared<abb_rws_client::RWSSessionPool>(robot_ip, robot_port,
+                                                                   static_cast<std::size_t>(std::max(rws_sessions, 1)));
+  abb_rws_client::RWSServiceProviderROS srv_provider(client_node, robot_ip, robot_port, sessions);
+  abb_rws_client::RWSStatePublisherROS state_publisher(client_node, robot_ip, robot_port, sessions);
+
+  rclcpp::Publisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_pub;
+  rclcpp::TimerBase::SharedPtr diagnostics_timer;
+  std::map<std::string, std::uint64_t> last_errors;
+  if (publish_diagnostics)
+  {
+    const std::string robot_nickname = client_node->get_parameter("robot_nickname").as_string();
+    const std::string hardware_id = robot_nickname.empty() ? robot_ip : robot_nickname;
+    diagnostics_pub = client_node->create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", 1);
+    diagnostics_timer =
+        client_node->create_wall_timer(std::chrono::duration<double>(diagnostics_period), [&, hardware_id]() {
+          auto array = makeDiagnostics(*sessions, hardware_id, last_errors);
+          array.header.stamp = client_node->now();
+          diagnostics_pub->publish(array);
+        });
+    RCLCPP_INFO(client_node->get_logger(), "Publishing RWS endpoint metrics on /diagnostics every %.2f s",
+                diagnostics_period);
+  }
 
   rclcpp::executors::MultiThreadedExecutor exec;
   exec.add_node(client_node);
@@ -0,0 +1,32 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <abb_rws_client/fleet_state_aggregator.hpp>
+
+int main(int argc, char** argv)
+{
+  rclcpp::init(argc, argv);
+
+  rclcpp::Node::SharedPtr fleet_node = rclcpp::Node::make_shared("rws_fleet");
+
+  // The polls run on the aggregator's own threads, so the executor only publishes
+  abb_rws_client::FleetStateAggregator aggregator(fleet_node);
+
+  rclcpp::spin(fleet_node);
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -40,6 +40,11 @@
 
 #include <abb_rws_client/rws_service_provider_ros.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
 #include <abb_robot_msgs/msg/service_responses.hpp>
 
 #include <abb_rws_client/mapping.hpp>
@@ -50,87 +55,94 @@ using RAPIDSymbols = abb::rws::RWSStateMachineInterface::ResourceIdentifiers::RA
 namespace abb_rws_client
 {
 RWSServiceProviderROS::RWSServiceProviderROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip,
-                                             unsigned short robot_port)
-  : node_(node)
-  , rws_manager_{ robot_ip, robot_port, abb::rws::SystemConstants::General::DEFAULT_USERNAME,
-                  abb::rws::SystemConstants::General::DEFAULT_PASSWORD }
+                                             unsigned short robot_port, std::shared_ptr<RWSSessionPool> sessions)
+  : node_(node), sessions_(std::move(sessions))
 {
-  std::string robot_id = node_->get_parameter("robot_nickname").as_string();
-  bool no_connection_timeout = node_->get_parameter("no_connection_timeout").as_bool();
-  robot_controller_description_ =
-      abb::robot::utilities::establishRWSConnection(rws_manager_, robot_id, no_connection_timeout);
+  if (!sessions_)
+  {
+    sessions_ = std::make_shared<RWSSessionPool>(robot_ip, robot_port, std::size_t{ NUM_SERVICE_CATEGORIES });
+  }
+  robot_controller_description_ = sessions_->describe(node_->get_parameter("robot_nickname").as_string(),
+                                                      node_->get_parameter("no_connection_timeout").as_bool(),
+                                                      node_->get_parameter("description_cache_dir").as_string());
   abb::robot::utilities::verifyRobotWareVersion(robot_controller_description_.header().robot_ware_version());
 
+  node_->declare_parameter("concurrent_services", false);
+  initializeCallbackGroups(node_->get_parameter("concurrent_services").as_bool());
+
+  node_->declare_parameter("file_transfer_max_size", 64 * 1024 * 1024);
+  const auto file_transfer_max_size = node_->get_parameter("file_transfer_max_size").as_int();
+  if (file_transfer_max_size <= 0)
+  {
+    throw std::runtime_error{ "The file_transfer_max_size must be positive" };
+  }
+  file_transfer_ = std::make_unique<FileTransfer>(static_cast<std::size_t>(file_transfer_max_size));
+
+  node_->declare_parameter("rapid_symbol_cache_size", 64);
+  const auto rapid_symbol_cache_size = node_->get_parameter("rapid_symbol_cache_size").as_int();
+  if (rapid_symbol_cache_size > 0)
+  {
+    rapid_symbol_cache_ = std::make_unique<RAPIDSymbolCache>(static_cast<std::size_t>(rapid_symbol_cache_size));
+  }
+
   system_state_sub_ = node_->create_subscription<abb_robot_msgs::msg::SystemState>(
       "~/system_states", 10, std::bind(&RWSServiceProviderROS::systemStateCallback, this, std::placeholders::_1));
   runtime_state_sub_ = node_->create_subscription<abb_rapid_sm_addin_msgs::msg::RuntimeState>(
       "~/sm_addin/runtime_states", 10,
       std::bind(&RWSServiceProviderROS::runtimeStateCallback, this, std::placeholders::_1));
 
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRobotControllerDescription>(
-      "~/get_robot_controller_description",
-      std::bind(&RWSServiceProviderROS::getRCDescription, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetFileContents>(
-      "~/get_file_contents",
-      std::bind(&RWSServiceProviderROS::getFileContents, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetIOSignal>(
-      "~/get_io_signal",
-      std::bind(&RWSServiceProviderROS::getIOSignal, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRAPIDBool>(
-      "~/get_rapid_bool",
-      std::bind(&RWSServiceProviderROS::getRAPIDBool, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRAPIDDnum>(
-      "~/get_rapid_dnum",
-      std::bind(&RWSServiceProviderROS::getRAPIDDNum, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRAPIDNum>(
-      "~/get_rapid_num",
-      std::bind(&RWSServiceProviderROS::getRAPIDNum, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRAPIDString>(
-      "~/get_rapid_string",
-      std::bind(&RWSServiceProviderROS::getRAPIDString, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetRAPIDSymbol>(
-      "~/get_rapid_symbol",
-      std::bind(&RWSServiceProviderROS::getRAPIDSymbol, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::GetSpeedRatio>(
-      "~/get_speed_ratio",
-      std::bind(&RWSServiceProviderROS::getSpeedRatio, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-      "~/pp_to_main", std::bind(&RWSServiceProviderROS::ppToMain, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetFileContents>(
-      "~/set_file_contents",
-      std::bind(&RWSServiceProviderROS::setFileContents, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetIOSignal>(
-      "~/set_io_signal",
-      std::bind(&RWSServiceProviderROS::setIOSignal, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-      "~/set_motors_off",
-      std::bind(&RWSServiceProviderROS::setMotorsOff, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-      "~/set_motors_on",
-      std::bind(&RWSServiceProviderROS::setMotorsOn, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetRAPIDBool>(
-      "~/set_rapid_bool",
-      std::bind(&RWSServiceProviderROS::setRAPIDBool, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetRAPIDDnum>(
-      "~/set_rapid_dnum",
-      std::bind(&RWSServiceProviderROS::setRAPIDDNum, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetRAPIDNum>(
-      "~/set_rapid_num",
-      std::bind(&RWSServiceProviderROS::setRAPIDNum, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetRAPIDString>(
-      "~/set_rapid_string",
-      std::bind(&RWSServiceProviderROS::setRAPIDString, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetRAPIDSymbol>(
-      "~/set_rapid_symbol",
-      std::bind(&RWSServiceProviderROS::setRAPIDSymbol, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::SetSpeedRatio>(
-      "~/set_speed_ratio",
-      std::bind(&RWSServiceProviderROS::setSpeedRatio, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-      "~/start_rapid",
-      std::bind(&RWSServiceProviderROS::startRAPID, this, std::placeholders::_1, std::placeholders::_2)));
-  core_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-      "~/stop_rapid", std::bind(&RWSServiceProviderROS::stopRAPID, this, std::placeholders::_1, std::placeholders::_2)));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRobotControllerDescription>(
+      "~/get_robot_controller_description", &RWSServiceProviderROS::getRCDescription, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetFileContents>(
+      "~/get_file_contents", &RWSServiceProviderROS::getFileContents, ServiceCategory::FILE_TRANSFER));
+  core_services_.push_back(createService<abb_rws_client_msgs::srv::GetFileChunk>(
+      "~/get_file_chunk", &RWSServiceProviderROS::getFileChunk, ServiceCategory::FILE_TRANSFER));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetIOSignal>(
+      "~/get_io_signal", &RWSServiceProviderROS::getIOSignal, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRAPIDBool>(
+      "~/get_rapid_bool", &RWSServiceProviderROS::getRAPIDBool, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRAPIDDnum>(
+      "~/get_rapid_dnum", &RWSServiceProviderROS::getRAPIDDNum, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRAPIDNum>(
+      "~/get_rapid_num", &RWSServiceProviderROS::getRAPIDNum, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRAPIDString>(
+      "~/get_rapid_string", &RWSServiceProviderROS::getRAPIDString, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetRAPIDSymbol>(
+      "~/get_rapid_symbol", &RWSServiceProviderROS::getRAPIDSymbol, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_rws_client_msgs::srv::GetRAPIDSymbols>(
+      "~/get_rapid_symbols", &RWSServiceProviderROS::getRAPIDSymbols, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::GetSpeedRatio>(
+      "~/get_speed_ratio", &RWSServiceProviderROS::getSpeedRatio, ServiceCategory::QUERY));
+  core_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+      "~/pp_to_main", &RWSServiceProviderROS::ppToMain, ServiceCategory::MOTION));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetFileContents>(
+      "~/set_file_contents", &RWSServiceProviderROS::setFileContents, ServiceCategory::FILE_TRANSFER));
+  core_services_.push_back(createService<abb_rws_client_msgs::srv::SetFileChunk>(
+      "~/set_file_chunk", &RWSServiceProviderROS::setFileChunk, ServiceCategory::FILE_TRANSFER));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetIOSignal>(
+      "~/set_io_signal", &RWSServiceProviderROS::setIOSignal, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+      "~/set_motors_off", &RWSServiceProviderROS::setMotorsOff, ServiceCategory::MOTION));
+  core_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+      "~/set_motors_on", &RWSServiceProviderROS::setMotorsOn, ServiceCategory::MOTION));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetRAPIDBool>(
+      "~/set_rapid_bool", &RWSServiceProviderROS::setRAPIDBool, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetRAPIDDnum>(
+      "~/set_rapid_dnum", &RWSServiceProviderROS::setRAPIDDNum, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetRAPIDNum>(
+      "~/set_rapid_num", &RWSServiceProviderROS::setRAPIDNum, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetRAPIDString>(
+      "~/set_rapid_string", &RWSServiceProviderROS::setRAPIDString, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetRAPIDSymbol>(
+      "~/set_rapid_symbol", &RWSServiceProviderROS::setRAPIDSymbol, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_rws_client_msgs::srv::SetRAPIDSymbols>(
+      "~/set_rapid_symbols", &RWSServiceProviderROS::setRAPIDSymbols, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::SetSpeedRatio>(
+      "~/set_speed_ratio", &RWSServiceProviderROS::setSpeedRatio, ServiceCategory::IO));
+  core_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+      "~/start_rapid", &RWSServiceProviderROS::startRAPID, ServiceCategory::MOTION));
+  core_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+      "~/stop_rapid", &RWSServiceProviderROS::stopRAPID, ServiceCategory::MOTION));
 
   const auto& system_indicators = robot_controller_description_.system_indicators();
 
@@ -151,59 +163,89 @@ RWSServiceProviderROS::RWSServiceProviderROS(const rclcpp::Node::SharedPtr& node
 
   if (has_sm_1_0 || has_sm_1_1)
   {
-    sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-        "~/run_rapid_routine",
-        std::bind(&RWSServiceProviderROS::runRAPIDRoutine, this, std::placeholders::_1, std::placeholders::_2)));
-    sm_services_.push_back(node_->create_service<abb_rapid_sm_addin_msgs::srv::SetRAPIDRoutine>(
-        "~/set_rapid_routine",
-        std::bind(&RWSServiceProviderROS::setRAPIDRoutine, this, std::placeholders::_1, std::placeholders::_2)));
+    sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+        "~/run_rapid_routine", &RWSServiceProviderROS::runRAPIDRoutine, ServiceCategory::MOTION));
+    sm_services_.push_back(createService<abb_rapid_sm_addin_msgs::srv::SetRAPIDRoutine>(
+        "~/set_rapid_routine", &RWSServiceProviderROS::setRAPIDRoutine, ServiceCategory::IO));
     if (system_indicators.options().egm())
     {
-      sm_services_.push_back(node_->create_service<abb_rapid_sm_addin_msgs::srv::GetEGMSettings>(
-          "~/get_egm_settings",
-          std::bind(&RWSServiceProviderROS::getEGMSettings, this, std::placeholders::_1, std::placeholders::_2)));
-      sm_services_.push_back(node_->create_service<abb_rapid_sm_addin_msgs::srv::SetEGMSettings>(
-          "~/set_egm_settings",
-          std::bind(&RWSServiceProviderROS::setEGMSettings, this, std::placeholders::_1, std::placeholders::_2)));
-      sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-          "~/start_egm_joint",
-          std::bind(&RWSServiceProviderROS::startEGMJoint, this, std::placeholders::_1, std::placeholders::_2)));
-      sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-          "~/start_egm_pose",
-          std::bind(&RWSServiceProviderROS::startEGMPose, this, std::placeholders::_1, std::placeholders::_2)));
-      sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-          "~/stop_egm", std::bind(&RWSServiceProviderROS::stopEGM, this, std::placeholders::_1, std::placeholders::_2)));
+      sm_services_.push_back(createService<abb_rapid_sm_addin_msgs::srv::GetEGMSettings>(
+          "~/get_egm_settings", &RWSServiceProviderROS::getEGMSettings, ServiceCategory::QUERY));
+      sm_services_.push_back(createService<abb_rapid_sm_addin_msgs::srv::SetEGMSettings>(
+          "~/set_egm_settings", &RWSServiceProviderROS::setEGMSettings, ServiceCategory::IO));
+      sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+          "~/start_egm_joint", &RWSServiceProviderROS::startEGMJoint, ServiceCategory::MOTION));
+      sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+          "~/start_egm_pose", &RWSServiceProviderROS::startEGMPose, ServiceCategory::MOTION));
+      sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+          "~/stop_egm", &RWSServiceProviderROS::stopEGM, ServiceCategory::MOTION));
       if (has_sm_1_1)
       {
-        sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-            "~/start_egm_stream",
-            std::bind(&RWSServiceProviderROS::startEGMStream, this, std::placeholders::_1, std::placeholders::_2)));
-        sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-            "~/stop_egm_stream",
-            std::bind(&RWSServiceProviderROS::stopEGMStream, this, std::placeholders::_1, std::placeholders::_2)));
+        sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+            "~/start_egm_stream", &RWSServiceProviderROS::startEGMStream, ServiceCategory::MOTION));
+        sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+            "~/stop_egm_stream", &RWSServiceProviderROS::stopEGMStream, ServiceCategory::MOTION));
       }
     }
 
     if (system_indicators.addins().smart_gripper())
     {
-      sm_services_.push_back(node_->create_service<abb_robot_msgs::srv::TriggerWithResultCode>(
-          "~/run_sg_routine",
-          std::bind(&RWSServiceProviderROS::runSGRoutine, this, std::placeholders::_1, std::placeholders::_2)));
-      sm_services_.push_back(node_->create_service<abb_rapid_sm_addin_msgs::srv::SetSGCommand>(
-          "~/set_sg_command",
-          std::bind(&RWSServiceProviderROS::setSGCommand, this, std::placeholders::_1, std::placeholders::_2)));
+      sm_services_.push_back(createService<abb_robot_msgs::srv::TriggerWithResultCode>(
+          "~/run_sg_routine", &RWSServiceProviderROS::runSGRoutine, ServiceCategory::MOTION));
+      sm_services_.push_back(createService<abb_rapid_sm_addin_msgs::srv::SetSGCommand>(
+          "~/set_sg_command", &RWSServiceProviderROS::setSGCommand, ServiceCategory::IO));
     }
   }
   RCLCPP_INFO(node_->get_logger(), "RWS client services initialized!");
 }
 
+void RWSServiceProviderROS::initializeCallbackGroups(bool concurrent)
+{
+  callback_groups_.resize(NUM_SERVICE_CATEGORIES);
+
+  // Each category gets a callback group of its own, so that e.g. a slow file transfer never blocks stopping RAPID.
+  // The services within a category are still executed one at a time, and borrow a session from the pool per request.
+  if (concurrent)
+  {
+    for (auto& callback_group : callback_groups_)
+    {
+      callback_group = node_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    }
+    RCLCPP_INFO_STREAM(node_->get_logger(), "Executing services concurrently, in " << NUM_SERVICE_CATEGORIES
+                                                                                   << " callback groups");
+  }
+}
+
+rclcpp::CallbackGroup::SharedPtr RWSServiceProviderROS::callbackGroup(ServiceCategory category) const
+{
+  return callback_groups_[static_cast<std::size_t>(category)];
+}
+
 void RWSServiceProviderROS::systemStateCallback(const abb_robot_msgs::msg::SystemState& msg)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
+
+  // Programs and modules are usually (re)loaded while their task is stopped, so the cached symbols are dropped
+  // whenever the execution of a task changes
+  bool rapid_changed = msg.rapid_running != system_state_.rapid_running ||
+                       msg.rapid_tasks.size() != system_state_.rapid_tasks.size();
+  for (std::size_t i = 0; !rapid_changed && i < msg.rapid_tasks.size(); ++i)
+  {
+    rapid_changed = msg.rapid_tasks[i].name != system_state_.rapid_tasks[i].name ||
+                    msg.rapid_tasks[i].activated != system_state_.rapid_tasks[i].activated ||
+                    msg.rapid_tasks[i].execution_state != system_state_.rapid_tasks[i].execution_state;
+  }
+  if (rapid_changed && rapid_symbol_cache_)
+  {
+    rapid_symbol_cache_->clear();
+  }
+
   system_state_ = msg;
 }
 
 void RWSServiceProviderROS::runtimeStateCallback(const abb_rapid_sm_addin_msgs::msg::RuntimeState& msg)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   runtime_state_ = msg;
 }
 
@@ -235,7 +277,7 @@ bool RWSServiceProviderROS::getFileContents(const abb_robot_msgs::srv::GetFileCo
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.getFile(abb::rws::RWSClient::FileResource(req->filename), &res->contents))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -251,6 +293,79 @@ bool RWSServiceProviderROS::getFileContents(const abb_robot_msgs::srv::GetFileCo
   return true;
 }
 
+bool RWSServiceProviderROS::getFileChunk(const abb_rws_client_msgs::srv::GetFileChunk::Request::SharedPtr req,
+                                         abb_rws_client_msgs::srv::GetFileChunk::Response::SharedPtr res)
+{
+  using GetFileChunk = abb_rws_client_msgs::srv::GetFileChunk;
+
+  if (!verifyArgumentFilename(req->filename, res->result_code, res->message))
+  {
+    return true;
+  }
+  if (req->compression != GetFileChunk::Request::COMPRESSION_NONE &&
+      req->compression != GetFileChunk::Request::COMPRESSION_ZLIB)
+  {
+    res->message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+    res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+    return true;
+  }
+
+  const auto offset = static_cast<std::size_t>(req->offset);
+  if (offset == 0 || !file_transfer_->hasDownload(req->filename, offset))
+  {
+    if (!verifyRWSManagerReady(res->result_code, res->message))
+    {
+      return true;
+    }
+
+    std::string contents;
+    bool retrieved = false;
+    sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
+      retrieved = interface.getFile(abb::rws::RWSClient::FileResource(req->filename), &contents);
+      if (!retrieved)
+      {
+        RCLCPP_DEBUG_STREAM(node_->get_logger(), interface.getLogTextLatestEvent());
+      }
+    });
+
+    if (retrieved && !file_transfer_->startDownload(req->filename, std::move(contents)))
+    {
+      RCLCPP_WARN_STREAM(node_->get_logger(), "File '" << req->filename << "' exceeds the maximum transfer size");
+      retrieved = false;
+    }
+    if (!retrieved || !file_transfer_->hasDownload(req->filename, offset))
+    {
+      res->message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+      res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+      return true;
+    }
+  }
+
+  std::string chunk;
+  std::size_t total_size = 0;
+  res->eof = file_transfer_->readChunk(req->filename, offset, req->max_size, chunk, total_size);
+  res->size = static_cast<uint32_t>(chunk.size());
+  res->total_size = total_size;
+
+  if (req->compression == GetFileChunk::Request::COMPRESSION_ZLIB)
+  {
+    if (!FileTransfer::compress(chunk, res->data))
+    {
+      res->message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+      res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+      return true;
+    }
+  }
+  else
+  {
+    res->data.assign(chunk.begin(), chunk.end());
+  }
+
+  res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
+
+  return true;
+}
+
 bool RWSServiceProviderROS::getIOSignal(const abb_robot_msgs::srv::GetIOSignal::Request::SharedPtr req,
                                         abb_robot_msgs::srv::GetIOSignal::Response::SharedPtr res)
 {
@@ -263,7 +378,7 @@ bool RWSServiceProviderROS::getIOSignal(const abb_robot_msgs::srv::GetIOSignal::
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     res->value = interface.getIOSignal(req->signal);
 
     if (!res->value.empty())
@@ -293,9 +408,9 @@ bool RWSServiceProviderROS::getRAPIDBool(const abb_robot_msgs::srv::GetRAPIDBool
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDBool rapid_bool;
-    if (interface.getRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, &rapid_bool))
+    if (getRAPIDSymbolData(interface, req->path, rapid_bool))
     {
       res->value = rapid_bool.value;
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -323,9 +438,9 @@ bool RWSServiceProviderROS::getRAPIDDNum(const abb_robot_msgs::srv::GetRAPIDDnum
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDDnum rapid_dnum;
-    if (interface.getRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, &rapid_dnum))
+    if (getRAPIDSymbolData(interface, req->path, rapid_dnum))
     {
       res->value = rapid_dnum.value;
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -353,9 +468,9 @@ bool RWSServiceProviderROS::getRAPIDNum(const abb_robot_msgs::srv::GetRAPIDNum::
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDNum rapid_num{};
-    if (interface.getRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, &rapid_num))
+    if (getRAPIDSymbolData(interface, req->path, rapid_num))
     {
       res->value = rapid_num.value;
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -383,9 +498,9 @@ bool RWSServiceProviderROS::getRAPIDString(const abb_robot_msgs::srv::GetRAPIDSt
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDString rapid_string{};
-    if (interface.getRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, &rapid_string))
+    if (getRAPIDSymbolData(interface, req->path, rapid_string))
     {
       res->value = rapid_string.value;
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -413,7 +528,7 @@ bool RWSServiceProviderROS::getRAPIDSymbol(const abb_robot_msgs::srv::GetRAPIDSy
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     res->value = interface.getRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol);
 
     if (!res->value.empty())
@@ -431,6 +546,83 @@ bool RWSServiceProviderROS::getRAPIDSymbol(const abb_robot_msgs::srv::GetRAPIDSy
   return true;
 }
 
+bool RWSServiceProviderROS::getRAPIDSymbols(const abb_rws_client_msgs::srv::GetRAPIDSymbols::Request::SharedPtr req,
+                                            abb_rws_client_msgs::srv::GetRAPIDSymbols::Response::SharedPtr res)
+{
+  res->symbols = req->symbols;
+  if (!verifyRWSManagerReady(res->result_code, res->message))
+  {
+    res->result_codes.assign(req->symbols.size(), res->result_code);
+    res->messages.assign(req->symbols.size(), res->message);
+    return true;
+  }
+  res->result_codes.assign(req->symbols.size(), abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS);
+  res->messages.assign(req->symbols.size(), std::string{});
+
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
+    for (std::size_t i = 0; i < res->symbols.size(); ++i)
+    {
+      auto& symbol = res->symbols[i];
+      if (!verifyArgumentRAPIDSymbolPath(symbol.path, res->result_codes[i], res->messages[i]))
+      {
+        continue;
+      }
+
+      bool success = false;
+      switch (symbol.type)
+      {
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_RAW:
+          symbol.value = interface.getRAPIDSymbolData(symbol.path.task, symbol.path.module, symbol.path.symbol);
+          success = !symbol.value.empty();
+          break;
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_BOOL:
+        {
+          abb::rws::RAPIDBool rapid_bool;
+          success = getRAPIDSymbolData(interface, symbol.path, rapid_bool);
+          symbol.value = success ? rapid_bool.constructString() : std::string{};
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_NUM:
+        {
+          abb::rws::RAPIDNum rapid_num{};
+          success = getRAPIDSymbolData(interface, symbol.path, rapid_num);
+          symbol.value = success ? rapid_num.constructString() : std::string{};
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_DNUM:
+        {
+          abb::rws::RAPIDDnum rapid_dnum;
+          success = getRAPIDSymbolData(interface, symbol.path, rapid_dnum);
+          symbol.value = success ? rapid_dnum.constructString() : std::string{};
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_STRING:
+        {
+          abb::rws::RAPIDString rapid_string{};
+          success = getRAPIDSymbolData(interface, symbol.path, rapid_string);
+          symbol.value = success ? rapid_string.value : std::string{};
+          break;
+        }
+        default:
+          symbol.value.clear();
+          res->messages[i] = abb_rws_client_msgs::msg::RAPIDSymbolValue::INVALID_TYPE;
+          res->result_codes[i] = abb_rws_client_msgs::msg::RAPIDSymbolValue::RC_INVALID_TYPE;
+          continue;
+      }
+
+      if (!success)
+      {
+        res->messages[i] = abb_robot_msgs::msg::ServiceResponses::FAILED;
+        res->result_codes[i] = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+        RCLCPP_DEBUG_STREAM(node_->get_logger(), interface.getLogTextLatestEvent());
+      }
+    }
+  });
+
+  setBatchResult(res->result_codes, res->result_code, res->message);
+  return true;
+}
+
 bool RWSServiceProviderROS::getSpeedRatio(const abb_robot_msgs::srv::GetSpeedRatio::Request::SharedPtr,
                                           abb_robot_msgs::srv::GetSpeedRatio::Response::SharedPtr res)
 {
@@ -439,7 +631,7 @@ bool RWSServiceProviderROS::getSpeedRatio(const abb_robot_msgs::srv::GetSpeedRat
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     try
     {
       res->speed_ratio = interface.getSpeedRatio();
@@ -472,9 +664,13 @@ bool RWSServiceProviderROS::ppToMain(const abb_robot_msgs::srv::TriggerWithResul
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.resetRAPIDProgramPointer())
     {
+      if (rapid_symbol_cache_)
+      {
+        rapid_symbol_cache_->clear();
+      }
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
     else
@@ -499,7 +695,7 @@ bool RWSServiceProviderROS::setFileContents(const abb_robot_msgs::srv::SetFileCo
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.uploadFile(abb::rws::RWSClient::FileResource(req->filename), req->contents))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -515,6 +711,69 @@ bool RWSServiceProviderROS::setFileContents(const abb_robot_msgs::srv::SetFileCo
   return true;
 }
 
+bool RWSServiceProviderROS::setFileChunk(const abb_rws_client_msgs::srv::SetFileChunk::Request::SharedPtr req,
+                                         abb_rws_client_msgs::srv::SetFileChunk::Response::SharedPtr res)
+{
+  using SetFileChunk = abb_rws_client_msgs::srv::SetFileChunk;
+
+  if (!verifyArgumentFilename(req->filename, res->result_code, res->message))
+  {
+    return true;
+  }
+
+  std::string chunk;
+  bool decoded = true;
+  if (req->compression == SetFileChunk::Request::COMPRESSION_ZLIB)
+  {
+    decoded = FileTransfer::decompress(req->data, FileTransfer::MAX_CHUNK_SIZE, chunk);
+  }
+  else if (req->compression == SetFileChunk::Request::COMPRESSION_NONE)
+  {
+    chunk.assign(req->data.begin(), req->data.end());
+  }
+  else
+  {
+    decoded = false;
+  }
+
+  if (!decoded || !file_transfer_->addChunk(req->filename, static_cast<std::size_t>(req->offset), chunk))
+  {
+    res->received_size = file_transfer_->uploadSize(req->filename);
+    res->message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+    res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+    return true;
+  }
+  res->received_size = file_transfer_->uploadSize(req->filename);
+
+  if (!req->last)
+  {
+    res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
+    return true;
+  }
+  if (!verifyRWSManagerReady(res->result_code, res->message))
+  {
+    return true;
+  }
+
+  auto contents = file_transfer_->finishUpload();
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
+    if (interface.uploadFile(abb::rws::RWSClient::FileResource(req->filename), contents))
+    {
+      res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
+    }
+    else
+    {
+      // Keeps the staged contents, so that the upload can be retried by resending the last chunk.
+      file_transfer_->addChunk(req->filename, 0, contents);
+      res->message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+      res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+      RCLCPP_DEBUG_STREAM(node_->get_logger(), interface.getLogTextLatestEvent());
+    }
+  });
+
+  return true;
+}
+
 bool RWSServiceProviderROS::setIOSignal(const abb_robot_msgs::srv::SetIOSignal::Request::SharedPtr req,
                                         abb_robot_msgs::srv::SetIOSignal::Response::SharedPtr res)
 {
@@ -527,7 +786,7 @@ bool RWSServiceProviderROS::setIOSignal(const abb_robot_msgs::srv::SetIOSignal::
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.setIOSignal(req->signal, req->value))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -551,7 +810,7 @@ bool RWSServiceProviderROS::setMotorsOff(const abb_robot_msgs::srv::TriggerWithR
     return true;
   }
 
-  rws_manager_.runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.setMotorsOff())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -582,7 +841,7 @@ bool RWSServiceProviderROS::setMotorsOn(const abb_robot_msgs::srv::TriggerWithRe
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.setMotorsOn())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -613,9 +872,9 @@ bool RWSServiceProviderROS::setRAPIDBool(const abb_robot_msgs::srv::SetRAPIDBool
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDBool rapid_bool = static_cast<bool>(req->value);
-    if (interface.setRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, rapid_bool))
+    if (setRAPIDSymbolData(interface, req->path, rapid_bool))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
@@ -646,9 +905,9 @@ bool RWSServiceProviderROS::setRAPIDDNum(const abb_robot_msgs::srv::SetRAPIDDnum
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDDnum rapid_dnum = req->value;
-    if (interface.setRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, rapid_dnum))
+    if (setRAPIDSymbolData(interface, req->path, rapid_dnum))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
@@ -679,9 +938,9 @@ bool RWSServiceProviderROS::setRAPIDNum(const abb_robot_msgs::srv::SetRAPIDNum::
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDNum rapid_num = req->value;
-    if (interface.setRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, rapid_num))
+    if (setRAPIDSymbolData(interface, req->path, rapid_num))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
@@ -712,9 +971,9 @@ bool RWSServiceProviderROS::setRAPIDString(const abb_robot_msgs::srv::SetRAPIDSt
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDString rapid_string = req->value;
-    if (interface.setRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, rapid_string))
+    if (setRAPIDSymbolData(interface, req->path, rapid_string))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
@@ -745,7 +1004,7 @@ bool RWSServiceProviderROS::setRAPIDSymbol(const abb_robot_msgs::srv::SetRAPIDSy
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.setRAPIDSymbolData(req->path.task, req->path.module, req->path.symbol, req->value))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -761,6 +1020,81 @@ bool RWSServiceProviderROS::setRAPIDSymbol(const abb_robot_msgs::srv::SetRAPIDSy
   return true;
 }
 
+bool RWSServiceProviderROS::setRAPIDSymbols(const abb_rws_client_msgs::srv::SetRAPIDSymbols::Request::SharedPtr req,
+                                            abb_rws_client_msgs::srv::SetRAPIDSymbols::Response::SharedPtr res)
+{
+  if (!verifyAutoMode(res->result_code, res->message) ||
+      !verifyRWSManagerReady(res->result_code, res->message))
+  {
+    res->result_codes.assign(req->symbols.size(), res->result_code);
+    res->messages.assign(req->symbols.size(), res->message);
+    return true;
+  }
+  res->result_codes.assign(req->symbols.size(), abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS);
+  res->messages.assign(req->symbols.size(), std::string{});
+
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
+    for (std::size_t i = 0; i < req->symbols.size(); ++i)
+    {
+      const auto& symbol = req->symbols[i];
+      if (!verifyArgumentRAPIDSymbolPath(symbol.path, res->result_codes[i], res->messages[i]))
+      {
+        continue;
+      }
+
+      bool success = false;
+      switch (symbol.type)
+      {
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_RAW:
+          success =
+              interface.setRAPIDSymbolData(symbol.path.task, symbol.path.module, symbol.path.symbol, symbol.value);
+          break;
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_BOOL:
+        {
+          abb::rws::RAPIDBool rapid_bool;
+          rapid_bool.parseString(symbol.value);
+          success = setRAPIDSymbolData(interface, symbol.path, rapid_bool);
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_NUM:
+        {
+          abb::rws::RAPIDNum rapid_num{};
+          rapid_num.parseString(symbol.value);
+          success = setRAPIDSymbolData(interface, symbol.path, rapid_num);
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_DNUM:
+        {
+          abb::rws::RAPIDDnum rapid_dnum;
+          rapid_dnum.parseString(symbol.value);
+          success = setRAPIDSymbolData(interface, symbol.path, rapid_dnum);
+          break;
+        }
+        case abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_STRING:
+        {
+          abb::rws::RAPIDString rapid_string = symbol.value;
+          success = setRAPIDSymbolData(interface, symbol.path, rapid_string);
+          break;
+        }
+        default:
+          res->messages[i] = abb_rws_client_msgs::msg::RAPIDSymbolValue::INVALID_TYPE;
+          res->result_codes[i] = abb_rws_client_msgs::msg::RAPIDSymbolValue::RC_INVALID_TYPE;
+          continue;
+      }
+
+      if (!success)
+      {
+        res->messages[i] = abb_robot_msgs::msg::ServiceResponses::FAILED;
+        res->result_codes[i] = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+        RCLCPP_DEBUG_STREAM(node_->get_logger(), interface.getLogTextLatestEvent());
+      }
+    }
+  });
+
+  setBatchResult(res->result_codes, res->result_code, res->message);
+  return true;
+}
+
 bool RWSServiceProviderROS::setSpeedRatio(const abb_robot_msgs::srv::SetSpeedRatio::Request::SharedPtr req,
                                           abb_robot_msgs::srv::SetSpeedRatio::Response::SharedPtr res)
 {
@@ -773,7 +1107,7 @@ bool RWSServiceProviderROS::setSpeedRatio(const abb_robot_msgs::srv::SetSpeedRat
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     try
     {
       if (interface.setSpeedRatio(req->speed_ratio))
@@ -812,7 +1146,7 @@ bool RWSServiceProviderROS::startRAPID(const abb_robot_msgs::srv::TriggerWithRes
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.startRAPIDExecution())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -835,7 +1169,7 @@ bool RWSServiceProviderROS::stopRAPID(const abb_robot_msgs::srv::TriggerWithResu
     return true;
   }
 
-  rws_manager_.runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.stopRAPIDExecution())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -874,12 +1208,12 @@ bool RWSServiceProviderROS::getEGMSettings(const abb_rapid_sm_addin_msgs::srv::G
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RWSStateMachineInterface::EGMSettings settings;
 
     if (interface.services().egm().getSettings(req->task, &settings))
     {
-      res->settings = abb::robot::utilities::map(settings);
+      abb::robot::utilities::map(settings, res->settings);
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
     }
     else
@@ -921,8 +1255,9 @@ bool RWSServiceProviderROS::setEGMSettings(const abb_rapid_sm_addin_msgs::srv::S
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
-    abb::rws::RWSStateMachineInterface::EGMSettings settings = abb::robot::utilities::map(req->settings);
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
+    abb::rws::RWSStateMachineInterface::EGMSettings settings;
+    abb::robot::utilities::map(req->settings, settings);
 
     if (interface.services().egm().setSettings(req->task, settings))
     {
@@ -959,7 +1294,7 @@ bool RWSServiceProviderROS::runRAPIDRoutine(const abb_robot_msgs::srv::TriggerWi
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().rapid().signalRunRAPIDRoutine())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -995,7 +1330,7 @@ bool RWSServiceProviderROS::runSGRoutine(const abb_robot_msgs::srv::TriggerWithR
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().sg().signalRunSGRoutine())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1039,7 +1374,7 @@ bool RWSServiceProviderROS::setRAPIDRoutine(const abb_rapid_sm_addin_msgs::srv::
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().rapid().setRoutineName(req->task, req->routine))
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1095,7 +1430,7 @@ bool RWSServiceProviderROS::setSGCommand(const abb_rapid_sm_addin_msgs::srv::Set
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     abb::rws::RAPIDNum sg_command_input = static_cast<float>(req_command);
     abb::rws::RAPIDNum sg_target_position_input = req->target_position;
 
@@ -1135,7 +1470,7 @@ bool RWSServiceProviderROS::startEGMJoint(const abb_robot_msgs::srv::TriggerWith
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().egm().signalEGMStartJoint())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1171,7 +1506,7 @@ bool RWSServiceProviderROS::startEGMPose(const abb_robot_msgs::srv::TriggerWithR
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().egm().signalEGMStartPose())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1207,7 +1542,7 @@ bool RWSServiceProviderROS::startEGMStream(const abb_robot_msgs::srv::TriggerWit
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().egm().signalEGMStartStream())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1239,7 +1574,7 @@ bool RWSServiceProviderROS::stopEGM(const abb_robot_msgs::srv::TriggerWithResult
     return true;
   }
 
-  rws_manager_.runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runPriorityService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().egm().signalEGMStop())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1271,7 +1606,7 @@ bool RWSServiceProviderROS::stopEGMStream(const abb_robot_msgs::srv::TriggerWith
     return true;
   }
 
-  rws_manager_.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+  sessions_->runService([&](abb::rws::RWSStateMachineInterface& interface) {
     if (interface.services().egm().signalEGMStopStream())
     {
       res->result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
@@ -1293,6 +1628,7 @@ bool RWSServiceProviderROS::stopEGMStream(const abb_robot_msgs::srv::TriggerWith
 
 bool RWSServiceProviderROS::verifyAutoMode(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (!system_state_.auto_mode)
   {
     message = abb_robot_msgs::msg::ServiceResponses::NOT_IN_AUTO_MODE;
@@ -1370,6 +1706,7 @@ bool RWSServiceProviderROS::verifyArgumentSignal(const std::string& signal, uint
 
 bool RWSServiceProviderROS::verifyMotorsOff(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (system_state_.motors_on)
   {
     message = abb_robot_msgs::msg::ServiceResponses::MOTORS_ARE_ON;
@@ -1382,6 +1719,7 @@ bool RWSServiceProviderROS::verifyMotorsOff(uint16_t& result_code, std::string&
 
 bool RWSServiceProviderROS::verifyMotorsOn(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (!system_state_.motors_on)
   {
     message = abb_robot_msgs::msg::ServiceResponses::MOTORS_ARE_OFF;
@@ -1394,6 +1732,7 @@ bool RWSServiceProviderROS::verifyMotorsOn(uint16_t& result_code, std::string& m
 
 bool RWSServiceProviderROS::verifySMAddinRuntimeStates(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (runtime_state_.state_machines.empty())
   {
     message = abb_robot_msgs::msg::ServiceResponses::SM_RUNTIME_STATES_MISSING;
@@ -1406,6 +1745,7 @@ bool RWSServiceProviderROS::verifySMAddinRuntimeStates(uint16_t& result_code, st
 
 bool RWSServiceProviderROS::verifySMAddinTaskExist(const std::string& task, uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   auto it = std::find_if(runtime_state_.state_machines.begin(), runtime_state_.state_machines.end(),
                          [&](const auto& sm) { return sm.rapid_task == task; });
 
@@ -1422,14 +1762,18 @@ bool RWSServiceProviderROS::verifySMAddinTaskExist(const std::string& task, uint
 bool RWSServiceProviderROS::verifySMAddinTaskInitialized(const std::string& task, uint16_t& result_code,
                                                          std::string& message)
 {
-  if (!verifySMAddinTaskExist(task, result_code, message))
+  // The task is looked up under the same lock (verifySMAddinTaskExist() would lock the mutex again)
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
+  auto it = std::find_if(runtime_state_.state_machines.begin(), runtime_state_.state_machines.end(),
+                         [&](const auto& sm) { return sm.rapid_task == task; });
+
+  if (it == runtime_state_.state_machines.end())
   {
+    message = abb_robot_msgs::msg::ServiceResponses::SM_UNKNOWN_RAPID_TASK;
+    result_code = abb_robot_msgs::msg::ServiceResponses::RC_SM_UNKNOWN_RAPID_TASK;
     return false;
   }
 
-  auto it = std::find_if(runtime_state_.state_machines.begin(), runtime_state_.state_machines.end(),
-                         [&](const auto& sm) { return sm.rapid_task == task; });
-
   if (it->sm_state == abb_rapid_sm_addin_msgs::msg::StateMachineState::SM_STATE_UNKNOWN ||
       it->sm_state == abb_rapid_sm_addin_msgs::msg::StateMachineState::SM_STATE_INITIALIZE)
   {
@@ -1443,6 +1787,7 @@ bool RWSServiceProviderROS::verifySMAddinTaskInitialized(const std::string& task
 
 bool RWSServiceProviderROS::verifyRAPIDRunning(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (!system_state_.rapid_running)
   {
     message = abb_robot_msgs::msg::ServiceResponses::RAPID_NOT_RUNNING;
@@ -1455,6 +1800,7 @@ bool RWSServiceProviderROS::verifyRAPIDRunning(uint16_t& result_code, std::strin
 
 bool RWSServiceProviderROS::verifyRAPIDStopped(uint16_t& result_code, std::string& message)
 {
+  std::lock_guard<std::mutex> lock{ state_mutex_ };
   if (system_state_.rapid_running)
   {
     message = abb_robot_msgs::msg::ServiceResponses::RAPID_NOT_STOPPED;
@@ -1467,7 +1813,7 @@ bool RWSServiceProviderROS::verifyRAPIDStopped(uint16_t& result_code, std::strin
 
 bool RWSServiceProviderROS::verifyRWSManagerReady(uint16_t& result_code, std::string& message)
 {
-  if (!rws_manager_.isInterfaceReady())
+  if (!sessions_->isInterfaceReady())
   {
     message = abb_robot_msgs::msg::ServiceResponses::SERVER_IS_BUSY;
     result_code = abb_robot_msgs::msg::ServiceResponses::RC_SERVER_IS_BUSY;
@@ -1476,4 +1822,80 @@ bool RWSServiceProviderROS::verifyRWSManagerReady(uint16_t& result_code, std::st
 
   return true;
 }
+
+void RWSServiceProviderROS::setBatchResult(const std::vector<uint16_t>& result_codes, uint16_t& result_code,
+                                           std::string& message)
+{
+  const bool all_succeeded =
+      std::all_of(result_codes.begin(), result_codes.end(),
+                  [](const uint16_t code) { return code == abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS; });
+  if (all_succeeded)
+  {
+    message = abb_robot_msgs::msg::ServiceResponses::SUCCESS;
+    result_code = abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS;
+  }
+  else
+  {
+    message = abb_robot_msgs::msg::ServiceResponses::FAILED;
+    result_code = abb_robot_msgs::msg::ServiceResponses::RC_FAILED;
+  }
+}
+
+bool RWSServiceProviderROS::getRAPIDSymbolData(abb::rws::RWSStateMachineInterface& interface,
+                                               const abb_robot_msgs::msg::RAPIDSymbolPath& path,
+                                               abb::rws::RAPIDSymbolDataAbstract& data)
+{
+  if (!rapid_symbol_cache_)
+  {
+    return interface.getRAPIDSymbolData(path.task, path.module, path.symbol, &data);
+  }
+
+  // The data type of a cached symbol is known, so only its value is requested
+  if (rapid_symbol_cache_->contains(path, data.getType()))
+  {
+    const std::string value = interface.getRAPIDSymbolData(path.task, path.module, path.symbol);
+    if (!value.empty())
+    {
+      data.parseString(value);
+      return true;
+    }
+    rapid_symbol_cache_->erase(path);
+  }
+
+  const auto generation = rapid_symbol_cache_->generation();
+  if (!interface.getRAPIDSymbolData(path.task, path.module, path.symbol, &data))
+  {
+    return false;
+  }
+  rapid_symbol_cache_->insert(path, data.getType(), generation);
+  return true;
+}
+
+bool RWSServiceProviderROS::setRAPIDSymbolData(abb::rws::RWSStateMachineInterface& interface,
+                                               const abb_robot_msgs::msg::RAPIDSymbolPath& path,
+                                               const abb::rws::RAPIDSymbolDataAbstract& data)
+{
+  if (!rapid_symbol_cache_)
+  {
+    return interface.setRAPIDSymbolData(path.task, path.module, path.symbol, data);
+  }
+
+  // A failed raw write is retried as a typed write, which reports a changed data type instead of writing the value
+  if (rapid_symbol_cache_->contains(path, data.getType()))
+  {
+    if (interface.setRAPIDSymbolData(path.task, path.module, path.symbol, data.constructString()))
+    {
+      return true;
+    }
+    rapid_symbol_cache_->erase(path);
+  }
+
+  const auto generation = rapid_symbol_cache_->generation();
+  if (!interface.setRAPIDSymbolData(path.task, path.module, path.symbol, data))
+  {
+    return false;
+  }
+  rapid_symbol_cache_->insert(path, data.getType(), generation);
+  return true;
+}
 }  // namespace abb_rws_client
@@ -0,0 +1,228 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/rws_session_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <abb_hardware_interface/utilities.hpp>
+
+namespace abb_rws_client
+{
+RWSSessionPool::RWSSessionPool(const std::string& robot_ip, const unsigned short robot_port,
+                               const std::size_t max_sessions)
+  : robot_ip_(robot_ip), robot_port_(robot_port), max_sessions_(std::max<std::size_t>(max_sessions, 1))
+{
+  sessions_.reserve(max_sessions_);
+}
+
+abb::robot::RobotControllerDescription RWSSessionPool::describe(const std::string& robot_id,
+                                                                const bool no_connection_timeout,
+                                                                const std::string& cache_dir)
+{
+  std::lock_guard<std::mutex> lock{ description_mutex_ };
+  if (description_)
+  {
+    return *description_;
+  }
+
+  Session& session = acquire();
+  try
+  {
+    abb::robot::RWSManager& rws_manager = *session.rws_manager;
+    const auto establish_connection = [&rws_manager, &robot_id, no_connection_timeout]() {
+      return abb::robot::utilities::establishRWSConnection(rws_manager, robot_id, no_connection_timeout);
+    };
+    if (!cache_dir.empty())
+    {
+      description_manager_ = session.rws_manager;
+      description_cache_ =
+          std::make_unique<abb::robot::utilities::DescriptionCache>(cache_dir, robot_ip_, robot_port_, robot_id);
+      description_ = std::make_unique<abb::robot::RobotControllerDescription>(
+          description_cache_->get(rws_manager, establish_connection));
+    }
+    else
+    {
+      description_ = std::make_unique<abb::robot::RobotControllerDescription>(establish_connection());
+    }
+  }
+  catch (...)
+  {
+    release(session, true);
+    throw;
+  }
+  release(session, false);
+  return *description_;
+}
+
+void RWSSessionPool::run(const std::function<void(abb::robot::RWSManager&)>& task)
+{
+  Session& session = acquire();
+  try
+  {
+    task(*session.rws_manager);
+  }
+  catch (...)
+  {
+    release(session, true);
+    throw;
+  }
+  release(session, false);
+}
+
+void RWSSessionPool::run(EndpointMetrics& metrics, const std::function<void(abb::robot::RWSManager&)>& task)
+{
+  // The wait for a free session is part of the latency, since it is what the caller sees
+  const auto start = std::chrono::steady_clock::now();
+  const auto elapsed_ns = [&start]() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  };
+  try
+  {
+    run(task);
+  }
+  catch (...)
+  {
+    metrics.record(elapsed_ns(), true);
+    throw;
+  }
+  metrics.record(elapsed_ns(), false);
+}
+
+void RWSSessionPool::runService(const std::function<void(abb::rws::RWSStateMachineInterface&)>& service)
+{
+  run([&service](abb::robot::RWSManager& rws_manager) { rws_manager.runService(service); });
+}
+
+void RWSSessionPool::runPriorityService(const std::function<void(abb::rws::RWSStateMachineInterface&)>& service)
+{
+  std::shared_ptr<abb::robot::RWSManager> busy_manager;
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    const bool available =
+        sessions_.size() < max_sessions_ ||
+        std::any_of(sessions_.begin(), sessions_.end(),
+                    [](const std::unique_ptr<Session>& session) { return !session->in_use; });
+    if (!available)
+    {
+      busy_manager = sessions_.front()->rws_manager;
+    }
+  }
+
+  if (busy_manager)
+  {
+    busy_manager->runPriorityService(service);
+    return;
+  }
+  run([&service](abb::robot::RWSManager& rws_manager) { rws_manager.runPriorityService(service); });
+}
+
+bool RWSSessionPool::isInterfaceReady() const
+{
+  // Stale sessions are replaced by fresh ones before their next request, so they do not count as not ready
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return sessions_.empty() ||
+         std::any_of(sessions_.begin(), sessions_.end(), [](const std::unique_ptr<Session>& session) {
+           return session->stale || session->rws_manager->isInterfaceReady();
+         });
+}
+
+EndpointMetrics& RWSSessionPool::endpoint(const std::string& name)
+{
+  std::lock_guard<std::mutex> lock{ endpoints_mutex_ };
+  auto& metrics = endpoints_[name];
+  if (!metrics)
+  {
+    metrics = std::make_unique<EndpointMetrics>();
+  }
+  return *metrics;
+}
+
+std::vector<EndpointSummary> RWSSessionPool::summarize() const
+{
+  std::lock_guard<std::mutex> lock{ endpoints_mutex_ };
+  std::vector<EndpointSummary> summaries;
+  summaries.reserve(endpoints_.size());
+  for (const auto& endpoint : endpoints_)
+  {
+    EndpointSummary summary;
+    summary.name = endpoint.first;
+    summary.latency = endpoint.second->latency.summarize();
+    summary.errors = endpoint.second->errors.load(std::memory_order_relaxed);
+    summaries.push_back(std::move(summary));
+  }
+  return summaries;
+}
+
+std::uint64_t RWSSessionPool::logins() const
+{
+  std::lock_guard<std::mutex> lock{ mutex_ };
+  return logins_;
+}
+
+RWSSessionPool::Session& RWSSessionPool::acquire()
+{
+  // A replaced manager logs out when it is destroyed, which happens after the lock is released
+  std::shared_ptr<abb::robot::RWSManager> replaced;
+  std::unique_lock<std::mutex> lock{ mutex_ };
+  Session* free_session = nullptr;
+  released_.wait(lock, [this, &free_session]() {
+    // The first free session is handed out, so that the later ones are only created (and logged in) under load
+    for (const auto& session : sessions_)
+    {
+      if (!session->in_use)
+      {
+        free_session = session.get();
+        return true;
+      }
+    }
+    return sessions_.size() < max_sessions_;
+  });
+
+  if (!free_session)
+  {
+    sessions_.push_back(std::make_unique<Session>());
+    free_session = sessions_.back().get();
+    free_session->rws_manager = makeManager();
+  }
+  else if (free_session->stale)
+  {
+    replaced = std::move(free_session->rws_manager);
+    free_session->rws_manager = makeManager();
+    free_session->stale = false;
+  }
+  free_session->in_use = true;
+  return *free_session;
+}
+
+void RWSSessionPool::release(Session& session, const bool failed)
+{
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    session.in_use = false;
+    session.stale = session.stale || failed;
+  }
+  released_.notify_one();
+}
+
+std::shared_ptr<abb::robot::RWSManager> RWSSessionPool::makeManager()
+{
+  // The manager logs in with its first request, i.e. outside of the pool's lock
+  ++logins_;
+  return std::make_shared<abb::robot::RWSManager>(robot_ip_, robot_port_,
+                                                  abb::rws::SystemConstants::General::DEFAULT_USERNAME,
+                                                  abb::rws::SystemConstants::General::DEFAULT_PASSWORD);
+}
+}  // namespace abb_rws_client
@@ -43,28 +43,124 @@
 #include <abb_rws_client/mapping.hpp>
 #include <abb_hardware_interface/utilities.hpp>
 
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
 namespace
 {
 /**
  * \brief Time [s] for throttled ROS logging.
  */
 constexpr double THROTTLE_TIME{ 10.0 };
+
+/**
+ * \brief Period for attempting to open the state bridge, until the hardware interface has created it.
+ */
+constexpr std::chrono::seconds BRIDGE_ATTEMPT_PERIOD{ 1 };
+
+/**
+ * \brief Prefixes of the resources that IO-signal and RAPID symbol subscription events are about.
+ */
+const std::string IO_SIGNALS_RESOURCE{ "/rw/iosystem/signals/" };
+const std::string RAPID_SYMBOLS_RESOURCE{ "/rw/rapid/symbol/data/RAPID/" };
+
+/**
+ * \brief Updates a message field, and flags if the value changed.
+ *
+ * \param field to update.
+ * \param value to set.
+ * \param changed set to true if the value differs from the field's previous value.
+ */
+template <typename T, typename U>
+void update(T& field, const U& value, bool& changed)
+{
+  if (field != value)
+  {
+    field = value;
+    changed = true;
+  }
+}
+
+/**
+ * \brief Resizes a message sequence, and flags if the size changed.
+ *
+ * \param sequence to resize.
+ * \param size to set.
+ * \param changed set to true if the size differs from the sequence's previous size.
+ */
+template <typename T>
+void resize(std::vector<T>& sequence, std::size_t size, bool& changed)
+{
+  if (sequence.size() != size)
+  {
+    sequence.resize(size);
+    changed = true;
+  }
+}
+
+/**
+ * \brief Checks if a string ends with a suffix.
+ *
+ * \param str to check.
+ * \param suffix to look for.
+ *
+ * \return bool true if str ends with suffix.
+ */
+bool endsWith(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+/**
+ * \brief Publishes a message, via a loaned message if the middleware supports it.
+ *
+ * \param publisher to publish with.
+ * \param msg to publish.
+ */
+template <typename MessageT>
+void publishMessage(rclcpp::Publisher<MessageT>& publisher, const MessageT& msg)
+{
+  if (publisher.can_loan_messages())
+  {
+    auto loaned_msg = publisher.borrow_loaned_message();
+    loaned_msg.get() = msg;
+    publisher.publish(std::move(loaned_msg));
+  }
+  else
+  {
+    publisher.publish(msg);
+  }
+}
 }  // namespace
 
 namespace abb_rws_client
 {
 RWSStatePublisherROS::RWSStatePublisherROS(const rclcpp::Node::SharedPtr& node, const std::string& robot_ip,
-                                           unsigned short robot_port)
-  : node_(node)
-  , rws_manager_{ robot_ip, robot_port, abb::rws::SystemConstants::General::DEFAULT_USERNAME,
-                  abb::rws::SystemConstants::General::DEFAULT_PASSWORD }
+                                           unsigned short robot_port, std::shared_ptr<RWSSessionPool> sessions)
+  : node_(node), sessions_(std::move(sessions))
 {
+  if (!sessions_)
+  {
+    sessions_ = std::make_shared<RWSSessionPool>(robot_ip, robot_port, 1);
+  }
+  runtime_data_metrics_ = &sessions_->endpoint("poll_runtime_data");
+  subscribed_values_metrics_ = &sessions_->endpoint("poll_subscribed_values");
+
   node_->declare_parameter("polling_rate", 5.0);
+  node_->declare_parameter("publish_on_change_only", false);
+  node_->declare_parameter("use_subscriptions", false);
+  node_->declare_parameter("fallback_polling_rate", 1.0);
+  node_->declare_parameter("subscription_io_signals", std::vector<std::string>{});
+  node_->declare_parameter("subscription_rapid_symbols", std::vector<std::string>{});
+  node_->declare_parameter("state_bridge", std::string{});
+  node_->declare_parameter("state_bridge_rate", 50.0);
+  node_->declare_parameter("state_bridge_timeout", 0.1);
 
-  std::string robot_id = node_->get_parameter("robot_nickname").as_string();
-  bool no_connection_timeout = node_->get_parameter("no_connection_timeout").as_bool();
-  robot_controller_description_ =
-      abb::robot::utilities::establishRWSConnection(rws_manager_, robot_id, no_connection_timeout);
+  robot_controller_description_ = sessions_->describe(node_->get_parameter("robot_nickname").as_string(),
+                                                      node_->get_parameter("no_connection_timeout").as_bool(),
+                                                      node_->get_parameter("description_cache_dir").as_string());
   abb::robot::utilities::verifyRobotWareVersion(robot_controller_description_.header().robot_ware_version());
 
   abb::robot::initializeMotionData(motion_data_, robot_controller_description_);
@@ -76,22 +172,260 @@ RWSStatePublisherROS::RWSStatePublisherROS(const rclcpp::Node::SharedPtr& node,
 
   system_state_pub_ = node_->create_publisher<abb_robot_msgs::msg::SystemState>("~/system_states", 10);
 
-  if (abb::robot::utilities::verifyStateMachineAddInPresence(robot_controller_description_.system_indicators()))
+  has_sm_addin_ =
+      abb::robot::utilities::verifyStateMachineAddInPresence(robot_controller_description_.system_indicators());
+  if (has_sm_addin_)
   {
     runtime_state_pub_ =
         node_->create_publisher<abb_rapid_sm_addin_msgs::msg::RuntimeState>("~/sm_addin/runtime_states", 10);
   }
   auto polling_rate = node_->get_parameter("polling_rate").as_double();
+  auto fallback_polling_rate = node_->get_parameter("fallback_polling_rate").as_double();
+  if (polling_rate <= 0.0 || fallback_polling_rate <= 0.0)
+  {
+    throw std::runtime_error{ "The polling_rate and fallback_polling_rate must be positive" };
+  }
+  fallback_polling_period_ = std::chrono::milliseconds(static_cast<long>(1000.0 / fallback_polling_rate));
   timer_ = node_->create_wall_timer(std::chrono::milliseconds(static_cast<long>(1000.0 / polling_rate)),
                                     std::bind(&RWSStatePublisherROS::timer_callback, this));
+
+  initializeMessages();
+
+  // Joint states from the hardware interface on the same host are fresher than polled ones, and cost RWS nothing.
+  state_bridge_name_ = node_->get_parameter("state_bridge").as_string();
+  if (!state_bridge_name_.empty())
+  {
+    state_bridge_timeout_ = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(node_->get_parameter("state_bridge_timeout").as_double()));
+    const auto bridge_rate = node_->get_parameter("state_bridge_rate").as_double();
+    if (bridge_rate <= 0.0)
+    {
+      throw std::runtime_error{ "The state_bridge_rate must be positive" };
+    }
+    bridge_callback_group_ = node_->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+    bridge_timer_ = node_->create_wall_timer(std::chrono::microseconds(static_cast<long>(1e6 / bridge_rate)),
+                                             std::bind(&RWSStatePublisherROS::bridge_timer_callback, this),
+                                             bridge_callback_group_);
+  }
+
+  // The subscription always publishes on changes only, since that is what it is notified about.
+  const bool use_subscriptions = node_->get_parameter("use_subscriptions").as_bool();
+  publish_on_change_only_ = use_subscriptions || node_->get_parameter("publish_on_change_only").as_bool();
+  if (use_subscriptions)
+  {
+    initializeSubscription(robot_ip, robot_port);
+  }
   RCLCPP_INFO(node_->get_logger(), "RWS state publisher initialized!");
 }
 
+RWSStatePublisherROS::~RWSStatePublisherROS()
+{
+  // The subscription's event callback uses the rest of the publisher, so it has to be stopped first.
+  if (rws_subscriber_)
+  {
+    rws_subscriber_->stop();
+  }
+}
+
+void RWSStatePublisherROS::initializeSubscription(const std::string& robot_ip, unsigned short robot_port)
+{
+  rws_subscriber_ = std::make_unique<RWSSubscriber>(robot_ip, robot_port,
+                                                    abb::rws::SystemConstants::General::DEFAULT_USERNAME,
+                                                    abb::rws::SystemConstants::General::DEFAULT_PASSWORD);
+  rws_subscriber_->addSystemState();
+
+  for (const auto& signal : node_->get_parameter("subscription_io_signals").as_string_array())
+  {
+    rws_subscriber_->addIOSignal(signal);
+    subscribed_values_msg_.io_signals.push_back(signal);
+    subscribed_values_msg_.io_values.push_back(std::string{});
+  }
+
+  for (const auto& path : node_->get_parameter("subscription_rapid_symbols").as_string_array())
+  {
+    // Symbols are given as "<task>/<module>/<symbol>".
+    abb_rws_client_msgs::msg::RAPIDSymbolValue symbol;
+    std::istringstream stream{ path };
+    if (!std::getline(stream, symbol.path.task, '/') || !std::getline(stream, symbol.path.module, '/') ||
+        !std::getline(stream, symbol.path.symbol) || symbol.path.task.empty() || symbol.path.module.empty() ||
+        symbol.path.symbol.empty())
+    {
+      RCLCPP_WARN_STREAM(node_->get_logger(), "Ignoring RAPID symbol '" << path
+                                                                        << "' (expected '<task>/<module>/<symbol>')");
+      continue;
+    }
+    rws_subscriber_->addRAPIDSymbol(symbol.path.task, symbol.path.module, symbol.path.symbol);
+    symbol.type = abb_rws_client_msgs::msg::RAPIDSymbolValue::TYPE_RAW;
+    subscribed_values_msg_.rapid_symbols.push_back(symbol);
+  }
+
+  if (!subscribed_values_msg_.io_signals.empty() || !subscribed_values_msg_.rapid_symbols.empty())
+  {
+    subscribed_values_pub_ = node_->create_publisher<abb_rws_client_msgs::msg::SubscribedValues>(
+        "~/subscribed_values", rclcpp::QoS(1).transient_local());
+  }
+
+  rws_subscriber_->start(
+      [this](const std::vector<RWSSubscriber::Event>& events) {
+        if (!applyEvents(events))
+        {
+          refresh(false);
+        }
+      },
+      [this](bool active) {
+        if (active)
+        {
+          RCLCPP_INFO(node_->get_logger(), "RWS subscription active, polling the system state only as a fallback");
+        }
+        else
+        {
+          RCLCPP_WARN(node_->get_logger(), "RWS subscription inactive, polling at full rate");
+        }
+      });
+}
+
+void RWSStatePublisherROS::initializeMessages()
+{
+  std::size_t num_units = 0;
+  for (const auto& group : motion_data_.groups)
+  {
+    num_units += group.units.size();
+    for (const auto& unit : group.units)
+    {
+      for (const auto& joint : unit.joints)
+      {
+        joint_state_msg_.name.push_back(joint.name);
+      }
+    }
+  }
+  joint_state_msg_.position.assign(joint_state_msg_.name.size(), 0.0);
+
+  const auto num_tasks = static_cast<std::size_t>(robot_controller_description_.rapid_tasks_size());
+  system_state_msg_.rapid_tasks.reserve(num_tasks);
+  system_state_msg_.mechanical_units.reserve(num_units);
+  if (has_sm_addin_)
+  {
+    sm_runtime_state_msg_.state_machines.reserve(num_tasks);
+  }
+}
+
 void RWSStatePublisherROS::timer_callback()
 {
+  refresh(true);
+}
+
+void RWSStatePublisherROS::bridge_timer_callback()
+{
+  std::lock_guard<std::mutex> lock{ joint_state_mutex_ };
+
+  const auto now = std::chrono::steady_clock::now();
+  if (!state_bridge_ && now >= next_bridge_attempt_)
+  {
+    next_bridge_attempt_ = now + BRIDGE_ATTEMPT_PERIOD;
+    try
+    {
+      state_bridge_ = std::make_unique<abb_hardware_interface::StateBridgeReader>(state_bridge_name_);
+    }
+    catch (const std::runtime_error&)
+    {
+      // The hardware interface has not created it yet
+    }
+  }
+
+  bool fresh = false;
+  if (state_bridge_ && state_bridge_->read(bridge_sample_))
+  {
+    if (bridge_sample_.generation != bridge_generation_)
+    {
+      bridge_mapped_ = mapStateBridgeJoints();
+    }
+    fresh = bridge_mapped_ && now.time_since_epoch() - std::chrono::nanoseconds(bridge_sample_.stamp_ns) <
+                                  state_bridge_timeout_;
+  }
+
+  if (fresh != bridge_active_)
+  {
+    bridge_active_ = fresh;
+    if (fresh)
+    {
+      RCLCPP_INFO(node_->get_logger(), "Joint states from state bridge '%s', instead of polling them via RWS",
+                  state_bridge_name_.c_str());
+    }
+    else
+    {
+      RCLCPP_WARN(node_->get_logger(), "State bridge '%s' is stale, using the joint states polled via RWS",
+                  state_bridge_name_.c_str());
+    }
+  }
+  if (!fresh)
+  {
+    return;
+  }
+
+  for (std::size_t k = 0; k < bridge_indices_.size(); ++k)
+  {
+    joint_state_msg_.position[k] = bridge_sample_.positions[bridge_indices_[k]];
+  }
+  joint_state_msg_.header.stamp = node_->get_clock()->now();
+  publishMessage(*joint_state_pub_, joint_state_msg_);
+}
+
+bool RWSStatePublisherROS::mapStateBridgeJoints()
+{
+  const auto names = state_bridge_->jointNames(bridge_generation_);
+  if (names.empty() || bridge_generation_ != bridge_sample_.generation)
+  {
+    // The hardware interface restarted meanwhile, so try again with its next state
+    bridge_generation_ = 0;
+    return false;
+  }
+
+  bridge_indices_.clear();
+  for (const auto& group : motion_data_.groups)
+  {
+    for (const auto& unit : group.units)
+    {
+      for (const auto& joint : unit.joints)
+      {
+        const std::string name = abb_hardware_interface::stateBridgeJointName(group.name, joint.name);
+        const auto it = std::find(names.begin(), names.end(), name);
+        if (it == names.end())
+        {
+          RCLCPP_WARN_STREAM(node_->get_logger(), "State bridge '" << state_bridge_name_ << "' has no joint '" << name
+                                                                   << "', using the joint states polled via RWS");
+          bridge_indices_.clear();
+          return false;
+        }
+        bridge_indices_.push_back(static_cast<std::size_t>(it - names.begin()));
+      }
+    }
+  }
+  return true;
+}
+
+void RWSStatePublisherROS::refresh(bool fallback_poll)
+{
+  std::lock_guard<std::mutex> lock{ refresh_mutex_ };
+
+  // While subscribed, the events cover the system state and the subscribed values, so polling them is only a fallback.
+  // The joint states are never pushed via RWS though, so they are polled at full rate unless the state bridge has them.
+  const bool subscribed = rws_subscriber_ && rws_subscriber_->isActive();
+  const auto now = std::chrono::steady_clock::now();
+  const bool fallback_due = !subscribed || now - last_fallback_poll_ >= fallback_polling_period_;
+  if (fallback_poll && !fallback_due && bridge_active_)
+  {
+    return;
+  }
+  if (fallback_due)
+  {
+    last_fallback_poll_ = now;
+  }
+
   try
   {
-    rws_manager_.collectAndUpdateRuntimeData(system_state_data_, motion_data_);
+    sessions_->run(*runtime_data_metrics_, [this](abb::robot::RWSManager& rws_manager) {
+      rws_manager.collectAndUpdateRuntimeData(system_state_data_, motion_data_);
+    });
   }
   catch (const std::runtime_error& exception)
   {
@@ -101,69 +435,237 @@ void RWSStatePublisherROS::timer_callback()
                                                                                          << "' (will try again later)");
   }
 
-  sensor_msgs::msg::JointState joint_state_msg;
-  for (const auto& group : motion_data_.groups)
+  auto time = node_->get_clock()->now();
+
+  // The messages are reused between refreshes, and only updated in place (i.e. no allocations unless the
+  // controller's tasks or units change). The state bridge publishes joint states of its own when it is active.
   {
-    for (const auto& unit : group.units)
+    std::lock_guard<std::mutex> joint_state_lock{ joint_state_mutex_ };
+    if (!bridge_active_)
     {
-      for (const auto& joint : unit.joints)
+      std::size_t k = 0;
+      for (const auto& group : motion_data_.groups)
       {
-        joint_state_msg.name.push_back(joint.name);
-        joint_state_msg.position.push_back(joint.state.position);
+        for (const auto& unit : group.units)
+        {
+          for (const auto& joint : unit.joints)
+          {
+            joint_state_msg_.position[k++] = joint.state.position;
+          }
+        }
       }
+      joint_state_msg_.header.stamp = time;
+      publishMessage(*joint_state_pub_, joint_state_msg_);
     }
   }
 
-  abb_robot_msgs::msg::SystemState system_state_msg;
-  system_state_msg.motors_on = system_state_data_.motors_on.isTrue();
-  system_state_msg.auto_mode = system_state_data_.auto_mode.isTrue();
-  system_state_msg.rapid_running = system_state_data_.rapid_running.isTrue();
+  bool system_state_changed = false;
+  update(system_state_msg_.motors_on, system_state_data_.motors_on.isTrue(), system_state_changed);
+  update(system_state_msg_.auto_mode, system_state_data_.auto_mode.isTrue(), system_state_changed);
+  update(system_state_msg_.rapid_running, system_state_data_.rapid_running.isTrue(), system_state_changed);
 
-  for (const auto& task : system_state_data_.rapid_tasks)
+  resize(system_state_msg_.rapid_tasks, system_state_data_.rapid_tasks.size(), system_state_changed);
+  for (std::size_t i = 0; i < system_state_data_.rapid_tasks.size(); ++i)
   {
-    abb_robot_msgs::msg::RAPIDTaskState state{};
+    const auto& task = system_state_data_.rapid_tasks[i];
+    auto& state = system_state_msg_.rapid_tasks[i];
 
-    state.name = task.name;
-    state.activated = task.is_active;
-    state.execution_state = abb::robot::utilities::map(task.execution_state);
-    state.motion_task = task.is_motion_task;
-
-    system_state_msg.rapid_tasks.push_back(state);
+    update(state.name, task.name, system_state_changed);
+    update(state.activated, task.is_active, system_state_changed);
+    update(state.execution_state, abb::robot::utilities::map(task.execution_state), system_state_changed);
+    update(state.motion_task, task.is_motion_task, system_state_changed);
   }
 
+  resize(system_state_msg_.mechanical_units, system_state_data_.mechanical_units.size(), system_state_changed);
+  auto unit_state = system_state_msg_.mechanical_units.begin();
   for (const auto& unit : system_state_data_.mechanical_units)
   {
-    abb_robot_msgs::msg::MechanicalUnitState state{};
-    state.name = unit.first;
-    state.activated = unit.second.active;
-    system_state_msg.mechanical_units.push_back(state);
+    update(unit_state->name, unit.first, system_state_changed);
+    update(unit_state->activated, unit.second.active, system_state_changed);
+    ++unit_state;
   }
 
-  abb_rapid_sm_addin_msgs::msg::RuntimeState sm_runtime_state_msg;
-  const auto& system_indicators{ robot_controller_description_.system_indicators() };
-  if (abb::robot::utilities::verifyStateMachineAddInPresence(system_indicators))
+  bool sm_runtime_state_changed = false;
+  if (has_sm_addin_)
   {
-    for (const auto& sm : system_state_data_.state_machines)
+    resize(sm_runtime_state_msg_.state_machines, system_state_data_.state_machines.size(), sm_runtime_state_changed);
+    for (std::size_t i = 0; i < system_state_data_.state_machines.size(); ++i)
     {
-      abb_rapid_sm_addin_msgs::msg::StateMachineState state;
-      state.rapid_task = sm.rapid_task;
-      state.sm_state = abb::robot::utilities::mapStateMachineState(sm.sm_state);
-      state.egm_action = abb::robot::utilities::mapStateMachineEGMAction(sm.egm_action);
-      sm_runtime_state_msg.state_machines.push_back(state);
+      const auto& sm = system_state_data_.state_machines[i];
+      auto& state = sm_runtime_state_msg_.state_machines[i];
+
+      update(state.rapid_task, sm.rapid_task, sm_runtime_state_changed);
+      update(state.sm_state, abb::robot::utilities::mapStateMachineState(sm.sm_state), sm_runtime_state_changed);
+      update(state.egm_action, abb::robot::utilities::mapStateMachineEGMAction(sm.egm_action),
+             sm_runtime_state_changed);
     }
   }
 
-  auto time = node_->get_clock()->now();
-  joint_state_msg.header.stamp = time;
-  joint_state_pub_->publish(joint_state_msg);
+  // Unchanged states are skipped when publishing on changes only (but the first refresh is always published).
+  const bool publish_all = !publish_on_change_only_ || !published_state_;
 
-  system_state_msg.header.stamp = time;
-  system_state_pub_->publish(system_state_msg);
+  if (publish_all || system_state_changed)
+  {
+    system_state_msg_.header.stamp = time;
+    publishMessage(*system_state_pub_, system_state_msg_);
+  }
+
+  if (has_sm_addin_ && (publish_all || sm_runtime_state_changed))
+  {
+    sm_runtime_state_msg_.header.stamp = time;
+    publishMessage(*runtime_state_pub_, sm_runtime_state_msg_);
+  }
+  published_state_ = true;
+
+  if (subscribed_values_pub_ && (!fallback_poll || fallback_due))
+  {
+    refreshSubscribedValues(time);
+  }
+}
+
+bool RWSStatePublisherROS::applyEvents(const std::vector<RWSSubscriber::Event>& events)
+{
+  std::lock_guard<std::mutex> lock{ refresh_mutex_ };
+  if (events.empty() || !published_state_)
+  {
+    return false;
+  }
+
+  // The events are applied to copies, which are only kept if all the events were understood. Otherwise, the full
+  // refresh would not see the partially applied changes as changes, and hence not publish them.
+  auto system_state = system_state_msg_;
+  auto subscribed_values = subscribed_values_msg_;
+  bool system_state_changed = false;
+  bool subscribed_values_changed = false;
+
+  try
+  {
+    for (const auto& event : events)
+    {
+      if (event.resource == RWSSubscriber::CTRLSTATE_RESOURCE && !event.value.empty())
+      {
+        update(system_state.motors_on, event.value == "motoron", system_state_changed);
+      }
+      else if (event.resource == RWSSubscriber::OPMODE_RESOURCE && !event.value.empty())
+      {
+        update(system_state.auto_mode, event.value == "AUTO", system_state_changed);
+      }
+      else if (event.resource == RWSSubscriber::EXECUTION_STATE_RESOURCE && !event.value.empty())
+      {
+        update(system_state.rapid_running, event.value == "running", system_state_changed);
+      }
+      else if (!applySubscribedValueEvent(event, subscribed_values, subscribed_values_changed))
+      {
+        return false;
+      }
+    }
+  }
+  catch (const std::runtime_error& exception)
+  {
+    auto& clk = *node_->get_clock();
+    RCLCPP_WARN_STREAM_THROTTLE(node_->get_logger(), clk, THROTTLE_TIME,
+                                "Reading of a subscribed value via RWS failed with '" << exception.what()
+                                                                                       << "' (will try again later)");
+    return false;
+  }
+
+  const auto time = node_->get_clock()->now();
+  if (system_state_changed)
+  {
+    system_state_msg_ = std::move(system_state);
+    system_state_msg_.header.stamp = time;
+    publishMessage(*system_state_pub_, system_state_msg_);
+  }
+  if (subscribed_values_changed)
+  {
+    subscribed_values_msg_ = std::move(subscribed_values);
+    subscribed_values_msg_.header.stamp = time;
+    subscribed_values_pub_->publish(subscribed_values_msg_);
+  }
+  return true;
+}
+
+bool RWSStatePublisherROS::applySubscribedValueEvent(const RWSSubscriber::Event& event,
+                                                     abb_rws_client_msgs::msg::SubscribedValues& values, bool& changed)
+{
+  // An IO-signal event names the signal by its full path (e.g. "/rw/iosystem/signals/Local/DRV_1/DO1;state").
+  if (event.resource.compare(0, IO_SIGNALS_RESOURCE.size(), IO_SIGNALS_RESOURCE) == 0)
+  {
+    for (std::size_t i = 0; i < values.io_signals.size(); ++i)
+    {
+      if (!event.value.empty() && endsWith(event.resource, "/" + values.io_signals[i] + ";state"))
+      {
+        update(values.io_values[i], event.value, changed);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // A RAPID symbol event does not carry the value, so only that symbol is read.
+  for (auto& symbol : values.rapid_symbols)
+  {
+    if (event.resource == RAPID_SYMBOLS_RESOURCE + symbol.path.task + "/" + symbol.path.module + "/" +
+                              symbol.path.symbol + ";value")
+    {
+      std::string value;
+      sessions_->run(*subscribed_values_metrics_, [&](abb::robot::RWSManager& rws_manager) {
+        rws_manager.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+          value = interface.getRAPIDSymbolData(symbol.path.task, symbol.path.module, symbol.path.symbol);
+        });
+      });
+      if (value.empty())
+      {
+        return false;
+      }
+      update(symbol.value, value, changed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void RWSStatePublisherROS::refreshSubscribedValues(const rclcpp::Time& stamp)
+{
+  bool changed = false;
+  try
+  {
+    sessions_->run(*subscribed_values_metrics_, [&](abb::robot::RWSManager& rws_manager) {
+      rws_manager.runService([&](abb::rws::RWSStateMachineInterface& interface) {
+        for (std::size_t i = 0; i < subscribed_values_msg_.io_signals.size(); ++i)
+        {
+          auto value = interface.getIOSignal(subscribed_values_msg_.io_signals[i]);
+          if (!value.empty() && value != subscribed_values_msg_.io_values[i])
+          {
+            subscribed_values_msg_.io_values[i] = value;
+            changed = true;
+          }
+        }
+
+        for (auto& symbol : subscribed_values_msg_.rapid_symbols)
+        {
+          auto value = interface.getRAPIDSymbolData(symbol.path.task, symbol.path.module, symbol.path.symbol);
+          if (!value.empty() && value != symbol.value)
+          {
+            symbol.value = value;
+            changed = true;
+          }
+        }
+      });
+    });
+  }
+  catch (const std::runtime_error& exception)
+  {
+    auto& clk = *node_->get_clock();
+    RCLCPP_WARN_STREAM_THROTTLE(node_->get_logger(), clk, THROTTLE_TIME,
+                                "Reading of subscribed values via RWS failed with '" << exception.what()
+                                                                                     << "' (will try again later)");
+  }
 
-  if (abb::robot::utilities::verifyStateMachineAddInPresence(robot_controller_description_.system_indicators()))
+  if (changed)
   {
-    sm_runtime_state_msg.header.stamp = time;
-    runtime_state_pub_->publish(sm_runtime_state_msg);
+    subscribed_values_msg_.header.stamp = stamp;
+    subscribed_values_pub_->publish(subscribed_values_msg_);
   }
 }
 }  // namespace abb_rws_client
@@ -0,0 +1,166 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_rws_client/rws_subscriber.hpp>
+
+#include <Poco/DOM/Element.h>
+#include <Poco/DOM/NodeList.h>
+
+#include <exception>
+#include <utility>
+
+namespace abb_rws_client
+{
+constexpr std::chrono::milliseconds RWSSubscriber::RETRY_PERIOD;
+constexpr const char* RWSSubscriber::CTRLSTATE_RESOURCE;
+constexpr const char* RWSSubscriber::OPMODE_RESOURCE;
+constexpr const char* RWSSubscriber::EXECUTION_STATE_RESOURCE;
+
+RWSSubscriber::RWSSubscriber(const std::string& robot_ip, unsigned short robot_port, const std::string& username,
+                             const std::string& password)
+  : client_{ robot_ip, robot_port, username, password }
+{
+}
+
+RWSSubscriber::~RWSSubscriber()
+{
+  stop();
+}
+
+void RWSSubscriber::addSystemState()
+{
+  resources_.add(CTRLSTATE_RESOURCE, abb::rws::RWSClient::HIGH);
+  resources_.add(OPMODE_RESOURCE, abb::rws::RWSClient::HIGH);
+  resources_.add(EXECUTION_STATE_RESOURCE, abb::rws::RWSClient::HIGH);
+}
+
+void RWSSubscriber::addIOSignal(const std::string& signal)
+{
+  resources_.addIOSignal(signal, abb::rws::RWSClient::HIGH);
+}
+
+void RWSSubscriber::addRAPIDSymbol(const std::string& task, const std::string& module, const std::string& symbol)
+{
+  resources_.addRAPIDPersistantVariable(abb::rws::RWSClient::RAPIDResource(task, module, symbol),
+                                        abb::rws::RWSClient::HIGH);
+}
+
+void RWSSubscriber::start(const EventCallback& on_event, const StateCallback& on_state_change)
+{
+  if (running_)
+  {
+    return;
+  }
+
+  on_event_ = on_event;
+  on_state_change_ = on_state_change;
+  running_ = true;
+  thread_ = std::thread(&RWSSubscriber::run, this);
+}
+
+void RWSSubscriber::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock{ stop_mutex_ };
+    if (!running_)
+    {
+      return;
+    }
+    running_ = false;
+  }
+  stop_condition_.notify_all();
+
+  // Unblocks any ongoing wait for subscription events.
+  client_.forceCloseSubscription();
+
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+}
+
+void RWSSubscriber::run()
+{
+  while (running_)
+  {
+    try
+    {
+      if (client_.startSubscription(resources_).success)
+      {
+        setActive(true);
+
+        while (running_)
+        {
+          const auto result = client_.waitForSubscriptionEvent();
+          if (!result.success)
+          {
+            break;
+          }
+          on_event_(extractEvents(result));
+        }
+
+        client_.endSubscription();
+      }
+    }
+    catch (const std::exception&)
+    {
+      // The subscription is restarted below, and any missed events are covered by the users' fallback polling.
+    }
+
+    setActive(false);
+
+    std::unique_lock<std::mutex> lock{ stop_mutex_ };
+    stop_condition_.wait_for(lock, RETRY_PERIOD, [this] { return !running_; });
+  }
+}
+
+std::vector<RWSSubscriber::Event> RWSSubscriber::extractEvents(const abb::rws::RWSClient::RWSResult& result)
+{
+  std::vector<Event> events;
+  if (result.p_xml_document.isNull())
+  {
+    return events;
+  }
+
+  // Each event item links to the resource that changed, and carries its new value (if any), e.g.
+  // <li class="pnl-ctrlstate-ev"><a href="/rw/panel/ctrlstate" rel="self"/><span class="ctrlstate">motoron</span></li>.
+  Poco::AutoPtr<Poco::XML::NodeList> items = result.p_xml_document->getElementsByTagName("li");
+  for (unsigned long i = 0; i < items->length(); ++i)
+  {
+    const auto p_item = dynamic_cast<Poco::XML::Element*>(items->item(i));
+    const auto p_link = p_item ? p_item->getChildElement("a") : nullptr;
+    if (!p_link || !p_link->hasAttribute("href"))
+    {
+      continue;
+    }
+
+    Event event;
+    event.resource = p_link->getAttribute("href");
+    if (const auto p_value = p_item->getChildElement("span"))
+    {
+      event.value = p_value->innerText();
+    }
+    events.push_back(std::move(event));
+  }
+  return events;
+}
+
+void RWSSubscriber::setActive(bool active)
+{
+  if (active_.exchange(active) != active && on_state_change_)
+  {
+    on_state_change_(active);
+  }
+}
+}  // namespace abb_rws_client
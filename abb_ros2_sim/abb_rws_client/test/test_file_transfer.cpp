@@ -0,0 +1,166 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_rws_client/file_transfer.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using abb_rws_client::FileTransfer;
+
+TEST(FileTransfer, DownloadInChunks)
+{
+  FileTransfer transfer{ 1024 };
+  EXPECT_FALSE(transfer.hasDownload("log.txt", 0));
+
+  const std::string contents(1000, 'a');
+  ASSERT_TRUE(transfer.startDownload("log.txt", std::string{ contents }));
+  EXPECT_TRUE(transfer.hasDownload("log.txt", 0));
+  EXPECT_FALSE(transfer.hasDownload("other.txt", 0));
+  EXPECT_FALSE(transfer.hasDownload("log.txt", 1001));
+
+  std::string received;
+  std::string chunk;
+  std::size_t total_size = 0;
+  while (!transfer.readChunk("log.txt", received.size(), 300, chunk, total_size))
+  {
+    EXPECT_EQ(chunk.size(), 300u);
+    received += chunk;
+    ASSERT_TRUE(transfer.hasDownload("log.txt", received.size()));
+  }
+  received += chunk;
+
+  EXPECT_EQ(total_size, contents.size());
+  EXPECT_EQ(received, contents);
+
+  // The download ends with its last chunk
+  EXPECT_FALSE(transfer.hasDownload("log.txt", 0));
+}
+
+TEST(FileTransfer, RejectsTooLargeDownload)
+{
+  FileTransfer transfer{ 10 };
+  ASSERT_TRUE(transfer.startDownload("small.txt", std::string(10, 'a')));
+  ASSERT_TRUE(transfer.startDownload("large.txt", std::string(10, 'a')));
+  EXPECT_FALSE(transfer.startDownload("large.txt", std::string(11, 'a')));
+
+  // The earlier download of the rejected file is dropped, but not the others
+  EXPECT_TRUE(transfer.hasDownload("small.txt", 0));
+  EXPECT_FALSE(transfer.hasDownload("large.txt", 0));
+
+  EXPECT_THROW(FileTransfer{ 0 }, std::invalid_argument);
+}
+
+TEST(FileTransfer, AlternatingDownloads)
+{
+  FileTransfer transfer{ 1024 };
+  ASSERT_TRUE(transfer.startDownload("a.txt", std::string(600, 'a')));
+  ASSERT_TRUE(transfer.startDownload("b.txt", std::string(600, 'b')));
+
+  std::string chunk;
+  std::size_t total_size = 0;
+  EXPECT_FALSE(transfer.readChunk("a.txt", 0, 300, chunk, total_size));
+  EXPECT_EQ(chunk, std::string(300, 'a'));
+  EXPECT_FALSE(transfer.readChunk("b.txt", 0, 300, chunk, total_size));
+  EXPECT_EQ(chunk, std::string(300, 'b'));
+  EXPECT_TRUE(transfer.readChunk("a.txt", 300, 300, chunk, total_size));
+  EXPECT_EQ(chunk, std::string(300, 'a'));
+
+  EXPECT_FALSE(transfer.hasDownload("a.txt", 0));
+  EXPECT_TRUE(transfer.hasDownload("b.txt", 300));
+}
+
+TEST(FileTransfer, DropsLeastRecentlyUsedDownload)
+{
+  FileTransfer transfer{ 10 };
+  for (std::size_t i = 0; i < FileTransfer::MAX_DOWNLOADS; ++i)
+  {
+    ASSERT_TRUE(transfer.startDownload(std::to_string(i) + ".txt", std::string(10, 'a')));
+  }
+
+  // Reading from the first download makes the second one the least recently used
+  std::string chunk;
+  std::size_t total_size = 0;
+  EXPECT_FALSE(transfer.readChunk("0.txt", 0, 1, chunk, total_size));
+  ASSERT_TRUE(transfer.startDownload("new.txt", std::string(10, 'a')));
+
+  EXPECT_TRUE(transfer.hasDownload("0.txt", 1));
+  EXPECT_FALSE(transfer.hasDownload("1.txt", 0));
+  EXPECT_TRUE(transfer.hasDownload("new.txt", 0));
+}
+
+TEST(FileTransfer, ChunkSizeIsLimited)
+{
+  FileTransfer transfer{ 2 * FileTransfer::MAX_CHUNK_SIZE };
+  ASSERT_TRUE(transfer.startDownload("big.bin", std::string(2 * FileTransfer::MAX_CHUNK_SIZE, 'a')));
+
+  std::string chunk;
+  std::size_t total_size = 0;
+  EXPECT_FALSE(transfer.readChunk("big.bin", 0, 0, chunk, total_size));
+  EXPECT_EQ(chunk.size(), FileTransfer::DEFAULT_CHUNK_SIZE);
+  EXPECT_FALSE(transfer.readChunk("big.bin", 0, 8 * FileTransfer::MAX_CHUNK_SIZE, chunk, total_size));
+  EXPECT_EQ(chunk.size(), FileTransfer::MAX_CHUNK_SIZE);
+}
+
+TEST(FileTransfer, UploadInChunks)
+{
+  FileTransfer transfer{ 10 };
+  EXPECT_TRUE(transfer.addChunk("prog.mod", 0, "MODULE"));
+  EXPECT_EQ(transfer.uploadSize("prog.mod"), 6u);
+  EXPECT_EQ(transfer.uploadSize("other.mod"), 0u);
+
+  // Chunks must follow each other, and stay within the maximum file size
+  EXPECT_FALSE(transfer.addChunk("prog.mod", 4, "ULE"));
+  EXPECT_FALSE(transfer.addChunk("other.mod", 6, " A"));
+  EXPECT_FALSE(transfer.addChunk("prog.mod", 6, " ABCDE"));
+  EXPECT_TRUE(transfer.addChunk("prog.mod", 6, " A"));
+
+  EXPECT_EQ(transfer.finishUpload(), "MODULE A");
+  EXPECT_EQ(transfer.uploadSize("prog.mod"), 0u);
+}
+
+TEST(FileTransfer, UploadRestartsAtOffsetZero)
+{
+  FileTransfer transfer{ 10 };
+  EXPECT_TRUE(transfer.addChunk("a.mod", 0, "first"));
+  EXPECT_TRUE(transfer.addChunk("b.mod", 0, "second"));
+  EXPECT_EQ(transfer.uploadSize("a.mod"), 0u);
+  EXPECT_EQ(transfer.finishUpload(), "second");
+}
+
+TEST(FileTransfer, CompressionRoundTrip)
+{
+  std::string data;
+  for (int i = 0; i < 1000; ++i)
+  {
+    data += "MoveL p" + std::to_string(i) + ", v1000, z50, tool0;\n";
+  }
+
+  std::vector<uint8_t> compressed;
+  ASSERT_TRUE(FileTransfer::compress(data, compressed));
+  EXPECT_LT(compressed.size(), data.size());
+
+  std::string decompressed;
+  ASSERT_TRUE(FileTransfer::decompress(compressed, data.size(), decompressed));
+  EXPECT_EQ(decompressed, data);
+
+  // Data larger than the maximum size, and invalid data, are rejected
+  EXPECT_FALSE(FileTransfer::decompress(compressed, data.size() - 1, decompressed));
+  EXPECT_TRUE(decompressed.empty());
+  EXPECT_FALSE(FileTransfer::decompress(std::vector<uint8_t>{ 1, 2, 3, 4 }, data.size(), decompressed));
+}
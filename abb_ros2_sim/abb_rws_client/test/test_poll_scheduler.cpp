@@ -0,0 +1,152 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_rws_client/poll_scheduler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using abb_rws_client::PollScheduler;
+
+namespace
+{
+constexpr std::chrono::milliseconds PERIOD{ 100 };
+
+/**
+ * \brief Times [s] since the start of a test at which each task was run.
+ */
+class Runs
+{
+public:
+  explicit Runs(const std::size_t num_tasks) : start_(PollScheduler::Clock::now()), times_(num_tasks)
+  {
+  }
+
+  void record(const std::size_t task)
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    times_[task].push_back(std::chrono::duration<double>(PollScheduler::Clock::now() - start_).count());
+  }
+
+  std::vector<double> times(const std::size_t task)
+  {
+    std::lock_guard<std::mutex> lock{ mutex_ };
+    return times_[task];
+  }
+
+private:
+  const PollScheduler::Clock::time_point start_;
+  std::mutex mutex_;
+  std::vector<std::vector<double>> times_;
+};
+}  // namespace
+
+TEST(PollScheduler, StaggersFirstDeadlines)
+{
+  constexpr std::size_t num_tasks = 4;
+  Runs runs{ num_tasks };
+  PollScheduler scheduler{ 2 };
+  for (std::size_t i = 0; i < num_tasks; ++i)
+  {
+    scheduler.add([&runs, i]() { runs.record(i); }, PERIOD);
+  }
+  scheduler.start();
+  std::this_thread::sleep_for(PERIOD * 3 / 2);
+  scheduler.stop();
+
+  // Task i of n is first due at i / n of the period
+  for (std::size_t i = 0; i < num_tasks; ++i)
+  {
+    const auto times = runs.times(i);
+    ASSERT_FALSE(times.empty());
+    EXPECT_NEAR(times.front(), 0.1 * static_cast<double>(i) / num_tasks, 0.02);
+  }
+}
+
+TEST(PollScheduler, SkipsMissedDeadlines)
+{
+  Runs runs{ 2 };
+  PollScheduler scheduler{ 2 };
+  scheduler.add(
+      [&runs]() {
+        runs.record(0);
+        std::this_thread::sleep_for(PERIOD * 5 / 2);
+      },
+      PERIOD);
+  scheduler.add([&runs]() { runs.record(1); }, PERIOD);
+  scheduler.start();
+  std::this_thread::sleep_for(PERIOD * 10);
+  scheduler.stop();
+
+  // The slow task runs every third period, on its own phase, without a burst after each run
+  const auto slow = runs.times(0);
+  ASSERT_GE(slow.size(), 3u);
+  for (std::size_t i = 1; i < slow.size(); ++i)
+  {
+    EXPECT_NEAR(slow[i] - slow[i - 1], 0.3, 0.03);
+  }
+
+  // The other task keeps its rate on the other thread
+  EXPECT_GE(runs.times(1).size(), 9u);
+}
+
+TEST(PollScheduler, NeverRunsTaskConcurrently)
+{
+  constexpr std::size_t num_tasks = 3;
+  std::atomic<int> running[num_tasks];
+  std::atomic<bool> overlapped{ false };
+  PollScheduler scheduler{ 4 };
+  for (std::size_t i = 0; i < num_tasks; ++i)
+  {
+    running[i] = 0;
+    scheduler.add(
+        [&running, &overlapped, i]() {
+          if (running[i]++ > 0)
+          {
+            overlapped = true;
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(15));
+          --running[i];
+        },
+        std::chrono::milliseconds(5));
+  }
+  scheduler.start();
+  std::this_thread::sleep_for(PERIOD * 3);
+  scheduler.stop();
+
+  EXPECT_FALSE(overlapped);
+}
+
+TEST(PollScheduler, SurvivesThrowingTask)
+{
+  std::atomic<int> calls{ 0 };
+  PollScheduler scheduler{ 1 };
+  scheduler.add(
+      [&calls]() {
+        ++calls;
+        throw std::runtime_error{ "poll failed" };
+      },
+      std::chrono::milliseconds(10));
+  scheduler.start();
+  std::this_thread::sleep_for(PERIOD);
+  scheduler.stop();
+
+  EXPECT_GE(calls, 5);
+}
@@ -0,0 +1,105 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <abb_rws_client/rapid_symbol_cache.hpp>
+
+#include <string>
+
+using abb_rws_client::RAPIDSymbolCache;
+
+namespace
+{
+abb_robot_msgs::msg::RAPIDSymbolPath makePath(const std::string& symbol, const std::string& module = "user")
+{
+  abb_robot_msgs::msg::RAPIDSymbolPath path;
+  path.task = "T_ROB1";
+  path.module = module;
+  path.symbol = symbol;
+  return path;
+}
+}  // namespace
+
+TEST(RAPIDSymbolCache, ContainsInsertedDataType)
+{
+  RAPIDSymbolCache cache{ 4 };
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "num"));
+
+  cache.insert(makePath("reg1"), "num", cache.generation());
+  EXPECT_TRUE(cache.contains(makePath("reg1"), "num"));
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "dnum"));
+  EXPECT_FALSE(cache.contains(makePath("reg1", "base"), "num"));
+
+  // A redeclared symbol replaces the cached data type
+  cache.insert(makePath("reg1"), "dnum", cache.generation());
+  EXPECT_TRUE(cache.contains(makePath("reg1"), "dnum"));
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "num"));
+}
+
+TEST(RAPIDSymbolCache, EvictsLeastRecentlyUsed)
+{
+  RAPIDSymbolCache cache{ 2 };
+  cache.insert(makePath("reg1"), "num", cache.generation());
+  cache.insert(makePath("reg2"), "num", cache.generation());
+
+  // reg1 is used again, so reg2 is the least recently used when reg3 is inserted
+  EXPECT_TRUE(cache.contains(makePath("reg1"), "num"));
+  cache.insert(makePath("reg3"), "num", cache.generation());
+
+  EXPECT_TRUE(cache.contains(makePath("reg1"), "num"));
+  EXPECT_FALSE(cache.contains(makePath("reg2"), "num"));
+  EXPECT_TRUE(cache.contains(makePath("reg3"), "num"));
+}
+
+TEST(RAPIDSymbolCache, HoldsAtLeastOneSymbol)
+{
+  RAPIDSymbolCache cache{ 0 };
+  cache.insert(makePath("reg1"), "num", cache.generation());
+  EXPECT_TRUE(cache.contains(makePath("reg1"), "num"));
+
+  cache.insert(makePath("reg2"), "num", cache.generation());
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "num"));
+  EXPECT_TRUE(cache.contains(makePath("reg2"), "num"));
+}
+
+TEST(RAPIDSymbolCache, Erase)
+{
+  RAPIDSymbolCache cache{ 4 };
+  cache.insert(makePath("reg1"), "num", cache.generation());
+  cache.insert(makePath("reg2"), "num", cache.generation());
+
+  cache.erase(makePath("reg1"));
+  cache.erase(makePath("reg9"));
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "num"));
+  EXPECT_TRUE(cache.contains(makePath("reg2"), "num"));
+}
+
+TEST(RAPIDSymbolCache, ClearDiscardsStaleInserts)
+{
+  RAPIDSymbolCache cache{ 4 };
+  cache.insert(makePath("reg1"), "num", cache.generation());
+
+  // reg2 is resolved before the cache is cleared, and inserted after it
+  const auto generation = cache.generation();
+  cache.clear();
+  EXPECT_NE(cache.generation(), generation);
+  EXPECT_FALSE(cache.contains(makePath("reg1"), "num"));
+
+  cache.insert(makePath("reg2"), "num", generation);
+  EXPECT_FALSE(cache.contains(makePath("reg2"), "num"));
+
+  cache.insert(makePath("reg2"), "num", cache.generation());
+  EXPECT_TRUE(cache.contains(makePath("reg2"), "num"));
+}
@@ -0,0 +1,215 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_simulator/network_conditions.hpp>
+
+#include <abb_hardware_interface/latency_histogram.hpp>
+#include <abb_libegm/egm.pb.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace abb_simulator
+{
+/**
+ * \brief Emulates the EGM side of a robot controller, with one UDP channel per mechanical units group.
+ *
+ * Every period, each group sends its feedback to the driver, like a controller running EGM joint mode. The planned
+ * joints of the driver's replies become the new positions of the group, so the loop is closed over the network: what
+ * the driver commands is what it reads back. Both directions cross a NetworkLink, i.e. messages may be lost, delayed
+ * and reordered.
+ *
+ * The closed-loop latency of a group is measured from sampling a feedback message to applying the first command that
+ * was sent after the driver received it, including both network delays.
+ *
+ * Positions are in degrees for the robot joints and in mm for the external joints, as in EGM.
+ */
+class EGMSimulator
+{
+public:
+  /**
+   * \brief Configuration of a mechanical units group.
+   */
+  struct GroupConfig
+  {
+    std::string name;
+
+    /**
+     * \brief Port of the driver to send the EGM messages to.
+     */
+    std::uint16_t port = 0;
+    std::size_t robot_joints = 6;
+    std::size_t external_joints = 0;
+
+    /**
+     * \brief Whether the group adopts the commanded positions, or only moves by setPositions(), e.g. for a replay.
+     */
+    bool follow_commands = true;
+  };
+
+  /**
+   * \brief Counters of a group since start().
+   */
+  struct Statistics
+  {
+    std::uint64_t feedback_sent = 0;
+    std::uint64_t feedback_lost = 0;
+    std::uint64_t commands_received = 0;
+    std::uint64_t commands_lost = 0;
+    abb_hardware_interface::LatencyHistogram::Summary latency;
+  };
+
+  /**
+   * \brief Creates a simulator; no messages are sent before start().
+   *
+   * \param host with the IPv4 address of the driver.
+   * \param groups to emulate.
+   * \param period of the EGM communication, 4 ms on a real controller.
+   * \param conditions of the network.
+   * \param seed of the network draws.
+   *
+   * \throw std::runtime_error if a socket could not be opened.
+   */
+  EGMSimulator(const std::string& host, const std::vector<GroupConfig>& groups, std::chrono::nanoseconds period,
+               const NetworkConditions& conditions, std::uint32_t seed = 0);
+
+  /**
+   * \brief Stops the simulator and closes all sockets.
+   */
+  ~EGMSimulator();
+
+  EGMSimulator(const EGMSimulator&) = delete;
+  EGMSimulator& operator=(const EGMSimulator&) = delete;
+
+  /**
+   * \brief Starts sending feedback from a background thread.
+   */
+  void start();
+
+  /**
+   * \brief Stops the background thread. Pending delayed messages are discarded.
+   */
+  void stop();
+
+  std::size_t size() const { return groups_.size(); }
+
+  /**
+   * \brief Gets the counters of a group.
+   *
+   * \param index of the group.
+   *
+   * \return Statistics with the counters, and latencies in [ns].
+   */
+  Statistics statistics(std::size_t index) const;
+
+  /**
+   * \brief Gets the current joint positions of a group, the robot joints first.
+   *
+   * \param index of the group.
+   *
+   * \return std::vector<double> with the positions [deg or mm].
+   */
+  std::vector<double> positions(std::size_t index) const;
+
+  /**
+   * \brief Sets the joint positions of a group, which are reported from the next feedback on.
+   *
+   * \param index of the group.
+   * \param positions [deg or mm], the robot joints first. Missing joints keep their positions.
+   */
+  void setPositions(std::size_t index, const std::vector<double>& positions);
+
+private:
+  struct Group
+  {
+    GroupConfig config;
+    int socket = -1;
+    std::uint32_t sequence_number = 0;
+    std::vector<double> positions;
+
+    /**
+     * \brief Sampling times of the newest feedback that reached the driver, and of the newest one answered.
+     */
+    std::chrono::steady_clock::time_point delivered_sample{};
+    std::chrono::steady_clock::time_point answered_sample{};
+
+    std::atomic<std::uint64_t> feedback_sent{ 0 };
+    std::atomic<std::uint64_t> feedback_lost{ 0 };
+    std::atomic<std::uint64_t> commands_received{ 0 };
+    std::atomic<std::uint64_t> commands_lost{ 0 };
+    abb_hardware_interface::LatencyHistogram latency;
+  };
+
+  /**
+   * \brief A message in flight, delivered when it is due.
+   */
+  struct Event
+  {
+    std::chrono::steady_clock::time_point due;
+    std::size_t group;
+    bool is_feedback;
+    std::string data;
+
+    /**
+     * \brief Sampling time of the feedback, or of the feedback that a command answers.
+     */
+    std::chrono::steady_clock::time_point sample;
+
+    bool operator>(const Event& other) const { return due > other.due; }
+  };
+
+  void run();
+
+  /**
+   * \brief Samples the feedback of a group, and queues it for the driver.
+   */
+  void sample(std::size_t index, std::chrono::steady_clock::time_point now);
+
+  /**
+   * \brief Receives the commands of a group, and queues them for the robot.
+   */
+  void receive(std::size_t index, std::chrono::steady_clock::time_point now);
+
+  /**
+   * \brief Delivers a message that is due.
+   */
+  void deliver(const Event& event, std::chrono::steady_clock::time_point now);
+
+  std::vector<std::unique_ptr<Group>> groups_;
+  std::chrono::nanoseconds period_;
+  NetworkLink link_;
+  std::chrono::steady_clock::time_point start_time_;
+  std::priority_queue<Event, std::vector<Event>, std::greater<Event>> in_flight_;
+
+  /**
+   * \brief Guards the positions, which are read from other threads.
+   */
+  mutable std::mutex positions_mutex_;
+
+  std::atomic<bool> running_{ false };
+  std::thread thread_;
+
+  abb::egm::EgmRobot robot_message_;
+  abb::egm::EgmSensor sensor_message_;
+};
+}  // namespace abb_simulator
@@ -0,0 +1,93 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace abb_simulator
+{
+/**
+ * \brief Conditions of the emulated network between the robot controller and the driver.
+ */
+struct NetworkConditions
+{
+  /**
+   * \brief Probability [0, 1] that a message is lost, in each direction.
+   */
+  double packet_loss = 0.0;
+
+  /**
+   * \brief Round trip time [s], added as two equal one-way delays.
+   */
+  double rtt = 0.0;
+
+  /**
+   * \brief Largest deviation [s] of each one-way delay from rtt / 2, uniformly distributed.
+   */
+  double jitter = 0.0;
+};
+
+/**
+ * \brief Draws the fate of each message that crosses an emulated network link.
+ *
+ * The draws are reproducible for a given seed. The link is not thread safe.
+ */
+class NetworkLink
+{
+public:
+  /**
+   * \brief Creates a link.
+   *
+   * \param conditions of the network.
+   * \param seed of the random number generator.
+   */
+  NetworkLink(const NetworkConditions& conditions, const std::uint32_t seed)
+    : conditions_(conditions), generator_(seed), unit_(0.0, 1.0)
+  {
+  }
+
+  /**
+   * \brief Draws whether a message is lost.
+   *
+   * \return bool true if the message must be dropped.
+   */
+  bool lose() { return conditions_.packet_loss > 0.0 && unit_(generator_) < conditions_.packet_loss; }
+
+  /**
+   * \brief Draws the one-way delay of a message.
+   *
+   * \return std::chrono::nanoseconds with the delay, never negative.
+   */
+  std::chrono::nanoseconds delay()
+  {
+    double delay = 0.5 * conditions_.rtt;
+    if (conditions_.jitter > 0.0)
+    {
+      delay += conditions_.jitter * (2.0 * unit_(generator_) - 1.0);
+    }
+    return std::chrono::nanoseconds{ static_cast<std::int64_t>(std::max(delay, 0.0) * 1e9) };
+  }
+
+  const NetworkConditions& conditions() const { return conditions_; }
+
+private:
+  NetworkConditions conditions_;
+  std::mt19937 generator_;
+  std::uniform_real_distribution<double> unit_;
+};
+}  // namespace abb_simulator
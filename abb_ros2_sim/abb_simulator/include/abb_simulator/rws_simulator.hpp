@@ -0,0 +1,164 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <abb_simulator/network_conditions.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace abb_simulator
+{
+/**
+ * \brief Emulates a minimal RWS 1.0 server of a robot controller, over HTTP/1.1 with keep-alive.
+ *
+ * Only the resources that the frequent services of the driver use are provided, with XHTML responses in the format
+ * of RobotWare 6:
+ * - GET and POST /rw/panel/speedratio
+ * - GET /rw/panel/ctrlstate and /rw/panel/opmode
+ * - GET /rw/rapid/execution
+ * - GET and POST /rw/rapid/symbol/data/RAPID/{task}/{module}/{symbol}
+ * - GET and POST /rw/iosystem/signals/{signal}
+ * - GET /logout
+ *
+ * Everything else is answered with 404, so a description crawl fails and the driver has to start from a cached
+ * description (see abb::robot::utilities::DescriptionCache). No authentication is required.
+ *
+ * Every request is delayed by one round trip of the network link. A lost message costs a TCP retransmission instead
+ * of the request itself, i.e. it adds RETRANSMISSION_TIMEOUT.
+ */
+class RWSSimulator
+{
+public:
+  /**
+   * \brief Smallest retransmission timeout of Linux TCP, added when the network link loses a message.
+   */
+  static constexpr std::chrono::milliseconds RETRANSMISSION_TIMEOUT{ 200 };
+
+  /**
+   * \brief Creates a simulator, and opens its port.
+   *
+   * \param port to listen on. Zero picks a free port, see port().
+   * \param conditions of the network.
+   * \param seed of the network draws.
+   *
+   * \throw std::runtime_error if the port could not be opened.
+   */
+  RWSSimulator(std::uint16_t port, const NetworkConditions& conditions, std::uint32_t seed = 0);
+
+  /**
+   * \brief Stops the simulator, and closes all connections.
+   */
+  ~RWSSimulator();
+
+  RWSSimulator(const RWSSimulator&) = delete;
+  RWSSimulator& operator=(const RWSSimulator&) = delete;
+
+  /**
+   * \brief Starts serving from background threads, one per connection.
+   */
+  void start();
+
+  /**
+   * \brief Stops serving, and waits for all connections to close.
+   */
+  void stop();
+
+  std::uint16_t port() const { return port_; }
+
+  /**
+   * \brief Sets the value of a RAPID symbol, creating it if needed.
+   *
+   * \param task of the symbol, e.g. T_ROB1.
+   * \param module of the symbol.
+   * \param symbol name.
+   * \param value in RAPID syntax, e.g. 1.5 or "text".
+   */
+  void setRAPIDSymbol(const std::string& task, const std::string& module, const std::string& symbol,
+                      const std::string& value);
+
+  /**
+   * \brief Gets the value of a RAPID symbol.
+   *
+   * \return std::string with the value, empty if there is no such symbol.
+   */
+  std::string getRAPIDSymbol(const std::string& task, const std::string& module, const std::string& symbol) const;
+
+  /**
+   * \brief Sets the value of an IO signal, creating it if needed.
+   */
+  void setIOSignal(const std::string& signal, const std::string& value);
+
+  /**
+   * \brief Gets the value of an IO signal.
+   *
+   * \return std::string with the value, empty if there is no such signal.
+   */
+  std::string getIOSignal(const std::string& signal) const;
+
+  /**
+   * \brief Gets the number of requests answered so far.
+   */
+  std::uint64_t requests() const { return requests_; }
+
+private:
+  struct Response
+  {
+    int status;
+    std::string body;
+  };
+
+  void acceptConnections();
+
+  void serve(int connection);
+
+  /**
+   * \brief Answers a request.
+   *
+   * \param method of the request, GET or POST.
+   * \param target of the request, with the query.
+   * \param body of the request, form URL encoded.
+   */
+  Response handle(const std::string& method, const std::string& target, const std::string& body);
+
+  /**
+   * \brief Draws the time to wait before answering a request.
+   */
+  std::chrono::nanoseconds responseDelay();
+
+  int listen_socket_ = -1;
+  std::uint16_t port_ = 0;
+
+  std::mutex link_mutex_;
+  NetworkLink link_;
+
+  mutable std::mutex data_mutex_;
+  std::string speed_ratio_ = "100";
+  std::map<std::string, std::string> rapid_symbols_;
+  std::map<std::string, std::string> io_signals_;
+
+  std::atomic<bool> running_{ false };
+  std::atomic<std::uint64_t> requests_{ 0 };
+  std::thread accept_thread_;
+  std::mutex connections_mutex_;
+  std::vector<std::thread> connection_threads_;
+};
+}  // namespace abb_simulator
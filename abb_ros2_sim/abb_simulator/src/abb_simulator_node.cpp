@@ -0,0 +1,86 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_simulator/egm_simulator.hpp>
+#include <abb_simulator/rws_simulator.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <rclcpp/rclcpp.hpp>
+
+int main(int argc, char** argv)
+{
+  rclcpp::init(argc, argv);
+  auto node = std::make_shared<rclcpp::Node>("abb_simulator");
+
+  const std::string egm_host = node->declare_parameter<std::string>("egm_host", "127.0.0.1");
+  const std::vector<std::int64_t> egm_ports = node->declare_parameter<std::vector<std::int64_t>>("egm_ports", { 6511 });
+  const int robot_joints = node->declare_parameter<int>("robot_joints", 6);
+  const int external_joints = node->declare_parameter<int>("external_joints", 0);
+  const double egm_rate = node->declare_parameter<double>("egm_rate", 250.0);
+  const int rws_port = node->declare_parameter<int>("rws_port", 8881);
+  const double statistics_period = node->declare_parameter<double>("statistics_period", 5.0);
+
+  abb_simulator::NetworkConditions conditions;
+  conditions.packet_loss = node->declare_parameter<double>("packet_loss", 0.0);
+  conditions.rtt = node->declare_parameter<double>("rtt", 0.0);
+  conditions.jitter = node->declare_parameter<double>("jitter", 0.0);
+  const auto seed = static_cast<std::uint32_t>(node->declare_parameter<int>("seed", 0));
+
+  std::vector<abb_simulator::EGMSimulator::GroupConfig> groups;
+  for (std::size_t g = 0; g < egm_ports.size(); ++g)
+  {
+    abb_simulator::EGMSimulator::GroupConfig group;
+    group.name = "rob" + std::to_string(g + 1);
+    group.port = static_cast<std::uint16_t>(egm_ports[g]);
+    group.robot_joints = static_cast<std::size_t>(robot_joints);
+    group.external_joints = static_cast<std::size_t>(external_joints);
+    groups.push_back(group);
+  }
+
+  abb_simulator::RWSSimulator rws(static_cast<std::uint16_t>(rws_port), conditions, seed);
+  abb_simulator::EGMSimulator egm(egm_host, groups,
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      std::chrono::duration<double>(1.0 / egm_rate)),
+                                  conditions, seed + 1);
+  rws.start();
+  egm.start();
+  RCLCPP_INFO(node->get_logger(),
+              "Simulating %zu mechanical units groups at %.0f Hz, RWS on port %u (loss: %.3f, RTT: %.4f s, jitter: "
+              "%.4f s)",
+              groups.size(), egm_rate, rws.port(), conditions.packet_loss, conditions.rtt, conditions.jitter);
+
+  auto timer = node->create_wall_timer(std::chrono::duration<double>(statistics_period), [&]() {
+    for (std::size_t g = 0; g < egm.size(); ++g)
+    {
+      const auto statistics = egm.statistics(g);
+      RCLCPP_INFO(node->get_logger(),
+                  "%s: %lu feedback sent (%lu lost), %lu commands (%lu lost), latency p50 %.3f ms, p99 %.3f ms",
+                  groups[g].name.c_str(), statistics.feedback_sent, statistics.feedback_lost,
+                  statistics.commands_received, statistics.commands_lost, 1e-6 * statistics.latency.p50,
+                  1e-6 * statistics.latency.p99);
+    }
+    RCLCPP_INFO(node->get_logger(), "RWS: %lu requests", rws.requests());
+  });
+
+  rclcpp::spin(node);
+
+  egm.stop();
+  rws.stop();
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,256 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_simulator/egm_simulator.hpp>
+
+#include <abb_hardware_interface/telemetry_recorder.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+using abb_hardware_interface::TelemetryKind;
+using abb_hardware_interface::TelemetryReader;
+using abb_hardware_interface::TelemetrySample;
+using abb_hardware_interface::TelemetrySource;
+
+namespace
+{
+/**
+ * \brief Logger record type of abb_node's joint samples (LOG_JOINTS in logger_parser.h), in [deg].
+ */
+constexpr std::uint16_t LOGGER_JOINTS = 1;
+constexpr std::size_t LOGGER_JOINTS_COUNT = 6;
+
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+constexpr double M_TO_MM = 1000.0;
+
+const char* kindName(const TelemetryKind kind)
+{
+  switch (kind)
+  {
+    case TelemetryKind::FEEDBACK:
+      return "feedback";
+    case TelemetryKind::COMMAND:
+      return "command";
+    case TelemetryKind::LOGGER:
+      return "logger";
+  }
+  return "unknown";
+}
+
+void usage()
+{
+  std::fprintf(stderr,
+               "Usage: abb_telemetry_tool dump FILE\n"
+               "       abb_telemetry_tool replay FILE HOST PORT... [--speed FACTOR]\n"
+               "\n"
+               "dump prints the records of a telemetry file as CSV.\n"
+               "replay streams the recorded feedback (or logged joints) as EGM messages to a driver, one port per\n"
+               "mechanical units group, in the recorded timing divided by FACTOR.\n");
+}
+
+int dump(const TelemetryReader& reader)
+{
+  std::printf("index,stamp_ns,source_time,group,kind");
+  for (std::size_t i = 0; i < abb_hardware_interface::TELEMETRY_MAX_VALUES; ++i)
+  {
+    std::printf(",position_%zu", i);
+  }
+  for (std::size_t i = 0; i < abb_hardware_interface::TELEMETRY_MAX_VALUES; ++i)
+  {
+    std::printf(",velocity_%zu", i);
+  }
+  std::printf("\n");
+
+  TelemetrySample sample;
+  std::uint64_t skipped = 0;
+  const std::uint64_t end = reader.written();
+  for (std::uint64_t index = reader.oldest(); index < end; ++index)
+  {
+    if (!reader.read(index, sample))
+    {
+      ++skipped;
+      continue;
+    }
+    std::printf("%llu,%lld,%.9g,%u,%s", static_cast<unsigned long long>(index),
+                static_cast<long long>(sample.stamp_ns), sample.source_time, sample.group, kindName(sample.kind));
+    for (std::size_t i = 0; i < abb_hardware_interface::TELEMETRY_MAX_VALUES; ++i)
+    {
+      std::printf(i < sample.num_values ? ",%.9g" : ",", sample.positions[i]);
+    }
+    for (std::size_t i = 0; i < abb_hardware_interface::TELEMETRY_MAX_VALUES; ++i)
+    {
+      std::printf(i < sample.num_values ? ",%.9g" : ",", sample.velocities[i]);
+    }
+    std::printf("\n");
+  }
+  if (skipped > 0)
+  {
+    std::fprintf(stderr, "Skipped %llu records that were overwritten while reading\n",
+                 static_cast<unsigned long long>(skipped));
+  }
+  return EXIT_SUCCESS;
+}
+
+int replay(const TelemetryReader& reader, const std::string& host, const std::vector<std::uint16_t>& ports,
+           const double speed)
+{
+  const auto& header = reader.header();
+  const bool from_logger = reader.source() == TelemetrySource::LOGGER;
+
+  // The logger only has the joints of the first robot, recorded in EGM units already
+  std::vector<abb_simulator::EGMSimulator::GroupConfig> groups;
+  const std::size_t num_groups = from_logger ? 1 : header.num_groups;
+  if (ports.size() < num_groups)
+  {
+    std::fprintf(stderr, "The recording has %zu groups, but only %zu ports were given\n", num_groups, ports.size());
+    return EXIT_FAILURE;
+  }
+  for (std::size_t g = 0; g < num_groups; ++g)
+  {
+    abb_simulator::EGMSimulator::GroupConfig group;
+    group.name = from_logger ? "rob1" : header.groups[g].name;
+    group.port = ports[g];
+    group.robot_joints = from_logger ? LOGGER_JOINTS_COUNT : header.groups[g].num_robot_joints;
+    group.external_joints = from_logger ? 0 : header.groups[g].num_joints - header.groups[g].num_robot_joints;
+    group.follow_commands = false;
+    groups.push_back(group);
+  }
+
+  abb_simulator::EGMSimulator simulator(host, groups, std::chrono::milliseconds(4), abb_simulator::NetworkConditions{});
+
+  TelemetrySample sample;
+  std::vector<double> positions;
+  std::uint64_t replayed = 0;
+  bool started = false;
+  std::int64_t first_stamp_ns = 0;
+  std::chrono::steady_clock::time_point start_time;
+
+  const std::uint64_t end = reader.written();
+  for (std::uint64_t index = reader.oldest(); index < end; ++index)
+  {
+    if (!reader.read(index, sample))
+    {
+      continue;
+    }
+    const bool replayable = from_logger ?
+                                sample.kind == TelemetryKind::LOGGER && sample.group == LOGGER_JOINTS :
+                                sample.kind == TelemetryKind::FEEDBACK && sample.group < num_groups;
+    if (!replayable)
+    {
+      continue;
+    }
+
+    const std::size_t g = from_logger ? 0 : sample.group;
+    positions.assign(sample.positions, sample.positions + sample.num_values);
+    if (!from_logger)
+    {
+      for (std::size_t i = 0; i < positions.size(); ++i)
+      {
+        positions[i] *= (header.groups[g].linear_mask >> i & 1u) ? M_TO_MM : RAD_TO_DEG;
+      }
+    }
+
+    if (!started)
+    {
+      // Start from the first recorded positions, instead of moving there from zero
+      simulator.setPositions(g, positions);
+      simulator.start();
+      started = true;
+      first_stamp_ns = sample.stamp_ns;
+      start_time = std::chrono::steady_clock::now();
+    }
+    const auto offset = std::chrono::duration<double, std::nano>((sample.stamp_ns - first_stamp_ns) / speed);
+    std::this_thread::sleep_until(start_time + std::chrono::duration_cast<std::chrono::nanoseconds>(offset));
+    simulator.setPositions(g, positions);
+    ++replayed;
+  }
+
+  if (!started)
+  {
+    std::fprintf(stderr, "The recording has no records to replay\n");
+    return EXIT_FAILURE;
+  }
+  // Let the last positions reach the driver
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  simulator.stop();
+
+  std::printf("Replayed %llu records in %.3f s\n", static_cast<unsigned long long>(replayed),
+              std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count());
+  for (std::size_t g = 0; g < simulator.size(); ++g)
+  {
+    const auto statistics = simulator.statistics(g);
+    std::printf("%s: %llu feedback messages sent, %llu commands received\n", groups[g].name.c_str(),
+                static_cast<unsigned long long>(statistics.feedback_sent),
+                static_cast<unsigned long long>(statistics.commands_received));
+  }
+  return EXIT_SUCCESS;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  if (argc < 3)
+  {
+    usage();
+    return EXIT_FAILURE;
+  }
+  const std::string command = argv[1];
+
+  try
+  {
+    const TelemetryReader reader{ argv[2] };
+    if (command == "dump" && argc == 3)
+    {
+      return dump(reader);
+    }
+    if (command == "replay" && argc >= 5)
+    {
+      std::vector<std::uint16_t> ports;
+      double speed = 1.0;
+      for (int i = 4; i < argc; ++i)
+      {
+        const std::string argument = argv[i];
+        if (argument == "--speed" && i + 1 < argc)
+        {
+          speed = std::atof(argv[++i]);
+        }
+        else
+        {
+          ports.push_back(static_cast<std::uint16_t>(std::atoi(argv[i])));
+        }
+      }
+      if (speed <= 0.0 || ports.empty())
+      {
+        usage();
+        return EXIT_FAILURE;
+      }
+      return replay(reader, argv[3], ports, speed);
+    }
+  }
+  catch (const std::exception& exception)
+  {
+    std::fprintf(stderr, "%s\n", exception.what());
+    return EXIT_FAILURE;
+  }
+
+  usage();
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,318 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_simulator/egm_simulator.hpp>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace abb_simulator
+{
+namespace
+{
+constexpr std::size_t MAX_MESSAGE_SIZE = 2048;
+
+/**
+ * \brief Longest time [ns] to wait in one poll, so that stop() is noticed promptly.
+ */
+constexpr std::int64_t MAX_WAIT_NS = 10000000;
+
+void addJoints(abb::egm::EgmJoints* joints, const std::vector<double>& positions, const std::size_t begin,
+               const std::size_t end)
+{
+  for (std::size_t i = begin; i < end; ++i)
+  {
+    joints->add_joints(positions[i]);
+  }
+}
+}  // namespace
+
+EGMSimulator::EGMSimulator(const std::string& host, const std::vector<GroupConfig>& groups,
+                           const std::chrono::nanoseconds period, const NetworkConditions& conditions,
+                           const std::uint32_t seed)
+  : period_(period), link_(conditions, seed)
+{
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1)
+  {
+    throw std::runtime_error{ "Invalid EGM host address '" + host + "'" };
+  }
+
+  for (const auto& config : groups)
+  {
+    auto group = std::make_unique<Group>();
+    group->config = config;
+    group->positions.assign(config.robot_joints + config.external_joints, 0.0);
+
+    address.sin_port = htons(config.port);
+    group->socket = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (group->socket < 0 || connect(group->socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0)
+    {
+      const std::string error = std::strerror(errno);
+      if (group->socket >= 0)
+      {
+        close(group->socket);
+      }
+      throw std::runtime_error{ "Failed to open the EGM channel of \"" + config.name + "\": " + error };
+    }
+    groups_.push_back(std::move(group));
+  }
+}
+
+EGMSimulator::~EGMSimulator()
+{
+  stop();
+  for (auto& group : groups_)
+  {
+    close(group->socket);
+  }
+}
+
+void EGMSimulator::start()
+{
+  if (running_.exchange(true))
+  {
+    return;
+  }
+  start_time_ = std::chrono::steady_clock::now();
+  thread_ = std::thread{ &EGMSimulator::run, this };
+}
+
+void EGMSimulator::stop()
+{
+  running_ = false;
+  if (thread_.joinable())
+  {
+    thread_.join();
+  }
+  while (!in_flight_.empty())
+  {
+    in_flight_.pop();
+  }
+}
+
+EGMSimulator::Statistics EGMSimulator::statistics(const std::size_t index) const
+{
+  const Group& group = *groups_[index];
+  Statistics statistics;
+  statistics.feedback_sent = group.feedback_sent.load();
+  statistics.feedback_lost = group.feedback_lost.load();
+  statistics.commands_received = group.commands_received.load();
+  statistics.commands_lost = group.commands_lost.load();
+  statistics.latency = group.latency.summarize();
+  return statistics;
+}
+
+std::vector<double> EGMSimulator::positions(const std::size_t index) const
+{
+  std::lock_guard<std::mutex> lock{ positions_mutex_ };
+  return groups_[index]->positions;
+}
+
+void EGMSimulator::setPositions(const std::size_t index, const std::vector<double>& positions)
+{
+  std::lock_guard<std::mutex> lock{ positions_mutex_ };
+  std::vector<double>& current = groups_[index]->positions;
+  std::copy(positions.begin(), positions.begin() + std::min(positions.size(), current.size()), current.begin());
+}
+
+void EGMSimulator::run()
+{
+  std::vector<pollfd> descriptors;
+  for (const auto& group : groups_)
+  {
+    descriptors.push_back(pollfd{ group->socket, POLLIN, 0 });
+  }
+
+  auto next_sample = std::chrono::steady_clock::now();
+  while (running_)
+  {
+    auto now = std::chrono::steady_clock::now();
+    if (now >= next_sample)
+    {
+      for (std::size_t g = 0; g < groups_.size(); ++g)
+      {
+        sample(g, now);
+      }
+      // Skip the missed periods instead of bursting, as the controller's EGM task does.
+      next_sample += period_;
+      if (next_sample <= now)
+      {
+        next_sample = now + period_;
+      }
+    }
+
+    while (!in_flight_.empty() && in_flight_.top().due <= now)
+    {
+      const Event event = in_flight_.top();
+      in_flight_.pop();
+      deliver(event, now);
+    }
+
+    auto wake = next_sample;
+    if (!in_flight_.empty())
+    {
+      wake = std::min(wake, in_flight_.top().due);
+    }
+    const std::int64_t wait_ns =
+        std::min(std::chrono::duration_cast<std::chrono::nanoseconds>(wake - now).count(), MAX_WAIT_NS);
+    timespec timeout{ 0, std::max<long>(static_cast<long>(wait_ns), 0) };
+
+    if (ppoll(descriptors.data(), descriptors.size(), &timeout, nullptr) > 0)
+    {
+      now = std::chrono::steady_clock::now();
+      for (std::size_t g = 0; g < descriptors.size(); ++g)
+      {
+        if (descriptors[g].revents & POLLIN)
+        {
+          receive(g, now);
+        }
+      }
+    }
+  }
+}
+
+void EGMSimulator::sample(const std::size_t index, const std::chrono::steady_clock::time_point now)
+{
+  Group& group = *groups_[index];
+  const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - start_time_).count();
+
+  robot_message_.Clear();
+  auto header = robot_message_.mutable_header();
+  header->set_seqno(group.sequence_number++);
+  header->set_tm(static_cast<std::uint32_t>(elapsed / 1000));
+  header->set_mtype(abb::egm::EgmHeader::MSGTYPE_DATA);
+
+  const std::size_t robot_joints = group.config.robot_joints;
+  const std::size_t all_joints = group.positions.size();
+  {
+    std::lock_guard<std::mutex> lock{ positions_mutex_ };
+    auto feedback = robot_message_.mutable_feedback();
+    addJoints(feedback->mutable_joints(), group.positions, 0, robot_joints);
+    addJoints(feedback->mutable_externaljoints(), group.positions, robot_joints, all_joints);
+    auto planned = robot_message_.mutable_planned();
+    addJoints(planned->mutable_joints(), group.positions, 0, robot_joints);
+    addJoints(planned->mutable_externaljoints(), group.positions, robot_joints, all_joints);
+  }
+
+  // The Cartesian pose is not modelled, but the driver expects it to be present.
+  for (auto* pose : { robot_message_.mutable_feedback()->mutable_cartesian(),
+                      robot_message_.mutable_planned()->mutable_cartesian() })
+  {
+    pose->mutable_pos()->set_x(0.0);
+    pose->mutable_pos()->set_y(0.0);
+    pose->mutable_pos()->set_z(0.0);
+    pose->mutable_orient()->set_u0(1.0);
+    pose->mutable_orient()->set_u1(0.0);
+    pose->mutable_orient()->set_u2(0.0);
+    pose->mutable_orient()->set_u3(0.0);
+  }
+  for (auto* time : { robot_message_.mutable_feedback()->mutable_time(),
+                      robot_message_.mutable_planned()->mutable_time() })
+  {
+    time->set_sec(static_cast<std::uint64_t>(elapsed / 1000000));
+    time->set_usec(static_cast<std::uint64_t>(elapsed % 1000000));
+  }
+  robot_message_.mutable_motorstate()->set_state(abb::egm::EgmMotorState::MOTORS_ON);
+  robot_message_.mutable_mcistate()->set_state(abb::egm::EgmMCIState::MCI_RUNNING);
+  robot_message_.set_mciconvergencemet(true);
+  robot_message_.mutable_rapidexecstate()->set_state(abb::egm::EgmRapidCtrlExecState::RAPID_RUNNING);
+  robot_message_.mutable_measuredforce()->set_fusing(false);
+  robot_message_.set_utilizationrate(0.0);
+
+  if (link_.lose())
+  {
+    ++group.feedback_lost;
+    return;
+  }
+  Event event{ now + link_.delay(), index, true, std::string{}, now };
+  robot_message_.SerializeToString(&event.data);
+  in_flight_.push(std::move(event));
+}
+
+void EGMSimulator::receive(const std::size_t index, const std::chrono::steady_clock::time_point now)
+{
+  Group& group = *groups_[index];
+  char buffer[MAX_MESSAGE_SIZE];
+  while (true)
+  {
+    const ssize_t size = recv(group.socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (size <= 0)
+    {
+      return;
+    }
+    if (link_.lose())
+    {
+      ++group.commands_lost;
+      continue;
+    }
+    // The command answers the newest feedback that the driver had received when it was sent.
+    in_flight_.push(Event{ now + link_.delay(), index, false, std::string(buffer, static_cast<std::size_t>(size)),
+                           group.delivered_sample });
+  }
+}
+
+void EGMSimulator::deliver(const Event& event, const std::chrono::steady_clock::time_point now)
+{
+  Group& group = *groups_[event.group];
+  if (event.is_feedback)
+  {
+    if (send(group.socket, event.data.data(), event.data.size(), MSG_DONTWAIT) >= 0)
+    {
+      ++group.feedback_sent;
+      group.delivered_sample = std::max(group.delivered_sample, event.sample);
+    }
+    return;
+  }
+
+  if (!sensor_message_.ParseFromString(event.data) || !sensor_message_.has_planned())
+  {
+    return;
+  }
+  ++group.commands_received;
+
+  // Joint mode with perfect tracking: the robot is where it was told to be.
+  const std::size_t robot_joints = group.config.robot_joints;
+  const auto& joints = sensor_message_.planned().joints();
+  const auto& external_joints = sensor_message_.planned().externaljoints();
+  if (group.config.follow_commands)
+  {
+    std::lock_guard<std::mutex> lock{ positions_mutex_ };
+    for (std::size_t i = 0; i < group.positions.size(); ++i)
+    {
+      const int k = static_cast<int>(i < robot_joints ? i : i - robot_joints);
+      const auto& source = i < robot_joints ? joints : external_joints;
+      if (k < source.joints_size())
+      {
+        group.positions[i] = source.joints(k);
+      }
+    }
+  }
+
+  if (event.sample > group.answered_sample)
+  {
+    group.answered_sample = event.sample;
+    group.latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(now - event.sample).count());
+  }
+}
+}  // namespace abb_simulator
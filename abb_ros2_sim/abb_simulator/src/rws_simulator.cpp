@@ -0,0 +1,440 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <abb_simulator/rws_simulator.hpp>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace abb_simulator
+{
+constexpr std::chrono::milliseconds RWSSimulator::RETRANSMISSION_TIMEOUT;
+
+namespace
+{
+/**
+ * \brief Time [ms] to wait for data in one poll, so that stop() is noticed promptly.
+ */
+constexpr int POLL_TIMEOUT_MS = 100;
+
+constexpr std::size_t MAX_REQUEST_SIZE = 1024 * 1024;
+
+const std::string RAPID_DATA_PREFIX = "/rw/rapid/symbol/data/RAPID/";
+const std::string IO_SIGNALS_PREFIX = "/rw/iosystem/signals/";
+
+std::string urlDecode(const std::string& text)
+{
+  std::string decoded;
+  decoded.reserve(text.size());
+  for (std::size_t i = 0; i < text.size(); ++i)
+  {
+    if (text[i] == '+')
+    {
+      decoded += ' ';
+    }
+    else if (text[i] == '%' && i + 2 < text.size() && std::isxdigit(static_cast<unsigned char>(text[i + 1])) &&
+             std::isxdigit(static_cast<unsigned char>(text[i + 2])))
+    {
+      decoded += static_cast<char>(std::strtol(text.substr(i + 1, 2).c_str(), nullptr, 16));
+      i += 2;
+    }
+    else
+    {
+      decoded += text[i];
+    }
+  }
+  return decoded;
+}
+
+/**
+ * \brief Gets the decoded value of a field of a query or form URL encoded body, empty if it is missing.
+ */
+std::string formField(const std::string& form, const std::string& name)
+{
+  std::size_t begin = 0;
+  while (begin <= form.size())
+  {
+    std::size_t end = form.find('&', begin);
+    if (end == std::string::npos)
+    {
+      end = form.size();
+    }
+    const std::string field = form.substr(begin, end - begin);
+    const std::size_t equals = field.find('=');
+    if (equals != std::string::npos && urlDecode(field.substr(0, equals)) == name)
+    {
+      return urlDecode(field.substr(equals + 1));
+    }
+    begin = end + 1;
+  }
+  return std::string{};
+}
+
+std::string escapeXML(const std::string& text)
+{
+  std::string escaped;
+  for (const char c : text)
+  {
+    switch (c)
+    {
+      case '&':
+        escaped += "&amp;";
+        break;
+      case '<':
+        escaped += "&lt;";
+        break;
+      case '>':
+        escaped += "&gt;";
+        break;
+      case '"':
+        escaped += "&quot;";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * \brief Creates an RWS 1.0 page with a single list item.
+ *
+ * \param item_class of the list item, e.g. pnl-speedratio.
+ * \param title of the list item.
+ * \param spans with the class and text of each value.
+ */
+std::string page(const std::string& item_class, const std::string& title,
+                 const std::vector<std::pair<std::string, std::string>>& spans)
+{
+  std::string body = "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                     "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>" +
+                     escapeXML(title) + "</title></head><body><div class=\"state\"><ul><li class=\"" + item_class +
+                     "\" title=\"" + escapeXML(title) + "\">";
+  for (const auto& span : spans)
+  {
+    body += "<span class=\"" + span.first + "\">" + escapeXML(span.second) + "</span>";
+  }
+  return body + "</li></ul></div></body></html>";
+}
+
+const char* reason(const int status)
+{
+  switch (status)
+  {
+    case 200:
+      return "OK";
+    case 204:
+      return "No Content";
+    case 400:
+      return "Bad Request";
+    default:
+      return "Not Found";
+  }
+}
+
+bool sendAll(const int connection, const std::string& data)
+{
+  std::size_t sent = 0;
+  while (sent < data.size())
+  {
+    const ssize_t count = send(connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+    if (count <= 0)
+    {
+      return false;
+    }
+    sent += static_cast<std::size_t>(count);
+  }
+  return true;
+}
+
+std::string lowercase(std::string text)
+{
+  for (auto& c : text)
+  {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  return text;
+}
+}  // namespace
+
+RWSSimulator::RWSSimulator(const std::uint16_t port, const NetworkConditions& conditions, const std::uint32_t seed)
+  : link_(conditions, seed)
+{
+  listen_socket_ = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  const int reuse = 1;
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  socklen_t address_size = sizeof(address);
+  if (listen_socket_ < 0 || setsockopt(listen_socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0 ||
+      bind(listen_socket_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) < 0 ||
+      getsockname(listen_socket_, reinterpret_cast<sockaddr*>(&address), &address_size) < 0 ||
+      listen(listen_socket_, SOMAXCONN) < 0)
+  {
+    const std::string error = std::strerror(errno);
+    if (listen_socket_ >= 0)
+    {
+      close(listen_socket_);
+    }
+    throw std::runtime_error{ "Failed to open RWS port " + std::to_string(port) + ": " + error };
+  }
+  port_ = ntohs(address.sin_port);
+}
+
+RWSSimulator::~RWSSimulator()
+{
+  stop();
+  close(listen_socket_);
+}
+
+void RWSSimulator::start()
+{
+  if (running_.exchange(true))
+  {
+    return;
+  }
+  accept_thread_ = std::thread{ &RWSSimulator::acceptConnections, this };
+}
+
+void RWSSimulator::stop()
+{
+  running_ = false;
+  if (accept_thread_.joinable())
+  {
+    accept_thread_.join();
+  }
+  std::lock_guard<std::mutex> lock{ connections_mutex_ };
+  for (auto& thread : connection_threads_)
+  {
+    thread.join();
+  }
+  connection_threads_.clear();
+}
+
+void RWSSimulator::setRAPIDSymbol(const std::string& task, const std::string& module, const std::string& symbol,
+                                  const std::string& value)
+{
+  std::lock_guard<std::mutex> lock{ data_mutex_ };
+  rapid_symbols_[task + "/" + module + "/" + symbol] = value;
+}
+
+std::string RWSSimulator::getRAPIDSymbol(const std::string& task, const std::string& module,
+                                         const std::string& symbol) const
+{
+  std::lock_guard<std::mutex> lock{ data_mutex_ };
+  const auto it = rapid_symbols_.find(task + "/" + module + "/" + symbol);
+  return it == rapid_symbols_.end() ? std::string{} : it->second;
+}
+
+void RWSSimulator::setIOSignal(const std::string& signal, const std::string& value)
+{
+  std::lock_guard<std::mutex> lock{ data_mutex_ };
+  io_signals_[signal] = value;
+}
+
+std::string RWSSimulator::getIOSignal(const std::string& signal) const
+{
+  std::lock_guard<std::mutex> lock{ data_mutex_ };
+  const auto it = io_signals_.find(signal);
+  return it == io_signals_.end() ? std::string{} : it->second;
+}
+
+void RWSSimulator::acceptConnections()
+{
+  while (running_)
+  {
+    pollfd descriptor{ listen_socket_, POLLIN, 0 };
+    if (::poll(&descriptor, 1, POLL_TIMEOUT_MS) <= 0)
+    {
+      continue;
+    }
+    const int connection = accept4(listen_socket_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (connection < 0)
+    {
+      continue;
+    }
+    const int no_delay = 1;
+    setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+    std::lock_guard<std::mutex> lock{ connections_mutex_ };
+    connection_threads_.emplace_back(&RWSSimulator::serve, this, connection);
+  }
+}
+
+void RWSSimulator::serve(const int connection)
+{
+  std::string buffer;
+  char chunk[4096];
+  bool keep_alive = true;
+  while (running_ && keep_alive)
+  {
+    // Read until a complete request is buffered
+    const std::size_t header_end = buffer.find("\r\n\r\n");
+    std::size_t content_length = 0;
+    if (header_end != std::string::npos)
+    {
+      const std::string headers = lowercase(buffer.substr(0, header_end));
+      const std::size_t length_it = headers.find("\r\ncontent-length:");
+      if (length_it != std::string::npos)
+      {
+        content_length = std::strtoul(headers.c_str() + length_it + 17, nullptr, 10);
+      }
+      keep_alive = headers.find("\r\nconnection: close") == std::string::npos;
+    }
+    if (header_end == std::string::npos || buffer.size() < header_end + 4 + content_length)
+    {
+      if (buffer.size() > MAX_REQUEST_SIZE)
+      {
+        break;
+      }
+      pollfd descriptor{ connection, POLLIN, 0 };
+      if (::poll(&descriptor, 1, POLL_TIMEOUT_MS) <= 0)
+      {
+        continue;
+      }
+      const ssize_t count = recv(connection, chunk, sizeof(chunk), 0);
+      if (count <= 0)
+      {
+        break;
+      }
+      buffer.append(chunk, static_cast<std::size_t>(count));
+      continue;
+    }
+
+    const std::size_t line_end = buffer.find("\r\n");
+    const std::string request_line = buffer.substr(0, line_end);
+    const std::string body = buffer.substr(header_end + 4, content_length);
+    buffer.erase(0, header_end + 4 + content_length);
+
+    const std::size_t method_end = request_line.find(' ');
+    const std::size_t target_end = request_line.find(' ', method_end + 1);
+    if (method_end == std::string::npos || target_end == std::string::npos)
+    {
+      break;
+    }
+    const Response response = handle(request_line.substr(0, method_end),
+                                     request_line.substr(method_end + 1, target_end - method_end - 1), body);
+    ++requests_;
+
+    std::this_thread::sleep_for(responseDelay());
+    std::string message = "HTTP/1.1 " + std::to_string(response.status) + " " + reason(response.status) + "\r\n";
+    if (!response.body.empty())
+    {
+      message += "Content-Type: application/xhtml+xml;v=1.0\r\n";
+    }
+    message += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    message += keep_alive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+    if (!sendAll(connection, message + response.body))
+    {
+      break;
+    }
+  }
+  close(connection);
+}
+
+RWSSimulator::Response RWSSimulator::handle(const std::string& method, const std::string& target,
+                                            const std::string& body)
+{
+  const std::size_t query_begin = target.find('?');
+  const std::string path = urlDecode(target.substr(0, query_begin));
+  const std::string query = query_begin == std::string::npos ? std::string{} : target.substr(query_begin + 1);
+  const std::string action = formField(query, "action");
+  const bool is_get = method == "GET";
+  const bool is_post = method == "POST";
+
+  std::lock_guard<std::mutex> lock{ data_mutex_ };
+  if (path == "/rw/panel/speedratio")
+  {
+    if (is_post && action == "setspeedratio")
+    {
+      speed_ratio_ = formField(body, "speed-ratio");
+      return Response{ 204, std::string{} };
+    }
+    return Response{ 200, page("pnl-speedratio", "speedratio", { { "speedratio", speed_ratio_ } }) };
+  }
+  if (is_get && path == "/rw/panel/ctrlstate")
+  {
+    return Response{ 200, page("pnl-ctrlstate", "ctrlstate", { { "ctrlstate", "motoron" } }) };
+  }
+  if (is_get && path == "/rw/panel/opmode")
+  {
+    return Response{ 200, page("pnl-opmode", "opmode", { { "opmode", "AUTO" } }) };
+  }
+  if (is_get && path == "/rw/rapid/execution")
+  {
+    return Response{ 200,
+                     page("rap-execution", "execution", { { "ctrlexecstate", "running" }, { "cycle", "forever" } }) };
+  }
+  if (path.compare(0, RAPID_DATA_PREFIX.size(), RAPID_DATA_PREFIX) == 0)
+  {
+    const auto it = rapid_symbols_.find(path.substr(RAPID_DATA_PREFIX.size()));
+    if (it == rapid_symbols_.end())
+    {
+      return Response{ 400, std::string{} };
+    }
+    if (is_post && action == "set")
+    {
+      it->second = formField(body, "value");
+      return Response{ 204, std::string{} };
+    }
+    return Response{ 200, page("rap-data", "RAPID/" + it->first, { { "value", it->second } }) };
+  }
+  if (path.compare(0, IO_SIGNALS_PREFIX.size(), IO_SIGNALS_PREFIX) == 0)
+  {
+    const std::string signal = path.substr(IO_SIGNALS_PREFIX.size());
+    const auto it = io_signals_.find(signal);
+    if (it == io_signals_.end())
+    {
+      return Response{ 400, std::string{} };
+    }
+    if (is_post && action == "set")
+    {
+      it->second = formField(body, "lvalue");
+      return Response{ 204, std::string{} };
+    }
+    return Response{ 200, page("ios-signal-li", signal, { { "name", signal }, { "lvalue", it->second } }) };
+  }
+  if (is_get && path == "/logout")
+  {
+    return Response{ 204, std::string{} };
+  }
+  return Response{ 404, std::string{} };
+}
+
+std::chrono::nanoseconds RWSSimulator::responseDelay()
+{
+  std::lock_guard<std::mutex> lock{ link_mutex_ };
+  std::chrono::nanoseconds delay = link_.delay() + link_.delay();
+  for (int direction = 0; direction < 2; ++direction)
+  {
+    if (link_.lose())
+    {
+      delay += RETRANSMISSION_TIMEOUT;
+    }
+  }
+  return delay;
+}
+}  // namespace abb_simulator
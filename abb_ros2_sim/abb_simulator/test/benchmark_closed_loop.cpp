@@ -0,0 +1,399 @@
+// Copyright 2026 The abb_ros2 Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <abb_simulator/egm_simulator.hpp>
+#include <abb_simulator/rws_simulator.hpp>
+
+#include <abb_hardware_interface/abb_hardware_interface.hpp>
+#include <abb_hardware_interface/description_cache.hpp>
+#include <abb_hardware_interface/latency_histogram.hpp>
+#include <abb_robot_msgs/msg/service_responses.hpp>
+#include <abb_robot_msgs/srv/get_rapid_num.hpp>
+#include <abb_rws_client/rws_service_provider_ros.hpp>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rclcpp/rclcpp.hpp>
+
+namespace
+{
+using abb_hardware_interface::LatencyHistogram;
+
+constexpr int AXES_PER_GROUP = 6;
+
+/**
+ * \brief First EGM port of the hardware interface, which cannot pick free ports itself.
+ */
+constexpr std::uint16_t HARDWARE_BASE_PORT = 16611;
+
+/**
+ * \brief Time [s] that each rate is driven for.
+ */
+constexpr double DURATION = 2.0;
+
+/**
+ * \brief Time [s] to wait for outstanding service responses at the end of a run.
+ */
+constexpr double DRAIN_TIMEOUT = 5.0;
+
+/**
+ * \brief Amplitude [rad] and frequency [Hz] of the commanded joint motion.
+ */
+constexpr double AMPLITUDE = 0.05;
+constexpr double FREQUENCY = 0.5;
+
+/**
+ * \brief Network conditions, selected by the last benchmark argument: an ideal loopback, and a congested network.
+ */
+abb_simulator::NetworkConditions networkConditions(const std::int64_t index)
+{
+  abb_simulator::NetworkConditions conditions;
+  if (index == 1)
+  {
+    conditions.packet_loss = 0.01;
+    conditions.rtt = 0.002;
+    conditions.jitter = 0.0005;
+  }
+  return conditions;
+}
+
+/**
+ * \brief Creates a RobotWare 6 description with one TCP robot per mechanical units group, as a crawl would find.
+ */
+abb::robot::RobotControllerDescription makeDescription(const int num_groups)
+{
+  abb::robot::RobotControllerDescription description;
+
+  auto header{ description.mutable_header() };
+  header->mutable_robot_ware_version()->set_name("6.08.00");
+  header->mutable_robot_ware_version()->set_major_number(6);
+  header->mutable_robot_ware_version()->set_minor_number(8);
+  header->mutable_robot_ware_version()->set_patch_number(0);
+  description.mutable_system_indicators()->mutable_options()->set_egm(true);
+
+  for (int g = 0; g < num_groups; ++g)
+  {
+    auto mug{ description.add_mechanical_units_groups() };
+    mug->set_name("rob" + std::to_string(g + 1));
+
+    auto robot{ mug->mutable_robot() };
+    robot->set_name("ROB_" + std::to_string(g + 1));
+    robot->set_type(abb::robot::MechanicalUnit_Type_TCP_ROBOT);
+    robot->set_axes_total(AXES_PER_GROUP);
+    robot->set_mode(abb::robot::MechanicalUnit_Mode_ACTIVATED);
+
+    for (int i = 0; i < AXES_PER_GROUP; ++i)
+    {
+      abb::robot::StandardizedJoint* p_joint = robot->add_standardized_joints();
+      p_joint->set_standardized_name("rob" + std::to_string(g + 1) + "_joint_" + std::to_string(i + 1));
+      p_joint->set_rotating_move(true);
+      p_joint->set_lower_joint_bound(-3.14);
+      p_joint->set_upper_joint_bound(3.14);
+    }
+  }
+
+  return description;
+}
+
+/**
+ * \brief Temporary description cache directory, so that the drivers start without crawling the simulator.
+ */
+class CacheDirectory
+{
+public:
+  CacheDirectory()
+  {
+    char path[] = "/tmp/abb_simulator_XXXXXX";
+    path_ = mkdtemp(path) ? path : "/tmp";
+  }
+
+  ~CacheDirectory()
+  {
+    for (const auto& file : files_)
+    {
+      unlink(file.c_str());
+    }
+    rmdir(path_.c_str());
+  }
+
+  void store(const abb::robot::RobotControllerDescription& description, const std::uint16_t port,
+             const std::string& robot_id)
+  {
+    abb::robot::utilities::DescriptionCache cache{ path_, "127.0.0.1", port, robot_id };
+    cache.store(description);
+    files_.push_back(cache.path());
+  }
+
+  const std::string& path() const { return path_; }
+
+private:
+  std::string path_;
+  std::vector<std::string> files_;
+};
+
+void reportLatency(benchmark::State& state, const std::string& name, const LatencyHistogram::Summary& summary)
+{
+  state.counters[name + "_p50_us"] = 1e-3 * static_cast<double>(summary.p50);
+  state.counters[name + "_p90_us"] = 1e-3 * static_cast<double>(summary.p90);
+  state.counters[name + "_p99_us"] = 1e-3 * static_cast<double>(summary.p99);
+  state.counters[name + "_max_us"] = 1e-3 * static_cast<double>(summary.max);
+}
+
+/**
+ * \brief Drives ABBSystemHardware against the simulated mechanical units groups, at the robot's EGM rate.
+ *
+ * Every cycle reads the states, commands a slow sine motion of all joints and writes the commands, like the
+ * controller manager does. Reports the cycles per second, the read-to-write cycle times, and the closed-loop latency
+ * of the worst group as seen by the robot.
+ *
+ * Arguments: number of mechanical units groups, EGM rate [Hz], network conditions.
+ */
+void BM_ABBSystemHardware(benchmark::State& state)
+{
+  const auto num_groups = static_cast<int>(state.range(0));
+  const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(1.0 / static_cast<double>(state.range(1))));
+  const abb_simulator::NetworkConditions conditions = networkConditions(state.range(2));
+
+  abb_simulator::RWSSimulator rws{ 0, conditions };
+  rws.start();
+  CacheDirectory cache;
+  cache.store(makeDescription(num_groups), rws.port(), "IRB1200");
+
+  hardware_interface::HardwareInfo info;
+  info.name = "abb_benchmark";
+  info.hardware_parameters["configure_via_rws"] = "true";
+  info.hardware_parameters["rws_ip"] = "127.0.0.1";
+  info.hardware_parameters["rws_port"] = std::to_string(rws.port());
+  info.hardware_parameters["description_cache_dir"] = cache.path();
+  info.hardware_parameters["startup_timeout"] = "5.0";
+
+  std::vector<abb_simulator::EGMSimulator::GroupConfig> groups;
+  for (int g = 0; g < num_groups; ++g)
+  {
+    abb_simulator::EGMSimulator::GroupConfig group;
+    group.name = "rob" + std::to_string(g + 1);
+    group.port = static_cast<std::uint16_t>(HARDWARE_BASE_PORT + g);
+    group.robot_joints = AXES_PER_GROUP;
+    groups.push_back(group);
+    info.hardware_parameters[group.name + "egm_port"] = std::to_string(group.port);
+  }
+
+  abb_hardware_interface::ABBSystemHardware hardware;
+  if (hardware.on_init(info) != CallbackReturn::SUCCESS)
+  {
+    state.SkipWithError("Failed to initialize the hardware interface");
+    return;
+  }
+  std::vector<hardware_interface::StateInterface> states = hardware.export_state_interfaces();
+  std::vector<hardware_interface::CommandInterface> commands = hardware.export_command_interfaces();
+
+  abb_simulator::EGMSimulator egm{ "127.0.0.1", groups, period, conditions, 1 };
+  egm.start();
+  if (hardware.on_activate(rclcpp_lifecycle::State()) != CallbackReturn::SUCCESS)
+  {
+    state.SkipWithError("Failed to connect the hardware interface to the simulator");
+    return;
+  }
+
+  std::vector<hardware_interface::CommandInterface*> position_commands;
+  std::vector<double> initial_positions;
+  for (auto& command : commands)
+  {
+    if (command.get_interface_name() == hardware_interface::HW_IF_POSITION)
+    {
+      position_commands.push_back(&command);
+      initial_positions.push_back(command.get_value());
+    }
+  }
+
+  const auto cycles = static_cast<std::int64_t>(DURATION / (1e-9 * static_cast<double>(period.count())));
+  const rclcpp::Duration cycle_period{ period };
+  LatencyHistogram cycle_times;
+  for (auto _ : state)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    auto next = start;
+    for (std::int64_t k = 0; k < cycles; ++k)
+    {
+      std::this_thread::sleep_until(next);
+      next += period;
+
+      const auto cycle_start = std::chrono::steady_clock::now();
+      hardware.read(rclcpp::Time{}, cycle_period);
+      const double t = std::chrono::duration<double>(cycle_start - start).count();
+      const double offset = AMPLITUDE * std::sin(2.0 * M_PI * FREQUENCY * t);
+      for (std::size_t j = 0; j < position_commands.size(); ++j)
+      {
+        position_commands[j]->set_value(initial_positions[j] + offset);
+      }
+      hardware.write(rclcpp::Time{}, cycle_period);
+      cycle_times.record(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - cycle_start).count());
+    }
+  }
+  hardware.on_deactivate(rclcpp_lifecycle::State());
+  egm.stop();
+
+  LatencyHistogram::Summary worst;
+  std::uint64_t sent = 0;
+  std::uint64_t lost = 0;
+  for (std::size_t g = 0; g < egm.size(); ++g)
+  {
+    const auto statistics = egm.statistics(g);
+    sent += statistics.feedback_sent + statistics.feedback_lost;
+    lost += statistics.feedback_lost + statistics.commands_lost;
+    if (statistics.latency.p99 >= worst.p99)
+    {
+      worst = statistics.latency;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * cycles);
+  reportLatency(state, "cycle", cycle_times.summarize());
+  reportLatency(state, "closed_loop", worst);
+  state.counters["loss_ratio"] = sent > 0 ? static_cast<double>(lost) / static_cast<double>(sent) : 0.0;
+}
+
+/**
+ * \brief Calls a service of RWSServiceProviderROS at a fixed request rate, against the simulated RWS server.
+ *
+ * The requests are sent open loop, i.e. at the given rate regardless of outstanding responses, so the latency grows
+ * once the rate exceeds what the provider can serve. Reports the completed requests per second and the latency from
+ * request to response.
+ *
+ * Arguments: request rate [Hz], network conditions.
+ */
+void BM_RWSServiceProvider(benchmark::State& state)
+{
+  const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(1.0 / static_cast<double>(state.range(0))));
+  const abb_simulator::NetworkConditions conditions = networkConditions(state.range(1));
+
+  abb_simulator::RWSSimulator rws{ 0, conditions };
+  rws.setRAPIDSymbol("T_ROB1", "Benchmark", "counter", "42");
+  rws.start();
+  CacheDirectory cache;
+  cache.store(makeDescription(1), rws.port(), "benchmark");
+
+  rclcpp::NodeOptions options;
+  options.parameter_overrides({ { "robot_nickname", "benchmark" }, { "description_cache_dir", cache.path() } });
+  auto server_node = std::make_shared<rclcpp::Node>("rws_benchmark", options);
+  server_node->declare_parameter("robot_nickname", std::string{});
+  server_node->declare_parameter("no_connection_timeout", false);
+  server_node->declare_parameter("description_cache_dir", std::string{});
+  abb_rws_client::RWSServiceProviderROS provider{ server_node, "127.0.0.1", rws.port() };
+
+  auto client_node = std::make_shared<rclcpp::Node>("rws_benchmark_client");
+  auto client = client_node->create_client<abb_robot_msgs::srv::GetRAPIDNum>("/rws_benchmark/get_rapid_num");
+
+  rclcpp::executors::MultiThreadedExecutor executor;
+  executor.add_node(server_node);
+  executor.add_node(client_node);
+  std::thread spinner{ [&executor]() { executor.spin(); } };
+
+  LatencyHistogram latency;
+  std::atomic<std::uint64_t> succeeded{ 0 };
+  std::atomic<std::uint64_t> failed{ 0 };
+  std::uint64_t requested = 0;
+  if (!client->wait_for_service(std::chrono::seconds(5)))
+  {
+    state.SkipWithError("The RAPID service did not come up");
+  }
+  else
+  {
+    const auto requests = static_cast<std::int64_t>(DURATION / (1e-9 * static_cast<double>(period.count())));
+    for (auto _ : state)
+    {
+      auto next = std::chrono::steady_clock::now();
+      for (std::int64_t k = 0; k < requests; ++k)
+      {
+        std::this_thread::sleep_until(next);
+        next += period;
+
+        auto request = std::make_shared<abb_robot_msgs::srv::GetRAPIDNum::Request>();
+        request->path.task = "T_ROB1";
+        request->path.module = "Benchmark";
+        request->path.symbol = "counter";
+        const auto sent = std::chrono::steady_clock::now();
+        client->async_send_request(
+            request, [&, sent](rclcpp::Client<abb_robot_msgs::srv::GetRAPIDNum>::SharedFuture future) {
+              latency.record(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - sent)
+                      .count());
+              if (future.get()->result_code == abb_robot_msgs::msg::ServiceResponses::RC_SUCCESS)
+              {
+                ++succeeded;
+              }
+              else
+              {
+                ++failed;
+              }
+            });
+        ++requested;
+      }
+
+      // Wait for the backlog, which is part of the measured time
+      const auto drain_deadline =
+          std::chrono::steady_clock::now() + std::chrono::duration<double>(DRAIN_TIMEOUT);
+      while (succeeded + failed < requested && std::chrono::steady_clock::now() < drain_deadline)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  }
+
+  executor.cancel();
+  spinner.join();
+  rws.stop();
+
+  state.SetItemsProcessed(static_cast<std::int64_t>(succeeded.load()));
+  reportLatency(state, "latency", latency.summarize());
+  state.counters["failed"] = static_cast<double>(failed.load());
+  state.counters["unanswered"] = static_cast<double>(requested - succeeded.load() - failed.load());
+}
+}  // namespace
+
+// Each run drives one rate for DURATION, so a single iteration is enough.
+BENCHMARK(BM_ABBSystemHardware)
+    ->ArgsProduct({ { 1, 2, 4 }, { 250, 500, 1000 }, { 0, 1 } })
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RWSServiceProvider)
+    ->ArgsProduct({ { 10, 50, 100, 200, 500 }, { 0, 1 } })
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  rclcpp::shutdown();
+  return 0;
+}
@@ -15,6 +15,18 @@ PERS wobjdata currentWobj;
 VAR speeddata currentSpeed;
 VAR zonedata currentZone;
 
+!//Format of the stream, set by the SERVER task
+PERS bool loggerBinary;
+
+!//Binary records: BINARY_MARKER, the type of record (1 byte), 2 reserved
+!//bytes, the number of values (1 byte), 3 reserved bytes, the time and the
+!//values (4 byte floats), all little-endian.
+CONST num BINARY_MARKER := 171;
+CONST num BINARY_HEADER := 12;
+
+!//Text records end with a space, so that the client knows the last value
+!//is complete without waiting for the next record.
+
 !//Logger sampling rate
 !PERS num loggerWaitTime:= 0.01;  !Recommended for real controller
 PERS num loggerWaitTime:= 0.1;    !Recommended for virtual controller
@@ -38,6 +50,17 @@ PROC ServerCreateAndConnect(string ip, num port)
 	TPWrite "LOGGER: Connected to IP " + clientIP;
 ENDPROC
 
+PROC PackHeader(INOUT rawbytes record, num type, num nValues, num time)
+	ClearRawBytes record;
+	PackRawBytes BINARY_MARKER, record, 1 \IntX:=USINT;
+	PackRawBytes type, record, 2 \IntX:=USINT;
+	PackRawBytes 0, record, 3 \IntX:=UINT;
+	PackRawBytes nValues, record, 5 \IntX:=USINT;
+	PackRawBytes 0, record, 6 \IntX:=USINT;
+	PackRawBytes 0, record, 7 \IntX:=UINT;
+	PackRawBytes time, record, 9 \Float4;
+ENDPROC
+
 PROC main()
 	VAR string data;
 	VAR robtarget position;
@@ -48,6 +71,7 @@ PROC main()
 	VAR string date;
 	VAR string time;
 	VAR clock timer;
+	VAR rawbytes record;
 
 	date:= CDate();
 	time:= CTime();
@@ -60,34 +84,61 @@ PROC main()
 		
 		!Cartesian Coordinates
 		position := CRobT(\Tool:=currentTool \WObj:=currentWObj);
-		data := "# 0 ";
-		data := data + date + " " + time + " ";
-		data := data + NumToStr(ClkRead(timer),2) + " ";
-		data := data + NumToStr(position.trans.x,1) + " ";
-		data := data + NumToStr(position.trans.y,1) + " ";
-		data := data + NumToStr(position.trans.z,1) + " ";
-		data := data + NumToStr(position.rot.q1,3) + " ";
-		data := data + NumToStr(position.rot.q2,3) + " ";
-		data := data + NumToStr(position.rot.q3,3) + " ";
-		data := data + NumToStr(position.rot.q4,3); !End of string	
-		IF connected = TRUE THEN
-			SocketSend clientSocket \Str:=data;
+		IF loggerBinary THEN
+			PackHeader record, 0, 7, ClkRead(timer);
+			PackRawBytes position.trans.x, record, BINARY_HEADER + 1 \Float4;
+			PackRawBytes position.trans.y, record, BINARY_HEADER + 5 \Float4;
+			PackRawBytes position.trans.z, record, BINARY_HEADER + 9 \Float4;
+			PackRawBytes position.rot.q1, record, BINARY_HEADER + 13 \Float4;
+			PackRawBytes position.rot.q2, record, BINARY_HEADER + 17 \Float4;
+			PackRawBytes position.rot.q3, record, BINARY_HEADER + 21 \Float4;
+			PackRawBytes position.rot.q4, record, BINARY_HEADER + 25 \Float4;
+			IF connected = TRUE THEN
+				SocketSend clientSocket \RawData:=record;
+			ENDIF
+		ELSE
+			data := "# 0 ";
+			data := data + date + " " + time + " ";
+			data := data + NumToStr(ClkRead(timer),2) + " ";
+			data := data + NumToStr(position.trans.x,1) + " ";
+			data := data + NumToStr(position.trans.y,1) + " ";
+			data := data + NumToStr(position.trans.z,1) + " ";
+			data := data + NumToStr(position.rot.q1,3) + " ";
+			data := data + NumToStr(position.rot.q2,3) + " ";
+			data := data + NumToStr(position.rot.q3,3) + " ";
+			data := data + NumToStr(position.rot.q4,3) + " "; !End of record	
+			IF connected = TRUE THEN
+				SocketSend clientSocket \Str:=data;
+			ENDIF
 		ENDIF
 		WaitTime loggerWaitTime;
 	
 		!Joint Coordinates
 		joints := CJointT();
-		data := "# 1 ";
-		data := data + date + " " + time + " ";
-		data := data + NumToStr(ClkRead(timer),2) + " ";
-		data := data + NumToStr(joints.robax.rax_1,2) + " ";
-		data := data + NumToStr(joints.robax.rax_2,2) + " ";
-		data := data + NumToStr(joints.robax.rax_3,2) + " ";
-		data := data + NumToStr(joints.robax.rax_4,2) + " ";
-		data := data + NumToStr(joints.robax.rax_5,2) + " ";
-		data := data + NumToStr(joints.robax.rax_6,2); !End of string
-		IF connected = TRUE THEN
-			SocketSend clientSocket \Str:=data;
+		IF loggerBinary THEN
+			PackHeader record, 1, 6, ClkRead(timer);
+			PackRawBytes joints.robax.rax_1, record, BINARY_HEADER + 1 \Float4;
+			PackRawBytes joints.robax.rax_2, record, BINARY_HEADER + 5 \Float4;
+			PackRawBytes joints.robax.rax_3, record, BINARY_HEADER + 9 \Float4;
+			PackRawBytes joints.robax.rax_4, record, BINARY_HEADER + 13 \Float4;
+			PackRawBytes joints.robax.rax_5, record, BINARY_HEADER + 17 \Float4;
+			PackRawBytes joints.robax.rax_6, record, BINARY_HEADER + 21 \Float4;
+			IF connected = TRUE THEN
+				SocketSend clientSocket \RawData:=record;
+			ENDIF
+		ELSE
+			data := "# 1 ";
+			data := data + date + " " + time + " ";
+			data := data + NumToStr(ClkRead(timer),2) + " ";
+			data := data + NumToStr(joints.robax.rax_1,2) + " ";
+			data := data + NumToStr(joints.robax.rax_2,2) + " ";
+			data := data + NumToStr(joints.robax.rax_3,2) + " ";
+			data := data + NumToStr(joints.robax.rax_4,2) + " ";
+			data := data + NumToStr(joints.robax.rax_5,2) + " ";
+			data := data + NumToStr(joints.robax.rax_6,2) + " "; !End of record
+			IF connected = TRUE THEN
+				SocketSend clientSocket \Str:=data;
+			ENDIF
 		ENDIF
 		WaitTime loggerWaitTime;
 	ENDWHILE
@@ -21,9 +21,29 @@ PERS bool frameMutex:=FALSE;
 VAR socketdev clientSocket;
 VAR socketdev serverSocket;
 VAR num instructionCode;
+VAR num idCode;
 VAR num params{10};
 VAR num nParams;
 
+!//Received bytes that have not been parsed yet. The PC may send several
+!// commands without waiting for their replies, so a receive can hold more
+!// than one command (or only part of one).
+VAR rawbytes receiveBuffer;
+VAR rawbytes receivedBytes;
+CONST num MAX_MSG_LENGTH := 80;
+
+!//Binary protocol (see ReceiveCommand and SendReply)
+CONST num BINARY_MARKER := 171;
+CONST num BINARY_COMMAND_HEADER := 8;
+CONST num BINARY_REPLY_HEADER := 12;
+VAR bool binaryCommand;      !//Whether the last command was binary
+VAR rawbytes sendBytes;
+VAR num replyValues{10};     !//Values of the reply to a binary command
+VAR num nReplyValues;
+
+!//Format of the LOGGER stream, shared with the LOGGER task
+PERS bool loggerBinary:=FALSE;
+
 !PERS string ipController:= "192.168.125.1"; !robot default IP
 PERS string ipController:= "127.0.0.1"; !local IP for testing in simulation
 PERS num serverPort:= 5000;
@@ -38,6 +58,10 @@ CONST num MAX_BUFFER := 512;
 VAR num BUFFER_POS := 0;
 VAR robtarget bufferTargets{MAX_BUFFER};
 VAR speeddata bufferSpeeds{MAX_BUFFER};
+VAR num BUFFER_JOINT_POS := 0;
+VAR jointtarget bufferJoints{MAX_BUFFER};
+VAR speeddata bufferJointSpeeds{MAX_BUFFER};
+VAR num bufferJointTimes{MAX_BUFFER};
 
 !//External axis position variables
 VAR extjoint externalAxis;
@@ -60,6 +84,7 @@ CONST num SERVER_OK := 1;
 !//Method to parse the message received from a PC
 !// If correct message, loads values on:
 !// - instructionCode.
+!// - idCode: Identification code, sent back with the reply.
 !// - nParams: Number of received parameters.
 !// - params{nParams}: Vector of received params.
 PROC ParseMsg(string msg)
@@ -87,6 +112,20 @@ PROC ParseMsg(string msg)
             nParams := -1;
         ELSE
             ind := newInd;
+            !//Read identification code
+            newInd := StrMatch(msg,ind," ") + 1;
+            IF newInd > length THEN
+                end := TRUE;
+                indParam := 0;
+            ELSE
+                subString := StrPart(msg,ind,newInd - ind - 1);
+                auxOk := StrToVal(subString, idCode);
+                IF auxOk = FALSE THEN
+                    end := TRUE;
+                    indParam := 0;
+                ENDIF
+                ind := newInd;
+            ENDIF
             !//Read all instruction parameters (maximum of 8)
             WHILE end = FALSE DO
                 newInd := StrMatch(msg,ind," ") + 1;
@@ -105,12 +144,132 @@ PROC ParseMsg(string msg)
 ENDPROC
 
 
+!//Method to receive the next command from the PC, and parse it
+!// Text commands end with the "#" character. Binary commands start with
+!// BINARY_MARKER, followed by the instruction code (1 byte), the
+!// identification code (2 bytes), the number of parameters (1 byte), 3
+!// reserved bytes and the parameters (4 byte floats), all little-endian.
+!// Bytes received after the end of the command are kept in receiveBuffer
+!// for the following calls.
+PROC ReceiveCommand()
+    !//Local variables
+    VAR num frameLength := 0;
+    VAR num ind := 1;
+    VAR num length;
+    VAR num value;
+    VAR string msg;
+
+    !//Wait until a whole command has been received
+    WHILE frameLength = 0 DO
+        length := RawBytesLen(receiveBuffer);
+        binaryCommand := FALSE;
+        IF length > 0 THEN
+            UnpackRawBytes receiveBuffer, 1, value \IntX:=USINT;
+            binaryCommand := (value = BINARY_MARKER);
+        ENDIF
+        IF binaryCommand THEN
+            IF length >= BINARY_COMMAND_HEADER THEN
+                UnpackRawBytes receiveBuffer, 5, value \IntX:=USINT;
+                IF length >= BINARY_COMMAND_HEADER + 4 * value THEN
+                    frameLength := BINARY_COMMAND_HEADER + 4 * value;
+                ENDIF
+            ENDIF
+        ELSE
+            WHILE frameLength = 0 AND ind <= length DO
+                UnpackRawBytes receiveBuffer, ind, value \IntX:=USINT;
+                IF value = 35 THEN
+                    frameLength := ind;
+                ENDIF
+                ind := ind + 1;
+            ENDWHILE
+        ENDIF
+        IF frameLength = 0 THEN
+            SocketReceive clientSocket \RawData:=receivedBytes \Time:=WAIT_MAX;
+            CopyRawBytes receivedBytes, 1, receiveBuffer, length + 1;
+        ENDIF
+    ENDWHILE
+
+    !//Extract the command
+    IF binaryCommand THEN
+        UnpackRawBytes receiveBuffer, 2, instructionCode \IntX:=USINT;
+        UnpackRawBytes receiveBuffer, 3, idCode \IntX:=UINT;
+        UnpackRawBytes receiveBuffer, 5, nParams \IntX:=USINT;
+        IF nParams > Dim(params,1) THEN
+            !//Corrupt message
+            nParams := -1;
+        ELSE
+            FOR i FROM 1 TO nParams DO
+                UnpackRawBytes receiveBuffer, BINARY_COMMAND_HEADER + 4 * i - 3, params{i} \Float4;
+            ENDFOR
+        ENDIF
+    ELSE
+        !//A command too long for a string is corrupt
+        IF frameLength <= MAX_MSG_LENGTH THEN
+            UnpackRawBytes receiveBuffer, 1, msg \ASCII:=frameLength;
+        ELSE
+            msg := "";
+        ENDIF
+        ParseMsg msg;
+    ENDIF
+
+    !//Keep the remaining bytes
+    length := RawBytesLen(receiveBuffer) - frameLength;
+    ClearRawBytes receivedBytes;
+    IF length > 0 THEN
+        CopyRawBytes receiveBuffer, frameLength + 1, receivedBytes, 1 \NoOfBytes:=length;
+    ENDIF
+    ClearRawBytes receiveBuffer;
+    IF length > 0 THEN
+        CopyRawBytes receivedBytes, 1, receiveBuffer, 1;
+    ENDIF
+ENDPROC
+
+
+!//Method to send the reply to the last command to the PC
+!// Text commands get a text reply:
+!//   instructionCode idCode ok time addString #
+!// Binary commands get a binary reply: BINARY_MARKER, the instruction code
+!// (1 byte), the identification code (2 bytes), the number of values
+!// (1 byte), ok (1 byte), 2 reserved bytes, the time and the values
+!// (4 byte floats), all little-endian.
+PROC SendReply(string addString, num time)
+    VAR string sendString;
+
+    IF binaryCommand THEN
+        ClearRawBytes sendBytes;
+        PackRawBytes BINARY_MARKER, sendBytes, 1 \IntX:=USINT;
+        PackRawBytes instructionCode, sendBytes, 2 \IntX:=USINT;
+        PackRawBytes idCode, sendBytes, 3 \IntX:=UINT;
+        PackRawBytes nReplyValues, sendBytes, 5 \IntX:=USINT;
+        PackRawBytes ok, sendBytes, 6 \IntX:=USINT;
+        PackRawBytes 0, sendBytes, 7 \IntX:=UINT;
+        PackRawBytes time, sendBytes, 9 \Float4;
+        FOR i FROM 1 TO nReplyValues DO
+            PackRawBytes replyValues{i}, sendBytes, BINARY_REPLY_HEADER + 4 * i - 3 \Float4;
+        ENDFOR
+        SocketSend clientSocket \RawData:=sendBytes;
+    ELSE
+        sendString := NumToStr(instructionCode,0);
+        sendString := sendString + " " + NumToStr(idCode,0);
+        sendString := sendString + " " + NumToStr(ok,0);
+        sendString := sendString + " " + NumToStr(time,2);
+        sendString := sendString + " " + addString + " #";
+        SocketSend clientSocket \Str:=sendString;
+    ENDIF
+ENDPROC
+
+
 !//Handshake between server and client:
 !// - Creates socket.
 !// - Waits for incoming TCP connection.
 PROC ServerCreateAndConnect(string ip, num port)
     VAR string clientIP;
 	
+    !//Drop anything left over from a previous connection
+    ClearRawBytes receiveBuffer;
+    ClearRawBytes receivedBytes;
+    loggerBinary := FALSE;
+
     SocketCreate serverSocket;
     SocketBind serverSocket, ip, port;
     SocketListen serverSocket;
@@ -151,18 +310,18 @@ ENDPROC
 !////////////////////////
 PROC main()
     !//Local variables
-    VAR string receivedString;   !//Received string
-    VAR string sendString;       !//Reply string
     VAR string addString;        !//String to add to the reply.
     VAR bool connected;          !//Client connected
     VAR bool reconnected;        !//Drop and reconnection happened during serving a command
     VAR robtarget cartesianPose;
     VAR jointtarget jointsPose;
+    VAR clock timer;             !//Time stamp of the replies
     			
     !//Motion configuration
     ConfL \Off;
     SingArea \Wrist;
     moveCompleted:= TRUE;
+    ClkStart timer;
 	
     !//Initialization of WorkObject, Tool, Speed and Zone
     Initialize;
@@ -178,10 +337,10 @@ PROC main()
         ok:=SERVER_OK;              !//Correctness of executed instruction.
         reconnected:=FALSE;         !//Has communication dropped after receiving a command?
         addString := "";            
+        nReplyValues := 0;
 
         !//Wait for a command
-        SocketReceive clientSocket \Str:=receivedString \Time:=WAIT_MAX;
-        ParseMsg receivedString;
+        ReceiveCommand;
 	
         !//Execution of the command
         TEST instructionCode
@@ -227,6 +386,10 @@ PROC main()
                     addString := addString + NumToStr(cartesianPose.rot.q2,3) + " ";
                     addString := addString + NumToStr(cartesianPose.rot.q3,3) + " ";
                     addString := addString + NumToStr(cartesianPose.rot.q4,3); !End of string	
+                    replyValues := [cartesianPose.trans.x, cartesianPose.trans.y, cartesianPose.trans.z,
+                                    cartesianPose.rot.q1, cartesianPose.rot.q2, cartesianPose.rot.q3,
+                                    cartesianPose.rot.q4, 0, 0, 0];
+                    nReplyValues := 7;
                     ok := SERVER_OK;
                 ELSE
                     ok :=SERVER_BAD_MSG;
@@ -241,6 +404,10 @@ PROC main()
                     addString := addString + NumToStr(jointsPose.robax.rax_4,2) + " ";
                     addString := addString + NumToStr(jointsPose.robax.rax_5,2) + " ";
                     addString := addString + NumToStr(jointsPose.robax.rax_6,2); !End of string
+                    replyValues := [jointsPose.robax.rax_1, jointsPose.robax.rax_2, jointsPose.robax.rax_3,
+                                    jointsPose.robax.rax_4, jointsPose.robax.rax_5, jointsPose.robax.rax_6,
+                                    0, 0, 0, 0];
+                    nReplyValues := 6;
                     ok := SERVER_OK;
                 ELSE
                     ok:=SERVER_BAD_MSG;
@@ -254,6 +421,10 @@ PROC main()
                     addString := addString + StrPart(NumToStr(jointsTarget.extax.eax_d,2),1,8) + " ";
                     addString := addString + StrPart(NumToStr(jointsTarget.extax.eax_e,2),1,8) + " ";
                     addString := addString + StrPart(NumToStr(jointsTarget.extax.eax_f,2),1,8); !End of string
+                    replyValues := [jointsTarget.extax.eax_a, jointsTarget.extax.eax_b, jointsTarget.extax.eax_c,
+                                    jointsTarget.extax.eax_d, jointsTarget.extax.eax_e, jointsTarget.extax.eax_f,
+                                    0, 0, 0, 0];
+                    nReplyValues := 6;
                     ok := SERVER_OK;
                 ELSE
                     ok:=SERVER_BAD_MSG;
@@ -352,6 +523,8 @@ PROC main()
             CASE 32: !Get Buffer Size)
                 IF nParams = 0 THEN
                     addString := NumToStr(BUFFER_POS,2);
+                    replyValues{1} := BUFFER_POS;
+                    nReplyValues := 1;
                     ok := SERVER_OK;
                 ELSE
                     ok:=SERVER_BAD_MSG;
@@ -402,7 +575,68 @@ PROC main()
                 ELSE
                     ok:=SERVER_BAD_MSG;
                 ENDIF
+
+            CASE 37: !Add Joint Coordinates to buffer, with an optional move time (s)
+                IF nParams = 6 OR nParams = 7 THEN
+                    jointsTarget:=[[params{1},params{2},params{3},params{4},params{5},params{6}], externalAxis];
+                    IF BUFFER_JOINT_POS < MAX_BUFFER THEN
+                        BUFFER_JOINT_POS := BUFFER_JOINT_POS + 1;
+                        bufferJoints{BUFFER_JOINT_POS} := jointsTarget;
+                        bufferJointSpeeds{BUFFER_JOINT_POS} := currentSpeed;
+                        bufferJointTimes{BUFFER_JOINT_POS} := 0;
+                        IF nParams = 7 THEN
+                            bufferJointTimes{BUFFER_JOINT_POS} := params{7};
+                        ENDIF
+                        ok := SERVER_OK;
+                    ELSE
+                        ok := SERVER_BAD_MSG;
+                    ENDIF
+                ELSE
+                    ok:=SERVER_BAD_MSG;
+                ENDIF
+
+            CASE 38: !Clear Joint Buffer
+                IF nParams = 0 THEN
+                    BUFFER_JOINT_POS := 0;
+                    ok := SERVER_OK;
+                ELSE
+                    ok:=SERVER_BAD_MSG;
+                ENDIF
+
+            CASE 39: !Get Joint Buffer Size
+                IF nParams = 0 THEN
+                    addString := NumToStr(BUFFER_JOINT_POS,2);
+                    replyValues{1} := BUFFER_JOINT_POS;
+                    nReplyValues := 1;
+                    ok := SERVER_OK;
+                ELSE
+                    ok:=SERVER_BAD_MSG;
+                ENDIF
+
+            CASE 40: !Execute moves in jointBuffer as joint moves
+                IF nParams = 0 THEN
+                    moveCompleted := FALSE;
+                    FOR i FROM 1 TO (BUFFER_JOINT_POS) DO
+                        IF bufferJointTimes{i} > 0 THEN
+                            MoveAbsJ bufferJoints{i}, bufferJointSpeeds{i} \T:=bufferJointTimes{i}, currentZone, currentTool \Wobj:=currentWobj;
+                        ELSE
+                            MoveAbsJ bufferJoints{i}, bufferJointSpeeds{i}, currentZone, currentTool \Wobj:=currentWobj;
+                        ENDIF
+                    ENDFOR
+                    moveCompleted := TRUE;
+                    ok := SERVER_OK;
+                ELSE
+                    ok:=SERVER_BAD_MSG;
+                ENDIF
 				
+            CASE 41: !Set the format of the LOGGER stream (0: text, 1: binary)
+                IF nParams = 1 THEN
+                    loggerBinary := (params{1} = 1);
+                    ok := SERVER_OK;
+                ELSE
+                    ok:=SERVER_BAD_MSG;
+                ENDIF
+
             CASE 98: !returns current robot info: serial number, robotware version, and robot type
                 IF nParams = 0 THEN
                     addString := GetSysInfo(\SerialNo) + "*";
@@ -438,10 +672,7 @@ PROC main()
         IF connected = TRUE THEN
             IF reconnected = FALSE THEN
 			    IF SocketGetStatus(clientSocket) = SOCKET_CONNECTED THEN
-				    sendString := NumToStr(instructionCode,0);
-                    sendString := sendString + " " + NumToStr(ok,0);
-                    sendString := sendString + " " + addString;
-                    SocketSend clientSocket \Str:=sendString;
+				    SendReply addString, ClkRead(timer);
 			    ENDIF
             ENDIF
         ENDIF
@@ -0,0 +1,186 @@
+//
+// abb_node Benchmark
+//
+// Measures the per-message work of the node outside of ROS: formatting
+// the commands for the motion server (text and binary protocols), and
+// parsing the logger stream as readLogger does, from a recorded-like
+// stream of cartesian, joint and force records split into TCP segments.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "abb_comm.h"
+#include "logger_parser.h"
+
+// Bytes per receive, as a TCP segment over ethernet
+#define SEGMENT_SIZE 1448
+
+// Records of each type in the logger stream
+#define STREAM_RECORDS 200
+
+// A little-endian float, as the binary protocol sends it
+static void putFloat(std::string &frame, float value)
+{
+  unsigned int word;
+  memcpy(&word, &value, 4);
+  for (int i = 0; i < 4; i++)
+    frame += (char)((word >> (8 * i)) & 0xFF);
+}
+
+static void appendBinaryRecord(std::string &stream, int type, double time,
+    const double *values, int nValues)
+{
+  stream += (char)BINARY_MARKER;
+  stream += (char)type;
+  stream += (char)0;  // Identification code
+  stream += (char)0;
+  stream += (char)nValues;
+  stream += (char)1;  // Ok
+  stream += (char)0;  // Reserved
+  stream += (char)0;
+  putFloat(stream, time);
+  for (int i = 0; i < nValues; i++)
+    putFloat(stream, values[i]);
+}
+
+// The records of LOGGER.mod, at its rates: a cartesian and a joint record
+// every cycle, and a force record
+static std::string loggerStream(bool binary)
+{
+  std::string stream;
+  char record[MAX_LOGGER_RECORD + 1];
+  for (int k = 0; k < STREAM_RECORDS; k++)
+  {
+    double time = 0.004 * k;
+    double pose[7] = {600.0 + 0.1 * k, -50.0, 450.0, 0.707, 0.0, 0.707, 0.0};
+    double joints[6] = {0.01 * k, 12.5, -8.25, 0.0, 45.0, -90.0};
+    double force[6] = {1.5, -0.25, 9.8, 0.01, 0.02, 0.0};
+    if (binary)
+    {
+      appendBinaryRecord(stream, LOG_CARTESIAN, time, pose, 7);
+      appendBinaryRecord(stream, LOG_JOINTS, time, joints, 6);
+      appendBinaryRecord(stream, LOG_FORCE, time, force, 6);
+      continue;
+    }
+    snprintf(record, sizeof(record), "# 0 2026-10-14 10:00:00 %.2f %.1f "
+        "%.1f %.1f %.3f %.3f %.3f %.3f ", time, pose[0], pose[1], pose[2],
+        pose[3], pose[4], pose[5], pose[6]);
+    stream += record;
+    snprintf(record, sizeof(record), "# 1 2026-10-14 10:00:00 %.2f %.2f "
+        "%.2f %.2f %.2f %.2f %.2f ", time, joints[0], joints[1], joints[2],
+        joints[3], joints[4], joints[5]);
+    stream += record;
+    snprintf(record, sizeof(record), "# 2 2026-10-14 10:00:00 %.2f %.2f "
+        "%.2f %.2f %.2f %.2f %.2f ", time, force[0], force[1], force[2],
+        force[3], force[4], force[5]);
+    stream += record;
+  }
+  return stream;
+}
+
+static void BM_SetCartesian_Text(benchmark::State &state)
+{
+  int idCode = 0;
+  for (auto _ : state)
+  {
+    std::string message = abb_comm::setCartesian(600.0, -50.0, 450.0,
+        0.707, 0.0, 0.707, 0.0, idCode);
+    benchmark::DoNotOptimize(message.data());
+    idCode = (idCode + 1) % 1000;
+  }
+}
+BENCHMARK(BM_SetCartesian_Text);
+
+static void BM_SetCartesian_Binary(benchmark::State &state)
+{
+  double params[7] = {600.0, -50.0, 450.0, 0.707, 0.0, 0.707, 0.0};
+  char frame[BINARY_MAX_LENGTH];
+  int idCode = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(abb_comm::encodeCommand(frame, 1, params, 7,
+          idCode));
+    benchmark::DoNotOptimize(frame);
+    idCode = (idCode + 1) % 1000;
+  }
+}
+BENCHMARK(BM_SetCartesian_Binary);
+
+static void BM_SetJoints_Text(benchmark::State &state)
+{
+  int idCode = 0;
+  for (auto _ : state)
+  {
+    std::string message = abb_comm::setJoints(10.0, 12.5, -8.25, 0.0,
+        45.0, -90.0, idCode);
+    benchmark::DoNotOptimize(message.data());
+    idCode = (idCode + 1) % 1000;
+  }
+}
+BENCHMARK(BM_SetJoints_Text);
+
+static void BM_SetJoints_Binary(benchmark::State &state)
+{
+  double params[6] = {10.0, 12.5, -8.25, 0.0, 45.0, -90.0};
+  char frame[BINARY_MAX_LENGTH];
+  int idCode = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(abb_comm::encodeCommand(frame, 2, params, 6,
+          idCode));
+    benchmark::DoNotOptimize(frame);
+    idCode = (idCode + 1) % 1000;
+  }
+}
+BENCHMARK(BM_SetJoints_Binary);
+
+// Feeds the stream through the parser in segments, as readLogger receives
+// it, and takes out every sample
+static void parseStream(benchmark::State &state, bool binary)
+{
+  const std::string stream = loggerStream(binary);
+  LoggerParser *parser = new LoggerParser();
+  logger_sample sample;
+  for (auto _ : state)
+  {
+    int offset = 0;
+    while (offset < (int)stream.size())
+    {
+      int space;
+      char *buffer = parser->receiveBuffer(space);
+      int length = (int)stream.size() - offset;
+      if (length > space)
+        length = space;
+      if (length > SEGMENT_SIZE)
+        length = SEGMENT_SIZE;
+      memcpy(buffer, stream.data() + offset, length);
+      parser->received(length);
+      offset += length;
+      while (parser->next(sample))
+        benchmark::DoNotOptimize(sample.values);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * stream.size());
+  state.SetItemsProcessed(state.iterations() * 3 * STREAM_RECORDS);
+  state.counters["malformed"] = parser->malformed;
+  state.counters["dropped"] = parser->dropped;
+  delete parser;
+}
+
+static void BM_LoggerParse_Text(benchmark::State &state)
+{
+  parseStream(state, false);
+}
+BENCHMARK(BM_LoggerParse_Text);
+
+static void BM_LoggerParse_Binary(benchmark::State &state)
+{
+  parseStream(state, true);
+}
+BENCHMARK(BM_LoggerParse_Binary);
+
+BENCHMARK_MAIN();
@@ -24,6 +24,7 @@ log.addHandler(logging.NullHandler())
 class Robot:
     def __init__(self, ip="192.168.125.1", port_motion=5000, port_logger=5001):
         self.delay = 0.08
+        self.id_code = 0
 
         self.connect_motion((ip, port_motion))
         # log_thread = Thread(target = self.get_net,
@@ -95,7 +96,7 @@ class Robot:
         msg = "03 #"
         data = self.send(msg).split()
         r = [float(s) for s in data]
-        return [r[2:5], r[5:9]]
+        return [r[4:7], r[7:11]]
 
     def get_joints(self):
         """
@@ -103,7 +104,7 @@ class Robot:
         """
         msg = "04 #"
         data = self.send(msg).split()
-        return [float(s) / self.scale_angle for s in data[2:8]]
+        return [float(s) / self.scale_angle for s in data[4:10]]
 
     def get_external_axis(self):
         """
@@ -112,7 +113,7 @@ class Robot:
         """
         msg = "05 #"
         data = self.send(msg).split()
-        return [float(s) for s in data[2:8]]
+        return [float(s) for s in data[4:10]]
 
     def get_robotinfo(self):
         """
@@ -122,7 +123,7 @@ class Robot:
         ['24-53243', 'ROBOTWARE_5.12.1021.01', '2400/16 Type B']
         """
         msg = "98 #"
-        data = str(self.send(msg))[5:].split("*")
+        data = self.send(msg).split(None, 4)[4].split("*")
         log.debug("get_robotinfo result: %s", str(data))
         return data
 
@@ -256,7 +257,7 @@ class Robot:
         """
         msg = "32 #"
         data = self.send(msg).split()
-        return int(float(data[2]))
+        return int(float(data[4]))
 
     def buffer_execute(self):
         """
@@ -265,6 +266,57 @@ class Robot:
         msg = "33 #"
         return self.send(msg)
 
+    def buffer_add_joints(self, joints):
+        """
+        Appends single joint target to the remote joint buffer
+        Move will execute at current speed (which you can change between buffer_add_joints calls)
+        """
+        if len(joints) != 6:
+            return False
+        msg = "37 "
+        for joint in joints:
+            msg += format(joint * self.scale_angle, "+08.2f") + " "
+        msg += "#"
+        self.send(msg)
+
+    def buffer_set_joints(self, joints_list):
+        """
+        Adds every joint target in joints_list to the remote joint buffer
+        """
+        self.clear_joints_buffer()
+        for joints in joints_list:
+            self.buffer_add_joints(joints)
+        if self.joints_buffer_len() == len(joints_list):
+            log.debug("Successfully added %i joint targets to remote buffer", len(joints_list))
+            return True
+        else:
+            log.warn("Failed to add joint targets to remote buffer!")
+            self.clear_joints_buffer()
+            return False
+
+    def clear_joints_buffer(self):
+        msg = "38 #"
+        data = self.send(msg)
+        if self.joints_buffer_len() != 0:
+            log.warn("clear_joints_buffer failed! joints_buffer_len: %i", self.joints_buffer_len())
+            raise NameError("clear_joints_buffer failed!")
+        return data
+
+    def joints_buffer_len(self):
+        """
+        Returns the length (number of joint targets stored) of the remote joint buffer
+        """
+        msg = "39 #"
+        data = self.send(msg).split()
+        return int(float(data[4]))
+
+    def joints_buffer_execute(self):
+        """
+        Immediately execute joint moves to every joint target in the remote joint buffer.
+        """
+        msg = "40 #"
+        return self.send(msg)
+
     def set_external_axis(self, axis_unscaled=[-550, 0, 0, 0, 0, 0]):
         if len(axis_unscaled) != 6:
             return False
@@ -283,7 +335,7 @@ class Robot:
         msg_1 = "36 " + self.format_pose(pose_end)
 
         data = self.send(msg_0).split()
-        if data[1] != "1":
+        if data[2] != "1":
             log.warn("move_circular incorrect response, bailing!")
             return False
         return self.send(msg_1)
@@ -302,14 +354,26 @@ class Robot:
         """
         Send a formatted message to the robot socket.
         if wait_for_response, we wait for the response and return it
+
+        The identification code is inserted after the instruction code, and
+        the response is returned without its "#" terminator, as:
+        instruction_code id_code ok time_stamp [values]
         """
         caller = inspect.stack()[1][3]
+        self.id_code = self.id_code % 999 + 1
+        message = message[:3] + format(self.id_code, "03d") + " " + message[3:]
         log.debug("%-14s sending: %s", caller, message)
         self.sock.sendto(message.encode(), (self.ip, self.port_motion))
         time.sleep(self.delay)
         if not wait_for_response:
             return
-        data = self.sock.recv(4096)
+        data = b""
+        while b"#" not in data:
+            received = self.sock.recv(4096)
+            if not received:
+                raise socket.error("Connection to the robot closed")
+            data += received
+        data = data[: data.index(b"#")].decode().strip()
         log.debug("%-14s recieved: %s", caller, data)
         return data
 
@@ -317,6 +317,242 @@ string abb_comm::setDIO(int dio_number, int dio_state, int idCode)
 }
 
 
+/**
+  * Formats message to add a cartesian target to the buffer in the ABB robot.
+  * The target is stored with the current speed, and executed with executeBuffer().
+  * @param x X-coordinate of the robot.
+  * @param y Y-coordinate of the robot.
+  * @param z Z-coordinate of the robot.
+  * @param q0 First component of the orientation quaternion.
+  * @param qx Second component of the orientation quaternion.
+  * @param qy Third component of the orientation quaternion.
+  * @param qz Fourth component of the orientation quaternion.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::addBuffer(double x, double y, double z, double q0, double qx, double qy, double qz, int idCode)
+{
+  char buff[10];
+  string msg("30 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  sprintf(buff,"%+08.1lf ",x);
+  msg += buff ;
+  sprintf(buff,"%+08.1lf ",y);
+  msg += buff ;
+  sprintf(buff,"%+08.1lf ",z);
+  msg += buff ;
+  sprintf(buff,"%+08.5lf ",q0);
+  msg += buff ;
+  sprintf(buff,"%+08.5lf ",qx);
+  msg += buff ;
+  sprintf(buff,"%+08.5lf ",qy);
+  msg += buff ;
+  sprintf(buff,"%+08.5lf ",qz);
+  msg += buff ;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to clear the buffer of cartesian targets in the ABB robot.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::clearBuffer(int idCode)
+{
+  char buff[10];
+  string msg("31 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to query the ABB robot for the number of cartesian targets in its buffer.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::getBufferSize(int idCode)
+{
+  char buff[10];
+  string msg("32 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to execute the buffered cartesian targets as linear moves, with the current zone.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::executeBuffer(int idCode)
+{
+  char buff[10];
+  string msg("33 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to add a joint target to the buffer in the ABB robot.
+  * The target is stored with the current speed, and executed with executeJointsBuffer().
+  * @param joint1 Value of joint 1.
+  * @param joint2 Value of joint 2.
+  * @param joint3 Value of joint 3.
+  * @param joint4 Value of joint 4.
+  * @param joint5 Value of joint 5.
+  * @param joint6 Value of joint 6.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::addJointsBuffer(double joint1, double joint2, double joint3, double joint4, double joint5, double joint6, int idCode)
+{
+  char buff[10];
+  string msg("37 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  sprintf(buff,"%+08.2lf ",joint1);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint2);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint3);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint4);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint5);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint6);
+  msg += buff ;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to add a joint target to the buffer in the ABB robot, reached in a given time.
+  * The robot then moves to the target in that time instead of at the current speed.
+  * @param joint1 Value of joint 1.
+  * @param joint2 Value of joint 2.
+  * @param joint3 Value of joint 3.
+  * @param joint4 Value of joint 4.
+  * @param joint5 Value of joint 5.
+  * @param joint6 Value of joint 6.
+  * @param time Duration of the move to the target, in seconds.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::addJointsBufferTimed(double joint1, double joint2, double joint3, double joint4, double joint5, double joint6, double time, int idCode)
+{
+  char buff[20];
+  string msg("37 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  sprintf(buff,"%+08.2lf ",joint1);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint2);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint3);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint4);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint5);
+  msg += buff ;
+  sprintf(buff,"%+08.2lf ",joint6);
+  msg += buff ;
+  sprintf(buff,"%08.3lf ",time);
+  msg += buff ;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to clear the buffer of joint targets in the ABB robot.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::clearJointsBuffer(int idCode)
+{
+  char buff[10];
+  string msg("38 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to query the ABB robot for the number of joint targets in its buffer.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::getJointsBufferSize(int idCode)
+{
+  char buff[10];
+  string msg("39 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to execute the buffered joint targets as joint moves, with the current zone.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::executeJointsBuffer(int idCode)
+{
+  char buff[10];
+  string msg("40 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
+/**
+  * Formats message to set the format of the stream of the logger server in the ABB robot.
+  * @param binary Whether the logger server sends binary records instead of text.
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return String to be sent to ABB server.
+  */
+string abb_comm::setLoggerFormat(bool binary, int idCode)
+{
+  char buff[10];
+  string msg("41 ");//instruction code;
+  
+  sprintf(buff,"%.3d ",idCode); //identification code
+  msg += buff;
+  sprintf(buff,"%d ",binary ? 1 : 0);
+  msg += buff;
+  msg += "#";
+
+  return (msg);
+}
+
 /**
   * Formats message to close the connection with the server in the ABB robot.
   * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
@@ -379,3 +615,118 @@ int abb_comm::parseJoints(std::string msg,  double *joint1,
   else
     return -1;
 }
+
+/**
+  * Parser for the answer from the controller to the commands getBufferSize() and getJointsBufferSize().
+  * @param msg String message to parse.
+  * @param size Placer for the number of targets in the buffer.
+  * @return Whether the message was received correctly or not by the ABB robot.
+  */
+int abb_comm::parseBufferSize(std::string msg, int *size)
+{
+  int ok, idCode;
+  double bufferSize = 0.0;
+  sscanf(msg.c_str(),"%*d %d %d %*f %lf",&idCode,&ok,&bufferSize);
+  *size = (int)(bufferSize + 0.5);
+  if (ok)
+    return idCode;
+  else
+    return -1;
+}
+
+/**
+  * Formats a binary command. Values are written as little-endian 4 byte floats.
+  * @param frame Placer for the command, which must hold BINARY_MAX_LENGTH bytes.
+  * @param instructionCode Instruction code of the command (see the text commands).
+  * @param params Parameters of the command, in the same units as the text commands.
+  * @param nParams Number of parameters (at most BINARY_MAX_VALUES).
+  * @param idCode User code identifying the message. Will be sent back with the acknowledgement.
+  * @return Length of the command, or -1 if there are too many parameters.
+  */
+int abb_comm::encodeCommand(char *frame, int instructionCode, const double *params, int nParams, int idCode)
+{
+  if (nParams < 0 || nParams > BINARY_MAX_VALUES)
+    return -1;
+
+  unsigned char *bytes = (unsigned char *)frame;
+  bytes[0] = BINARY_MARKER;
+  bytes[1] = (unsigned char)instructionCode;
+  bytes[2] = (unsigned char)(idCode & 0xFF);
+  bytes[3] = (unsigned char)((idCode >> 8) & 0xFF);
+  bytes[4] = (unsigned char)nParams;
+  bytes[5] = bytes[6] = bytes[7] = 0;
+
+  for (int i = 0; i < nParams; i++)
+  {
+    float value = (float)params[i];
+    unsigned int word;
+    memcpy(&word, &value, 4);
+    unsigned char *p = bytes + BINARY_COMMAND_HEADER + 4 * i;
+    p[0] = (unsigned char)(word & 0xFF);
+    p[1] = (unsigned char)((word >> 8) & 0xFF);
+    p[2] = (unsigned char)((word >> 16) & 0xFF);
+    p[3] = (unsigned char)((word >> 24) & 0xFF);
+  }
+  return BINARY_COMMAND_HEADER + 4 * nParams;
+}
+
+/**
+  * Gets the length of a binary reply or logger record.
+  * @param frame Received bytes, starting with BINARY_MARKER.
+  * @param length Number of received bytes.
+  * @return Length of the reply or record, 0 if not enough bytes were received to know it,
+  *         or -1 if it has more than BINARY_MAX_VALUES values (i.e. it is corrupt).
+  */
+int abb_comm::binaryFrameLength(const char *frame, int length)
+{
+  if (length < BINARY_RECORD_HEADER)
+    return 0;
+  int nValues = ((const unsigned char *)frame)[4];
+  if (nValues > BINARY_MAX_VALUES)
+    return -1;
+  int frameLength = BINARY_RECORD_HEADER + 4 * nValues;
+  if (length < frameLength)
+    return 0;
+  return frameLength;
+}
+
+/**
+  * Parser for binary replies and logger records.
+  * @param frame Whole reply or record (see binaryFrameLength()).
+  * @param code Placer for the instruction code of a reply, or the type of a record. May be NULL.
+  * @param idCode Placer for the identification code. May be NULL.
+  * @param ok Placer for the result of the command. May be NULL.
+  * @param time Placer for the time stamp. May be NULL.
+  * @param values Placer for the values.
+  * @param maxValues Maximum number of values to read.
+  * @return Number of values in the reply or record.
+  */
+int abb_comm::decodeRecord(const char *frame, int *code, int *idCode, int *ok, double *time,
+    double *values, int maxValues)
+{
+  const unsigned char *bytes = (const unsigned char *)frame;
+  int nValues = bytes[4];
+
+  if (code)
+    *code = bytes[1];
+  if (idCode)
+    *idCode = bytes[2] | (bytes[3] << 8);
+  if (ok)
+    *ok = bytes[5];
+
+  for (int i = -1; i < nValues && i < maxValues; i++)
+  {
+    const unsigned char *p = bytes + BINARY_RECORD_HEADER + 4 * i;
+    unsigned int word = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+    float value;
+    memcpy(&value, &word, 4);
+    if (i == -1)
+    {
+      if (time)
+        *time = value;
+    }
+    else
+      values[i] = value;
+  }
+  return nValues;
+}
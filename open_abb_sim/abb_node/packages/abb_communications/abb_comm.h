@@ -5,9 +5,23 @@
 #include <string>
 #include "math.h"
 #include <cstdio>
+#include <cstring>
 
 using namespace std;
 
+// Binary protocol. Frames start with BINARY_MARKER, and hold little-endian
+// 4 byte floats, so that no text is formatted or parsed:
+// - Commands: marker, instruction code (1 byte), identification code
+//   (2 bytes), number of parameters (1 byte), 3 reserved bytes, parameters.
+// - Replies and logger records: marker, instruction code or record type
+//   (1 byte), identification code (2 bytes), number of values (1 byte),
+//   ok (1 byte), 2 reserved bytes, time stamp, values.
+#define BINARY_MARKER 0xAB
+#define BINARY_COMMAND_HEADER 8
+#define BINARY_RECORD_HEADER 12
+#define BINARY_MAX_VALUES 10
+#define BINARY_MAX_LENGTH (BINARY_RECORD_HEADER + 4 * BINARY_MAX_VALUES)
+
 /** \class namespace
     \brief ABB server interpreter.
     Collection of methods to format and parse messages between PC and server running in ABB controller.   
@@ -26,10 +40,26 @@ namespace abb_comm
   string specialCommand(int command, double param1, double param2, double param3, double param4, double param5, int idCode=0);
   string setVacuum(int vacuum=0, int idCode=0);
   string setDIO(int dio_number=0, int dio_state=0, int idCode=0);
+  string addBuffer(double x, double y, double z, double q0, double qx, double qy, double qz, int idCode=0);
+  string clearBuffer(int idCode=0);
+  string getBufferSize(int idCode=0);
+  string executeBuffer(int idCode=0);
+  string addJointsBuffer(double joint1, double joint2, double joint3, double joint4, double joint5, double joint6, int idCode=0);
+  string addJointsBufferTimed(double joint1, double joint2, double joint3, double joint4, double joint5, double joint6, double time, int idCode=0);
+  string clearJointsBuffer(int idCode=0);
+  string getJointsBufferSize(int idCode=0);
+  string executeJointsBuffer(int idCode=0);
+  string setLoggerFormat(bool binary, int idCode=0);
   string closeConnection(int idCode=0);
   int parseCartesian(string msg, double *x, double *y, double *z,
       double *q0, double *qx, double *qy, double *qz);
   int parseJoints(string msg, double *joint1, double *joint2, 
       double *joint3, double *joint4, double *joint5, double *joint6);  
+  int parseBufferSize(string msg, int *size);
+
+  int encodeCommand(char *frame, int instructionCode, const double *params, int nParams, int idCode=0);
+  int binaryFrameLength(const char *frame, int length);
+  int decodeRecord(const char *frame, int *code, int *idCode, int *ok, double *time,
+      double *values, int maxValues);
 }
 #endif
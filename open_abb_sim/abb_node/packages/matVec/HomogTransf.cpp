@@ -4,6 +4,7 @@
 #include "Mat.h"
 #include "RotMat.h"
 #include "HomogTransf.h"
+#include "MatKernels.h"
 
 HomogTransf::HomogTransf() : Mat(0.0,4,4)
 {
@@ -45,7 +46,12 @@ HomogTransf & HomogTransf::operator*=(const double constant){return(*this=HomogT
 HomogTransf & HomogTransf::operator/=(const double constant){return(*this=HomogTransf((Mat)*this/=constant));}
 HomogTransf HomogTransf::operator +(const HomogTransf &original)const {return (HomogTransf((Mat)*this+(Mat)original));}
 HomogTransf HomogTransf::operator -(const HomogTransf &original)const {return (HomogTransf((Mat)*this-(Mat)original));}
-HomogTransf HomogTransf::operator *(const HomogTransf &original)const {return (HomogTransf((Mat)*this*(Mat)original));}
+HomogTransf HomogTransf::operator *(const HomogTransf &original)const
+{
+	HomogTransf w;
+	matKernels::homogMul(v[0],original.v[0],w.v[0]);
+	return w;
+}
 HomogTransf HomogTransf::operator *(const double constant)const {return (HomogTransf((Mat)*this*constant));}
 HomogTransf HomogTransf::operator /(const double constant)const {return (HomogTransf((Mat)*this/constant));}
 
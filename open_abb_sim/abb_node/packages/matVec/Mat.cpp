@@ -1,9 +1,14 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "Vec.h"
 #include "Mat.h"
+#include "MatKernels.h"
+
+// Row permutations of matrices up to this size are kept on the stack
+#define MAX_STACK_ROWS 16
 
 
 /** \brief Default constructor.
@@ -33,7 +38,7 @@ Mat::Mat(const int n, const int m)
 		nn = n;
 		mm = m;
 		v = new double*[n];
-		v[0] = new double[m*n];
+		v[0] = matKernels::allocate(m*n);
 		for (int i=1; i<n; i++)
 			v[i] = v[i-1] + m;
 	}
@@ -57,7 +62,7 @@ Mat::Mat(const double constant, const int n, const int m)
 		nn = n;
 		mm = m;
 		v = new double*[n];
-		v[0] = new double[m*n];
+		v[0] = matKernels::allocate(m*n);
 		for (i=1; i<n; i++)
 			v[i] = v[i-1] + m;
 		for (i=0; i<n; i++)
@@ -84,7 +89,7 @@ Mat::Mat(double const * values, const int n, const int m)
 		nn = n;
 		mm = m;
 		v = new double*[n];
-		v[0] = new double[m*n];
+		v[0] = matKernels::allocate(m*n);
 		for (i=1; i<n; i++)
 			v[i] = v[i-1] + m;
 		for (i=0; i<n; i++)
@@ -117,7 +122,7 @@ Mat::Mat(char const * string, const int n, const int m)
 		nn = n;
 		mm = m;
 		v = new double*[n];
-		v[0] = new double[m*n];
+		v[0] = matKernels::allocate(m*n);
 		for (i=1;i<n;i++)
 			v[i] = v[i-1] + m;
 
@@ -185,7 +190,7 @@ Mat::Mat(const Mat &origin_matrix)
 	nn=origin_matrix.nn;
 	mm=origin_matrix.mm;
 	v=new double*[nn];
-	v[0] = new double[mm*nn];
+	v[0] = matKernels::allocate(mm*nn);
 	int i,j;
 	for (i=1; i<nn; i++)
 		v[i] = v[i-1] + mm;
@@ -201,7 +206,7 @@ Mat::Mat(const Mat &origin_matrix)
 Mat::~Mat()
 {
 	if (v != 0) {
-		delete[] (v[0]);
+		matKernels::release(v[0]);
 		delete[] (v);
 	}
 }
@@ -242,13 +247,13 @@ Mat& Mat::operator =(const Mat &original)
 		{
 			if (v != 0) 
 			{
-				delete[] (v[0]);
+				matKernels::release(v[0]);
 				delete[] (v);
 			}
 			nn = original.nn;
 			mm = original.mm;
 			v = new double*[nn];
-			v[0] = new double[mm*nn];
+			v[0] = matKernels::allocate(mm*nn);
 			for (i=1; i<nn; i++)
 				v[i] = v[i-1] + mm;
 		}
@@ -425,12 +430,8 @@ Mat Mat::operator*(const Mat &original) const
 {
 	if (mm == original.nn)
 	{
-		Mat w(0.0,nn,original.mm);
-		int i,j,k;
-		for (i=0; i<w.nn; i++)
-			for (j=0; j<w.mm; j++)
-				for (k=0; k<mm; k++) 
-					w[i][j] += v[i][k]*original[k][j];
+		Mat w(nn,original.mm);
+		matKernels::gemm(v[0],original.v[0],w.v[0],nn,mm,original.mm);
 		return w;
 	}
 	else
@@ -455,11 +456,8 @@ Vec Mat::operator*(const Vec &original) const
 
 	if (mm == original.nn)
 	{
-		w = Vec(0.0,nn);
-		int i,j;
-		for(i=0;i<nn;i++)
-			for(j=0;j<mm;j++)
-				w[i]+=v[i][j]*original[j]; 
+		w = Vec(nn);
+		matKernels::gemv(v[0],original.v,w.v,nn,mm);
 	}
 	return w;
 }
@@ -543,61 +541,18 @@ std::ostream& operator<<(std::ostream &os, const Mat &orig)
 
 Mat Mat::LDU(Vec &permutations, int &sign) const
 {	
-	int i,j,k,l,m,pivot;
-	double max_pivot, aux;
-	permutations= Vec(nn);
-	for(i=0;i<nn;i++)
-		permutations[i]=i;
+	int permBuffer[MAX_STACK_ROWS];
+	int *perm = (nn <= MAX_STACK_ROWS) ? permBuffer : new int[nn];
 	Mat w(*this);
 	
-	//We begin the loop
-	sign=1;
-	for(i=0;i<nn-1;i++)
-	{
-		//First we look for the maximum pivoting element in the given column
-		max_pivot=fabs(w[i][i]);
-		pivot=i;
-		for(k=i+1;k<nn;k++)
-		{
-			if(fabs(w[k][i])>max_pivot)
-			{
-				max_pivot=fabs(w[k][i]);
-				pivot=k;
-			}
-		}
-		
-		//If we have found a greater pivote that the original we make the permutation
-		if(pivot!=i)
-		{
-			sign=sign*(-1);
-			//We have to interchange rows i and pivot of matrix A
-			for(j=0; j<mm; j++)
-			{
-				aux = w[i][j];
-				w[i][j]=w[pivot][j];
-				w[pivot][j]=aux;
-			}
-			//Interchange the indexes in the permutation vector
-			m=(int)permutations[pivot];
-			permutations[pivot]=permutations[i];
-			permutations[i]=m;
-		}
-		//We operate in order to make column i of matrix U to have zeros below the diagonal. 
-		//Besides we compute the elements of matrix L and store them in the same matrix A. 
-		if(w[i][i]==0)
-			break;
-		else
-		{
-			for(l=i+1;l<nn;l++)
-			{
-				w[l][i]=w[l][i]/w[i][i];
-				for(j=i+1;j<mm;j++)
-				{
-					w[l][j]=w[l][j] - w[l][i]*w[i][j];
-				}
-			}
-		}
-	}
+	//The factors of L, D and U are computed in place
+	sign=matKernels::lu(w.v[0],nn,mm,perm);
+	permutations= Vec(nn);
+	for(int i=0;i<nn;i++)
+		permutations[i]=perm[i];
+
+	if (perm != permBuffer)
+		delete[] perm;
 	return w;
 }
 
@@ -640,33 +595,17 @@ Vec Mat::LDUsolve(const Vec &b) const
 	Vec x;
 	if((nn==mm)&&(nn==b.nn))
 	{
-		int i,j;
-		Mat L,D,U,P;
-		LDU(L,D,U,P);
-		Vec b2=P*b;
-		
-		x=Vec(0.0,mm);
-		Vec y(0.0,nn);
-		
-		y[0] = b2[0];
-		for (i = 1 ; i < nn ; i++)
-		{
-			y[i] = b2[i];
-			for(j = 0 ; j < i ; j++)
-				y[i] = y[i] - L[i][j]*y[j];
-		}
-		
-		for(i=0;i<nn;i++)
-			y[i]=y[i]/D[i][i];
-		
-		x[nn-1] = y[nn-1]/U[nn-1][nn-1];
-		for (i = nn-2 ; i >= 0 ; i--)
-		{
-			x[i] = y[i];
-			for(j = i + 1 ; j < nn ; j++)
-				x[i] = x[i] - U[i][j]*x[j];
-			x[i] = x[i]/U[i][i];
-		}
+		//Solve directly from the packed decomposition, without forming L, D, U and P
+		int permBuffer[MAX_STACK_ROWS];
+		int *perm = (nn <= MAX_STACK_ROWS) ? permBuffer : new int[nn];
+		Mat w(*this);
+		matKernels::lu(w.v[0],nn,mm,perm);
+
+		x=Vec(mm);
+		matKernels::luSolve(w.v[0],perm,nn,b.v,x.v);
+
+		if (perm != permBuffer)
+			delete[] perm;
 	}
 	return x;
 }
@@ -710,20 +649,26 @@ Mat Mat::LDUinverse() const
 	Mat w(nn,mm);
 	if(nn==mm)
 	{
-		Mat L, D, U, P;
-		LDU(L,D,U,P);
+		//Decompose once, and solve for every column of the identity
+		int permBuffer[MAX_STACK_ROWS];
+		int *perm = (nn <= MAX_STACK_ROWS) ? permBuffer : new int[nn];
+		Mat lu(*this);
+		matKernels::lu(lu.v[0],nn,mm,perm);
 
 		int i,j;
-		Vec aux;
+		Vec aux(mm);
 		Vec b(0.0,mm);
 		for(j=0;j<mm;j++)
 		{
 			b[j]=1;
-			aux=LDUsolve(L,D,U,P,b);
+			matKernels::luSolve(lu.v[0],perm,nn,b.v,aux.v);
 			for(i=0;i<nn;i++)
 				w[i][j]=aux[i];
 			b[j]=0.0;
 		}
+
+		if (perm != permBuffer)
+			delete[] perm;
 	}
 	return(w);
 }
@@ -902,6 +847,7 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
     int flag, i, its, j, jj, k, l, nm;
     double c, f, h, s, x, y, z;
     double anorm = 0.0, g = 0.0, scale = 0.0;
+    double rv1Buffer[MAX_STACK_ROWS];
     double *rv1;
     if (nn < mm) 
     {
@@ -909,11 +855,17 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
         return(0);
     }
   
-    U = Mat(*this);
-    sigma = Vec(0.0,mm);
-    V = Mat(0.0,mm,mm);
-
-    rv1 = (double *)malloc((unsigned int) mm*sizeof(double));
+    // The outputs are only reallocated if they have the wrong size, so
+    // that repeated decompositions reuse them
+    U = *this;
+    if (sigma.nn != mm)
+        sigma = Vec(mm);
+    sigma = 0.0;
+    if (V.nn != mm || V.mm != mm)
+        V = Mat(mm,mm);
+    V = 0.0;
+
+    rv1 = (mm <= MAX_STACK_ROWS) ? rv1Buffer : matKernels::allocate(mm);
     l=0;
 /* Householder reduction to bidiagonal form */
     for (i = 0; i < mm; i++) 
@@ -930,13 +882,14 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
             {
                 for (k = i; k < nn; k++) 
                 {
-                    U[k][i] = (float)((double)U[k][i]/scale);
+                    U[k][i] = ((double)U[k][i]/scale);
                     s += ((double)U[k][i] * (double)U[k][i]);
                 }
                 f = (double)U[i][i];
-		g = -SIGN(f)*sqrt(s);
+		/* SIGN() is 0 for 0, but a zero pivot must still reflect */
+		g = -(f >= 0.0 ? 1.0 : -1.0)*sqrt(s);
                 h = f * g - s;
-                U[i][i] = (float)(f - g);
+                U[i][i] = (f - g);
                 if (i != mm - 1) 
                 {
                     for (j = l; j < mm; j++) 
@@ -945,14 +898,14 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                             s += ((double)U[k][i] * (double)U[k][j]);
                         f = s / h;
                         for (k = i; k < nn; k++) 
-                            U[k][j] += (float)(f * (double)U[k][i]);
+                            U[k][j] += (f * (double)U[k][i]);
                     }
                 }
                 for (k = i; k < nn; k++) 
-                    U[k][i] = (float)((double)U[k][i]*scale);
+                    U[k][i] = ((double)U[k][i]*scale);
             }
         }
-        sigma[i] = (float)(scale * g);
+        sigma[i] = (scale * g);
     
         /* right-hand reduction */
         g = s = scale = 0.0;
@@ -964,13 +917,13 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
             {
                 for (k = l; k < mm; k++) 
                 {
-                    U[i][k] = (float)((double)U[i][k]/scale);
+                    U[i][k] = ((double)U[i][k]/scale);
                     s += ((double)U[i][k] * (double)U[i][k]);
                 }
                 f = (double)U[i][l];
-                g = -SIGN(f)*sqrt(s);
+                g = -(f >= 0.0 ? 1.0 : -1.0)*sqrt(s);
                 h = f * g - s;
-                U[i][l] = (float)(f - g);
+                U[i][l] = (f - g);
                 for (k = l; k < mm; k++) 
                     rv1[k] = (double)U[i][k] / h;
                 if (i != nn - 1) 
@@ -980,11 +933,11 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                         for (s = 0.0, k = l; k < mm; k++) 
                             s += ((double)U[j][k] * (double)U[i][k]);
                         for (k = l; k < mm; k++) 
-                            U[j][k] += (float)(s * rv1[k]);
+                            U[j][k] += (s * rv1[k]);
                     }
                 }
                 for (k = l; k < mm; k++) 
-                    U[i][k] = (float)((double)U[i][k]*scale);
+                    U[i][k] = ((double)U[i][k]*scale);
             }
         }
         anorm = MAX(anorm, (fabs((double)sigma[i]) + fabs(rv1[i])));
@@ -998,14 +951,14 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
             if (g) 
             {
                 for (j = l; j < mm; j++)
-                    V[j][i] = (float)(((double)U[i][j] / (double)U[i][l]) / g);
+                    V[j][i] = (((double)U[i][j] / (double)U[i][l]) / g);
                     /* double division to avoid underflow */
                 for (j = l; j < mm; j++) 
                 {
                     for (s = 0.0, k = l; k < mm; k++) 
                         s += ((double)U[i][k] * (double)V[k][j]);
                     for (k = l; k < mm; k++) 
-                        V[k][j] += (float)(s * (double)V[k][i]);
+                        V[k][j] += (s * (double)V[k][i]);
                 }
             }
             for (j = l; j < mm; j++) 
@@ -1035,11 +988,11 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                         s += ((double)U[k][i] * (double)U[k][j]);
                     f = (s / (double)U[i][i]) * g;
                     for (k = i; k < nn; k++) 
-                        U[k][j] += (float)(f * (double)U[k][i]);
+                        U[k][j] += (f * (double)U[k][i]);
                 }
             }
             for (j = i; j < nn; j++) 
-                U[j][i] = (float)((double)U[j][i]*g);
+                U[j][i] = ((double)U[j][i]*g);
         }
         else 
         {
@@ -1077,7 +1030,7 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                     {
                         g = (double)sigma[i];
                         h = PYTHAG(f, g);
-                        sigma[i] = (float)h; 
+                        sigma[i] = h; 
                         h = 1.0 / h;
                         c = g * h;
                         s = (- f * h);
@@ -1085,8 +1038,8 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                         {
                             y = (double)U[j][nm];
                             z = (double)U[j][i];
-                            U[j][nm] = (float)(y * c + z * s);
-                            U[j][i] = (float)(z * c - y * s);
+                            U[j][nm] = (y * c + z * s);
+                            U[j][i] = (z * c - y * s);
                         }
                     }
                 }
@@ -1096,14 +1049,14 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
             {                  /* convergence */
                 if (z < 0.0) 
                 {              /* make singular value nommegative */
-                    sigma[k] = (float)(-z);
+                    sigma[k] = (-z);
                     for (j = 0; j < mm; j++) 
                         V[j][k] = (-V[j][k]);
                 }
                 break;
             }
             if (its >= 30) {
-                free((void*) rv1);
+                if (rv1 != rv1Buffer) matKernels::release(rv1);
                 fprintf(stderr, "No convergence after 30,000! iterations \n");
                 return(0);
             }
@@ -1116,7 +1069,7 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
             h = rv1[k];
             f = ((y - z) * (y + z) + (g - h) * (g + h)) / (2.0 * h * y);
             g = PYTHAG(f, 1.0);
-            f = ((x - z) * (x + z) + h * ((y / (f + SIGN(f)*fabs(g))) - h)) / x;
+            f = ((x - z) * (x + z) + h * ((y / (f + (f >= 0.0 ? fabs(g) : -fabs(g)))) - h)) / x;
           
             /* next QR transformation */
             c = s = 1.0;
@@ -1139,11 +1092,11 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                 {
                     x = (double)V[jj][j];
                     z = (double)V[jj][i];
-                    V[jj][j] = (float)(x * c + z * s);
-                    V[jj][i] = (float)(z * c - x * s);
+                    V[jj][j] = (x * c + z * s);
+                    V[jj][i] = (z * c - x * s);
                 }
                 z = PYTHAG(f, h);
-                sigma[j] = (float)z;
+                sigma[j] = z;
                 if (z) 
                 {
                     z = 1.0 / z;
@@ -1156,15 +1109,15 @@ int Mat::SVD(Mat &U, Vec &sigma, Mat &V) const
                 {
                     y = (double)U[jj][j];
                     z = (double)U[jj][i];
-                    U[jj][j] = (float)(y * c + z * s);
-                    U[jj][i] = (float)(z * c - y * s);
+                    U[jj][j] = (y * c + z * s);
+                    U[jj][i] = (z * c - y * s);
                 }
             }
             rv1[l] = 0.0;
             rv1[k] = f;
-            sigma[k] = (float)x;
+            sigma[k] = x;
         }
     }
-    free((void*) rv1);
+    if (rv1 != rv1Buffer) matKernels::release(rv1);
     return(1);
 }
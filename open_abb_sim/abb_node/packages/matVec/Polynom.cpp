@@ -23,6 +23,17 @@ int Polynom::degree() const
 	return(nn-1);
 }
 
+Polynom Polynom::derivative() const
+{
+	if(nn<2)
+		return Polynom(0.0,0);
+	Polynom w(degree()-1);
+	int i;
+	for(i=1;i<nn;i++)
+		w[i-1]=i*v[i];
+	return w;
+}
+
 Polynom & Polynom::operator =(const double constant){return(*this=Polynom((Vec)*this=constant));}
 Polynom Polynom::operator -() const {return(Polynom(-(Vec)*this));}
 Polynom Polynom::operator *(const double constant){return (Polynom((Vec)*this*constant));}
@@ -88,7 +99,7 @@ Polynom Polynom::operator *(const Polynom &original)
 	return w;
 }
 
-double Polynom::operator()(const double x)
+double Polynom::operator()(const double x) const
 {
 	int i;
 	double w=v[0];
@@ -131,3 +142,19 @@ void Polynom::interpolate(const Vec &x, const Vec &y, const int n)
 	}
 } 
 
+void Polynom::quintic(const double T, const double p0, const double v0, const double a0,
+	const double p1, const double v1, const double a1)
+{
+	double h = p1 - p0;
+	double T2 = T*T;
+	double T3 = T2*T;
+
+	if(nn!=6)
+		*this=Polynom(5);
+	v[0]=p0;
+	v[1]=v0;
+	v[2]=a0/2.0;
+	v[3]=(20.0*h - (8.0*v1 + 12.0*v0)*T - (3.0*a0 - a1)*T2)/(2.0*T3);
+	v[4]=(-30.0*h + (14.0*v1 + 16.0*v0)*T + (3.0*a0 - 2.0*a1)*T2)/(2.0*T3*T);
+	v[5]=(12.0*h - 6.0*(v1 + v0)*T + (a1 - a0)*T2)/(2.0*T3*T2);
+}
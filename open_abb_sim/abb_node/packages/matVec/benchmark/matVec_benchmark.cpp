@@ -0,0 +1,403 @@
+//
+// matVec Benchmark
+//
+// Compares the matVec kernels with the scalar loops over row pointers that
+// Mat used before them (kept here as the reference), for the sizes of the
+// Jacobian and IK solves and for chains of homogeneous transforms. The
+// orientation steps of non-blocking moves compare QuatInterp with the
+// linear quaternion blend that the steps used before. The inverse, the SVD
+// and the rotation matrix of a quaternion are timed as they are.
+//
+
+#include <benchmark/benchmark.h>
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "matVec.h"
+#include "MatKernels.h"
+
+namespace reference
+{
+  // Row pointer access, as the previous loops did, without the bounds
+  // checks of operator[]
+
+  // The previous Mat::operator*(const Mat&)
+  void gemm(const Mat &a, const Mat &b, Mat &c)
+  {
+    for (int i = 0; i < c.nn; i++)
+      for (int j = 0; j < c.mm; j++)
+      {
+        c.v[i][j] = 0.0;
+        for (int k = 0; k < a.mm; k++)
+          c.v[i][j] += a.v[i][k] * b.v[k][j];
+      }
+  }
+
+  // The previous Mat::operator*(const Vec&)
+  void gemv(const Mat &a, const Vec &x, Vec &y)
+  {
+    for (int i = 0; i < a.nn; i++)
+    {
+      y.v[i] = 0.0;
+      for (int j = 0; j < a.mm; j++)
+        y.v[i] += a.v[i][j] * x.v[j];
+    }
+  }
+
+  // The previous Mat::LDU(Vec&, int&), on a copy of the matrix
+  int lu(Mat &w, Vec &permutations)
+  {
+    int sign = 1;
+    for (int i = 0; i < w.nn; i++)
+      permutations.v[i] = i;
+    for (int i = 0; i < w.nn - 1; i++)
+    {
+      double max_pivot = fabs(w.v[i][i]);
+      int pivot = i;
+      for (int k = i + 1; k < w.nn; k++)
+        if (fabs(w.v[k][i]) > max_pivot)
+        {
+          max_pivot = fabs(w.v[k][i]);
+          pivot = k;
+        }
+      if (pivot != i)
+      {
+        sign = -sign;
+        for (int j = 0; j < w.mm; j++)
+        {
+          double aux = w.v[i][j];
+          w.v[i][j] = w.v[pivot][j];
+          w.v[pivot][j] = aux;
+        }
+        double m = permutations.v[pivot];
+        permutations.v[pivot] = permutations.v[i];
+        permutations.v[i] = m;
+      }
+      if (w.v[i][i] == 0)
+        break;
+      for (int l = i + 1; l < w.nn; l++)
+      {
+        w.v[l][i] = w.v[l][i] / w.v[i][i];
+        for (int j = i + 1; j < w.mm; j++)
+          w.v[l][j] = w.v[l][j] - w.v[l][i] * w.v[i][j];
+      }
+    }
+    return sign;
+  }
+
+  // The previous HomogTransf::operator*, through Mat
+  void homogMul(const Mat &a, const Mat &b, Mat &c)
+  {
+    gemm(a, b, c);
+  }
+}
+
+static Mat randomMat(int n, int m)
+{
+  Mat a(n, m);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < m; j++)
+      a[i][j] = rand() / (double)RAND_MAX - 0.5 + (i == j ? n : 0.0);
+  return a;
+}
+
+static Vec randomVec(int n)
+{
+  Vec x(n);
+  for (int i = 0; i < n; i++)
+    x[i] = rand() / (double)RAND_MAX - 0.5;
+  return x;
+}
+
+// Six joint transforms, as in the forward kinematics of the arm
+static void randomChain(HomogTransf chain[6])
+{
+  for (int k = 0; k < 6; k++)
+  {
+    RotMat r;
+    r.rotZ(0.3 * k + 0.1);
+    Vec t(3);
+    t[0] = 0.1 * k; t[1] = 0.05; t[2] = 0.3;
+    chain[k] = HomogTransf(r, t);
+  }
+}
+
+static void BM_Gemm_Reference(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), b = randomMat(n, n), c(n, n);
+  for (auto _ : state)
+  {
+    reference::gemm(a, b, c);
+    benchmark::DoNotOptimize(c.v[0]);
+  }
+}
+BENCHMARK(BM_Gemm_Reference)->Arg(4)->Arg(6)->Arg(12)->Arg(32)->Arg(64);
+
+static void BM_Gemm_Kernel(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), b = randomMat(n, n), c(n, n);
+  for (auto _ : state)
+  {
+    matKernels::gemm(a.v[0], b.v[0], c.v[0], n, n, n);
+    benchmark::DoNotOptimize(c.v[0]);
+  }
+}
+BENCHMARK(BM_Gemm_Kernel)->Arg(4)->Arg(6)->Arg(12)->Arg(32)->Arg(64);
+
+// Mat::operator* includes the allocation of the result
+static void BM_Gemm_MatOperator(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), b = randomMat(n, n);
+  for (auto _ : state)
+  {
+    Mat c = a * b;
+    benchmark::DoNotOptimize(c.v[0]);
+  }
+}
+BENCHMARK(BM_Gemm_MatOperator)->Arg(4)->Arg(6)->Arg(12)->Arg(32)->Arg(64);
+
+static void BM_Gemv_Reference(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n);
+  Vec x = randomVec(n), y(n);
+  for (auto _ : state)
+  {
+    reference::gemv(a, x, y);
+    benchmark::DoNotOptimize(y.v);
+  }
+}
+BENCHMARK(BM_Gemv_Reference)->Arg(6)->Arg(12)->Arg(64);
+
+static void BM_Gemv_Kernel(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n);
+  Vec x = randomVec(n), y(n);
+  for (auto _ : state)
+  {
+    matKernels::gemv(a.v[0], x.v, y.v, n, n);
+    benchmark::DoNotOptimize(y.v);
+  }
+}
+BENCHMARK(BM_Gemv_Kernel)->Arg(6)->Arg(12)->Arg(64);
+
+static void BM_LU_Reference(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), w(n, n);
+  Vec perm(n);
+  for (auto _ : state)
+  {
+    w = a;
+    benchmark::DoNotOptimize(reference::lu(w, perm));
+  }
+}
+BENCHMARK(BM_LU_Reference)->Arg(6)->Arg(12)->Arg(64);
+
+static void BM_LU_Kernel(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), w(n, n);
+  int perm[64];
+  for (auto _ : state)
+  {
+    w = a;
+    benchmark::DoNotOptimize(matKernels::lu(w.v[0], n, n, perm));
+  }
+}
+BENCHMARK(BM_LU_Kernel)->Arg(6)->Arg(12)->Arg(64);
+
+// A 6x6 solve, as in one damped least squares IK iteration
+static void BM_Solve_LDUsolve(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n);
+  Vec b = randomVec(n);
+  for (auto _ : state)
+  {
+    Vec x = a.LDUsolve(b);
+    benchmark::DoNotOptimize(x.v);
+  }
+}
+BENCHMARK(BM_Solve_LDUsolve)->Arg(6)->Arg(12);
+
+static void BM_Inverse(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n);
+  for (auto _ : state)
+  {
+    Mat x = a.inv();
+    benchmark::DoNotOptimize(x.v[0]);
+  }
+}
+BENCHMARK(BM_Inverse)->Arg(6)->Arg(12);
+
+// The SVD of a 6x6 Jacobian, as for its condition number
+static void BM_SVD(benchmark::State &state)
+{
+  int n = state.range(0);
+  Mat a = randomMat(n, n), u(n, n), v(n, n);
+  Vec sigma(n);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(a.SVD(u, sigma, v));
+    benchmark::DoNotOptimize(sigma.v);
+  }
+}
+BENCHMARK(BM_SVD)->Arg(6)->Arg(12);
+
+static void BM_QuaternionRotMat(benchmark::State &state)
+{
+  double values[4] = {0.7084, 0.0003882, -0.0003882, 0.7058};
+  Quaternion q(values);
+  q.normalize();
+  for (auto _ : state)
+  {
+    RotMat r = q.getRotMat();
+    benchmark::DoNotOptimize(r.v[0]);
+  }
+}
+BENCHMARK(BM_QuaternionRotMat);
+
+static void BM_QuaternionRotMat_Fixed(benchmark::State &state)
+{
+  double values[4] = {0.7084, 0.0003882, -0.0003882, 0.7058};
+  FixedQuaternion q(values);
+  q.normalize();
+  for (auto _ : state)
+  {
+    FixedRotMat r = q.getRotMat();
+    benchmark::DoNotOptimize(r.v);
+  }
+}
+BENCHMARK(BM_QuaternionRotMat_Fixed);
+
+static void BM_HomogChain_Reference(benchmark::State &state)
+{
+  HomogTransf chain[6];
+  randomChain(chain);
+  Mat accum(4, 4), next(4, 4);
+  for (auto _ : state)
+  {
+    accum = chain[0];
+    for (int k = 1; k < 6; k++)
+    {
+      reference::homogMul(accum, chain[k], next);
+      accum = next;
+    }
+    benchmark::DoNotOptimize(accum.v[0]);
+  }
+}
+BENCHMARK(BM_HomogChain_Reference);
+
+static void BM_HomogChain_Kernel(benchmark::State &state)
+{
+  HomogTransf chain[6];
+  randomChain(chain);
+  double t[6 * 16], result[16];
+  for (int k = 0; k < 6; k++)
+    for (int i = 0; i < 16; i++)
+      t[16 * k + i] = chain[k].v[0][i];
+  for (auto _ : state)
+  {
+    matKernels::homogChain(t, 6, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_HomogChain_Kernel);
+
+static void BM_HomogChain_Operator(benchmark::State &state)
+{
+  HomogTransf chain[6];
+  randomChain(chain);
+  for (auto _ : state)
+  {
+    HomogTransf h = chain[0] * chain[1] * chain[2] * chain[3] * chain[4] * chain[5];
+    benchmark::DoNotOptimize(h.v[0]);
+  }
+}
+BENCHMARK(BM_HomogChain_Operator);
+
+static void BM_HomogChain_Fixed(benchmark::State &state)
+{
+  HomogTransf chain[6];
+  randomChain(chain);
+  FixedHomogTransf fixed[6];
+  for (int k = 0; k < 6; k++)
+    fixed[k] = FixedHomogTransf(chain[k]);
+  for (auto _ : state)
+  {
+    FixedHomogTransf h = fixed[0] * fixed[1] * fixed[2] * fixed[3] * fixed[4] * fixed[5];
+    benchmark::DoNotOptimize(h.v);
+  }
+}
+BENCHMARK(BM_HomogChain_Fixed);
+
+// Steps a 3 [rad] rotation as the non-blocking cartesian moves do, i.e.
+// recomputing the remaining rotation before every step of at most 0.05
+// [rad], and counts the steps it takes
+template <bool Slerp>
+static void orientSteps(benchmark::State &state)
+{
+  Vec3 axis;
+  axis[0] = 1.0; axis[1] = 2.0; axis[2] = 3.0;
+  axis.normalize();
+  FixedQuaternion target(cos(1.5), axis * sin(1.5));
+  const double orientStep = 0.05;
+  int steps = 0;
+  for (auto _ : state)
+  {
+    FixedQuaternion q;
+    steps = 0;
+    for (;;)
+    {
+      FixedQuaternion diffQ = q.conjugate() ^ target;
+      double rotMag = diffQ.getAngle();
+      steps++;
+      if (rotMag <= orientStep)
+        break;
+
+      FixedQuaternion incRot;
+      if (Slerp)
+        incRot = quatSlerp(FixedQuaternion(), diffQ, orientStep / rotMag);
+      else
+      {
+        // The previous blend from the unit quaternion
+        incRot = FixedQuaternion() + (diffQ - FixedQuaternion()) * orientStep / rotMag;
+        incRot /= incRot.norm();
+      }
+      q = q ^ incRot;
+    }
+    benchmark::DoNotOptimize(q.v);
+  }
+  state.counters["steps"] = steps;
+}
+
+static void BM_OrientSteps_Blend(benchmark::State &state)
+{
+  orientSteps<false>(state);
+}
+BENCHMARK(BM_OrientSteps_Blend);
+
+static void BM_OrientSteps_Slerp(benchmark::State &state)
+{
+  orientSteps<true>(state);
+}
+BENCHMARK(BM_OrientSteps_Slerp);
+
+int main(int argc, char **argv)
+{
+  benchmark::AddCustomContext("matVec kernels", matKernels::instructionSet());
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
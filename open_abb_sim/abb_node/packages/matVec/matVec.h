@@ -321,10 +321,18 @@ public:
 	Polynom & operator -=(const Polynom &original);
 	Polynom operator +(const Polynom &original); //Polynom Sum.
 	Polynom operator -(const Polynom &original); //Polynom Sum.
-	double operator()(const double x); //Evaluate Polynomial.
+	double operator()(const double x) const; //Evaluate Polynomial.
 	
 	int degree() const;
+	Polynom derivative() const;
 	void interpolate(const Vec &x, const Vec &y, const int n);
+	//Quintic on [0,T] with the given position, velocity and acceleration at both ends.
+	void quintic(const double T, const double p0, const double v0, const double a0,
+		const double p1, const double v1, const double a1);
 };
 
 #endif	// !defined(POLYNOM_INCLUDED)
+
+// Fixed-size classes
+#include "FixedMat.h"
+#include "QuatInterp.h"
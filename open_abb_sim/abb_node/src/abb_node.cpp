@@ -17,6 +17,11 @@
 RobotController::RobotController(ros::NodeHandle *n) 
 {
   node = n;
+  reportedMalformed = 0;
+  reportedDropped = 0;
+  wobjChanged = true;
+  wobjTfPeriod = DEFAULT_TF_WOBJ_PERIOD;
+  initLoggerMessages();
 }
 
 RobotController::~RobotController() {
@@ -36,17 +41,19 @@ RobotController::~RobotController() {
   handle_SetVacuum.shutdown();
   handle_SetDIO.shutdown();
   handle_SpecialCommand.shutdown();
+  handle_SetJointTrajectory.shutdown();
 
   // Shut down topics.
   handle_CartesianLog.shutdown();
   handle_JointsLog.shutdown();
   handle_ForceLog.shutdown();
 
-  //Close connections
+  //Close connections (the server does not reply to this command)
   char message[MAX_BUFFER];
   strcpy(message, abb_comm::closeConnection().c_str());
-  send(robotMotionSocket, message, strlen(message), 0);
+  motionChannel.sendNoReply(message, strlen(message));
   ros::Duration(1.0).sleep();
+  motionChannel.stop();
   close(robotMotionSocket);
   close(robotLoggerSocket);
 }
@@ -72,6 +79,10 @@ bool RobotController::init()
   {
     return false; 
   }
+  if(!motionChannel.start(robotMotionSocket))
+  {
+    return false;
+  }
 
   //Connect to Robot Logger server
   ROS_INFO("ROBOT_CONTROLLER: Connecting to the ABB logger server...");
@@ -83,14 +94,59 @@ bool RobotController::init()
         "Continuing without robot feedback.");
   }
 
+  //The work object transform is sent when it changes, and at this period
+  node->getParam("robot/tfWobjPeriod", wobjTfPeriod);
+  if (wobjTfPeriod <= 0.0)
+    wobjTfPeriod = DEFAULT_TF_WOBJ_PERIOD;
+
+  //Record the logger samples, if a telemetry file is configured. Put it on
+  //a tmpfs (e.g. /dev/shm) so that the samples never wait for the disk.
+  std::string telemetryFile;
+  int telemetryCapacity = DEFAULT_TELEMETRY_CAPACITY;
+  node->getParam("robot/telemetryFile", telemetryFile);
+  node->getParam("robot/telemetryCapacity", telemetryCapacity);
+  if (!telemetryFile.empty() && loggerConnected)
+  {
+    if (telemetryCapacity > 0 &&
+        telemetry.open(telemetryFile.c_str(), telemetryCapacity))
+      ROS_INFO("ROBOT_CONTROLLER: Recording the logger samples to %s.",
+          telemetryFile.c_str());
+    else
+      ROS_WARN("ROBOT_CONTROLLER: Not able to create the telemetry file %s: "
+          "%s. Continuing without recording.", telemetryFile.c_str(),
+          strerror(errno));
+  }
+
+  //Negotiate the binary protocol. Servers that do not support it refuse to
+  //switch the logger stream, and we continue with the text protocol.
+  binaryProtocol = false;
+  bool useBinaryProtocol = false;
+  node->getParam("robot/binaryProtocol", useBinaryProtocol);
+  if(useBinaryProtocol)
+  {
+    if(setLoggerFormat(true))
+      binaryProtocol = true;
+    else
+      ROS_INFO("ROBOT_CONTROLLER: The robot server does not support the "
+          "binary protocol. Continuing with the text protocol.");
+  }
+
   // Setup our non-blocking variables
+  nbBatchSteps = 1;
+  node->getParam("robot/nbBatchSteps", nbBatchSteps);
+  if (nbBatchSteps < 1)
+    nbBatchSteps = 1;
+  else if (nbBatchSteps > MAX_PATH_POINTS)
+    nbBatchSteps = MAX_PATH_POINTS;
   non_blocking = false;
   do_nb_move = false;
   targetChanged = false;
-  stopRequest = false;
-  stopConfirm = false;
+  nbBusy = false;
   changing_nb_speed = false;
 
+  // Limits of the joints for trajectories
+  loadJointLimits();
+
   // Allocate space for all of our vectors
   curToolP = Vec(3);
   curWorkP = Vec(3);
@@ -110,6 +166,61 @@ bool RobotController::init()
   return true;
 }
 
+// Read the position and velocity limits of the joints from the URDF in the
+// robot_description parameter (e.g. of a support package), where the joints
+// are named robot/urdfJointPrefix + "joint_1" to "joint_6". The URDF has no
+// acceleration limits, so they are all robot/trajMaxAcc.
+void RobotController::loadJointLimits()
+{
+  std::string prefix;
+  double maxAcc = DEFAULT_JOINT_LIMIT_ACC;
+  node->getParam("robot/urdfJointPrefix", prefix);
+  node->getParam("robot/trajMaxAcc", maxAcc);
+  trajSampleTime = DEFAULT_TRAJ_SAMPLE_TIME;
+  node->getParam("robot/trajSampleTime", trajSampleTime);
+  if (trajSampleTime <= 0.0)
+    trajSampleTime = DEFAULT_TRAJ_SAMPLE_TIME;
+
+  for (int i = 0; i < NUM_JOINTS; i++)
+  {
+    jointLimits[i].lower = -DEFAULT_JOINT_LIMIT_POS;
+    jointLimits[i].upper = DEFAULT_JOINT_LIMIT_POS;
+    jointLimits[i].velocity = DEFAULT_JOINT_LIMIT_VEL;
+    jointLimits[i].acceleration = maxAcc > 0.0 ? maxAcc : DEFAULT_JOINT_LIMIT_ACC;
+  }
+
+  std::string key, description;
+  urdf::Model model;
+  if (!node->searchParam("robot_description", key) || 
+      !node->getParam(key, description) || !model.initString(description))
+  {
+    ROS_WARN("ROBOT_CONTROLLER: No robot_description to read the joint "
+        "limits from. Using the default limits for trajectories.");
+    return;
+  }
+
+  for (int i = 0; i < NUM_JOINTS; i++)
+  {
+    char name[128];
+    snprintf(name, sizeof(name), "%sjoint_%d", prefix.c_str(), i + 1);
+    boost::shared_ptr<const urdf::Joint> joint = model.getJoint(name);
+    if (!joint || !joint->limits)
+    {
+      ROS_WARN("ROBOT_CONTROLLER: No limits for %s in the robot_description. "
+          "Using the default limits.", name);
+      continue;
+    }
+    if (joint->limits->upper > joint->limits->lower)
+    {
+      jointLimits[i].lower = joint->limits->lower;
+      jointLimits[i].upper = joint->limits->upper;
+    }
+    if (joint->limits->velocity > 0.0)
+      jointLimits[i].velocity = joint->limits->velocity;
+  }
+  ROS_INFO("ROBOT_CONTROLLER: Read the joint limits from the robot_description.");
+}
+
 // This function initializes the default configuration of the robot.
 // It sets the work object, tool, zone, speed, and vacuum based on
 // default parameters from the ROS parameter file
@@ -214,6 +325,8 @@ void RobotController::advertiseServices()
       &RobotController::robot_SetDIO, this);
   handle_IsMoving = node->advertiseService("IsMoving", 
       &RobotController::robot_IsMoving, this);
+  handle_SetJointTrajectory = node->advertiseService("SetJointTrajectory", 
+      &RobotController::robot_SetJointTrajectory, this);
 }
 
 
@@ -279,6 +392,7 @@ bool RobotController::robot_SetCartesian(
 
       // We are now ready to execute this non-blocking move
       do_nb_move = true;
+      pthread_cond_broadcast(&nonBlockCond);
     }
     else if (cart_move)
     {
@@ -302,6 +416,7 @@ bool RobotController::robot_SetCartesian(
       res.ret = 0;
       res.msg = "ROBOT_CONTROLLER: Can't do a cartesian move while doing a ";
       res.msg += "non-blocking joint move!";
+      pthread_mutex_unlock(&nonBlockMutex);
       return false;
     }
     pthread_mutex_unlock(&nonBlockMutex);
@@ -384,6 +499,7 @@ bool RobotController::robot_SetJoints(
 
       // Now that we have set everything up, execute the move
       do_nb_move = true;
+      pthread_cond_broadcast(&nonBlockCond);
     }
     else if (!cart_move)
     {
@@ -407,6 +523,7 @@ bool RobotController::robot_SetJoints(
       res.ret = 0;
       res.msg = "ROBOT_CONTROLLER: Can't do a joint move while doing a ";
       res.msg += "non-blocking cartesian move!";
+      pthread_mutex_unlock(&nonBlockMutex);
       return false;
     }
     pthread_mutex_unlock(&nonBlockMutex);
@@ -528,8 +645,10 @@ bool RobotController::robot_SetComm(
     if (!non_blocking)
     {
       // our mode is now non-blocking, but we are not yet executing a motion
+      pthread_mutex_lock(&nonBlockMutex);
       do_nb_move = false;
       non_blocking = true;
+      pthread_mutex_unlock(&nonBlockMutex);
 
       // Set up step sizes based on the current speed
       setNonBlockSpeed(curSpd[0], curSpd[1]);
@@ -545,7 +664,9 @@ bool RobotController::robot_SetComm(
     if (non_blocking)
     {
       stop_nb();
+      pthread_mutex_lock(&nonBlockMutex);
       non_blocking = false;
+      pthread_mutex_unlock(&nonBlockMutex);
     }
     res.ret = 1;
     res.msg = "ROBOT_CONTROLLER: Communication set to BLOCKING.";
@@ -753,6 +874,83 @@ bool RobotController::robot_IsMoving(
   return true;
 }
 
+// Plans a trajectory from the current position through the given joint
+// positions, as fast as the joint limits allow, and executes it on the
+// robot as a path of timed joint moves. The trajectory is sampled every
+// robot/trajSampleTime seconds, or slower so that it fits in the buffer of
+// the robot server. Joint trajectories are only done in blocking mode.
+bool RobotController::robot_SetJointTrajectory(
+    abb_node::robot_SetJointTrajectory::Request& req, 
+    abb_node::robot_SetJointTrajectory::Response& res)
+{
+  int numWaypoints = req.positions.size() / NUM_JOINTS;
+  if (numWaypoints < 1 || req.positions.size() % NUM_JOINTS != 0)
+  {
+    res.ret = 0;
+    res.msg = "ROBOT_CONTROLLER: The positions are not a list of joint ";
+    res.msg += "positions.";
+    return false;
+  }
+  if (non_blocking)
+  {
+    res.ret = 0;
+    res.msg = "ROBOT_CONTROLLER: Can't do a joint trajectory in ";
+    res.msg += "non-blocking mode!";
+    return false;
+  }
+
+  // The trajectory starts at the current position (in degrees)
+  std::vector<double> waypoints(NUM_JOINTS * (numWaypoints + 1));
+  if (!getJoints(waypoints[0], waypoints[1], waypoints[2], 
+        waypoints[3], waypoints[4], waypoints[5]))
+  {
+    res.ret = 0;
+    res.msg = "ROBOT_CONTROLLER: Not able to get Joint coordinates of ";
+    res.msg += "the robot.";
+    return false;
+  }
+  for (int i = 0; i < NUM_JOINTS; i++)
+    waypoints[i] *= DEG2RAD;
+  std::copy(req.positions.begin(), req.positions.end(), 
+      waypoints.begin() + NUM_JOINTS);
+
+  if (!trajectory.plan(&waypoints[0], numWaypoints + 1, NUM_JOINTS, 
+        jointLimits))
+  {
+    res.ret = 0;
+    res.msg = "ROBOT_CONTROLLER: The trajectory is outside of the joint ";
+    res.msg += "limits.";
+    return false;
+  }
+  res.duration = trajectory.duration();
+
+  if (res.duration > 0.0)
+  {
+    int numPoints = (int)ceil(res.duration / trajSampleTime);
+    if (numPoints < 1)
+      numPoints = 1;
+    else if (numPoints > MAX_PATH_POINTS)
+      numPoints = MAX_PATH_POINTS;
+    double dt = res.duration / numPoints;
+
+    std::vector<double> path(NUM_JOINTS * numPoints);
+    std::vector<double> durations(numPoints, dt);
+    for (int i = 0; i < numPoints; i++)
+      trajectory.sample((i + 1) * dt, &path[NUM_JOINTS * i]);
+
+    if (!setJointsPath(&path[0], numPoints, &durations[0]))
+    {
+      res.ret = 0;
+      res.msg = "ROBOT_CONTROLLER: Not able to execute the joint trajectory.";
+      return false;
+    }
+  }
+
+  res.ret = 1;
+  res.msg = "ROBOT_CONTROLLER: OK.";
+  return true;
+}
+
 bool RobotController::setNonBlockSpeed(double tcp, double ori)
 {
   pthread_mutex_lock(&nonBlockMutex);
@@ -804,10 +1002,24 @@ bool RobotController::ping()
 {
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
-  strcpy(message, abb_comm::pingRobot(randNumber).c_str());
+  int idCode = motionChannel.nextIdCode();
+  strcpy(message, abb_comm::pingRobot(idCode).c_str());
+
+  if(sendAndReceive(message, strlen(message), reply, idCode))
+    return true;
+  else
+    return false;
+}
+
+// Sets the format of the stream of the logger server
+bool RobotController::setLoggerFormat(bool binary)
+{
+  char message[MAX_BUFFER];
+  char reply[MAX_BUFFER];
+  int idCode = motionChannel.nextIdCode();
+  strcpy(message, abb_comm::setLoggerFormat(binary, idCode).c_str());
 
-  if(sendAndReceive(message, strlen(message), reply, randNumber))
+  if(sendAndReceive(message, strlen(message), reply, idCode))
     return true;
   else
     return false;
@@ -827,12 +1039,22 @@ bool RobotController::setCartesian(double x, double y, double z,
 
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+  int idCode = motionChannel.nextIdCode();
+  int length;
 
-  strcpy(message, abb_comm::setCartesian(x, y, z, q0, qx, qy, qz, 
-        randNumber).c_str());
+  if (binaryProtocol)
+  {
+    double params[7] = {x, y, z, q0, qx, qy, qz};
+    length = abb_comm::encodeCommand(message, 1, params, 7, idCode);
+  }
+  else
+  {
+    strcpy(message, abb_comm::setCartesian(x, y, z, q0, qx, qy, qz, 
+          idCode).c_str());
+    length = strlen(message);
+  }
 
-  if (sendAndReceive(message, strlen(message), reply, randNumber))
+  if (sendAndReceive(message, length, reply, idCode))
   {
     // If this was successful, keep track of the last commanded position
     curGoalP[0] = x;
@@ -854,13 +1076,36 @@ bool RobotController::getCartesian(double &x, double &y, double &z,
 {
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
-  strcpy(message, abb_comm::getCartesian(randNumber).c_str());
+  int idCode = motionChannel.nextIdCode();
+  int length;
+
+  if (binaryProtocol)
+    length = abb_comm::encodeCommand(message, 3, NULL, 0, idCode);
+  else
+  {
+    strcpy(message, abb_comm::getCartesian(idCode).c_str());
+    length = strlen(message);
+  }
   
-  if(sendAndReceive(message, strlen(message), reply, randNumber))
+  if(sendAndReceive(message, length, reply, idCode))
     {
       // Parse the reply to get the cartesian coordinates
-      abb_comm::parseCartesian(reply, &x, &y, &z, &q0, &qx, &qy, &qz);
+      if (binaryProtocol)
+      {
+        double values[7];
+        if (abb_comm::decodeRecord(reply, NULL, NULL, NULL, NULL, 
+              values, 7) < 7)
+          return false;
+        x = values[0];
+        y = values[1];
+        z = values[2];
+        q0 = values[3];
+        qx = values[4];
+        qy = values[5];
+        qz = values[6];
+      }
+      else
+        abb_comm::parseCartesian(reply, &x, &y, &z, &q0, &qx, &qy, &qz);
       return true;
     }
   else
@@ -876,18 +1121,30 @@ bool RobotController::setJoints(double position[])
 
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+  int idCode = motionChannel.nextIdCode();
+  int length;
 
   //ABB robots accept joint positions in degrees, so we convert from radians
-  strcpy(message, abb_comm::setJoints(position[0]*57.2957795, 
-				      position[1]*57.2957795,
-				      position[2]*57.2957795,
-				      position[3]*57.2957795,
-				      position[4]*57.2957795,
-				      position[5]*57.2957795,
-				      randNumber).c_str());
+  if (binaryProtocol)
+  {
+    double params[NUM_JOINTS];
+    for (int i=0; i < NUM_JOINTS; i++)
+      params[i] = position[i]*57.2957795;
+    length = abb_comm::encodeCommand(message, 2, params, NUM_JOINTS, idCode);
+  }
+  else
+  {
+    strcpy(message, abb_comm::setJoints(position[0]*57.2957795, 
+					position[1]*57.2957795,
+					position[2]*57.2957795,
+					position[3]*57.2957795,
+					position[4]*57.2957795,
+					position[5]*57.2957795,
+					idCode).c_str());
+    length = strlen(message);
+  }
   
-  if (sendAndReceive(message, strlen(message), reply, randNumber))
+  if (sendAndReceive(message, length, reply, idCode))
   {
     // If the move was successful, keep track of the last commanded position
     for (int i=0; i < NUM_JOINTS; i++)
@@ -906,19 +1163,180 @@ bool RobotController::getJoints(double &j1, double &j2, double &j3,
 {
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
-  strcpy(message, abb_comm::getJoints(randNumber).c_str());
+  int idCode = motionChannel.nextIdCode();
+  int length;
 
-  if(sendAndReceive(message, strlen(message), reply, randNumber))
+  if (binaryProtocol)
+    length = abb_comm::encodeCommand(message, 4, NULL, 0, idCode);
+  else
+  {
+    strcpy(message, abb_comm::getJoints(idCode).c_str());
+    length = strlen(message);
+  }
+
+  if(sendAndReceive(message, length, reply, idCode))
   {
     // Parse the reply to get the joint angles
-    abb_comm::parseJoints(reply, &j1, &j2, &j3, &j4, &j5, &j6);
+    if (binaryProtocol)
+    {
+      double values[NUM_JOINTS];
+      if (abb_comm::decodeRecord(reply, NULL, NULL, NULL, NULL, 
+            values, NUM_JOINTS) < NUM_JOINTS)
+        return false;
+      j1 = values[0];
+      j2 = values[1];
+      j3 = values[2];
+      j4 = values[3];
+      j5 = values[4];
+      j6 = values[5];
+    }
+    else
+      abb_comm::parseJoints(reply, &j1, &j2, &j3, &j4, &j5, &j6);
     return true;
   }
   else
     return false;
 }
 
+// Counts the targets of a path that the robot server did not accept. This
+// is called from the reader thread of the motion channel.
+static void countPathFailure(int result, const char *reply, void *arg)
+{
+  if (result != SERVER_OK)
+    (*(int*)arg)++;
+}
+
+// Upload a path to one of the buffers of the robot server, and execute it.
+// The targets are all sent at once, without waiting for the reply to each 
+// one, so the upload is not limited by the round-trip time. Joint targets
+// with a duration are reached in that time instead of at the current speed.
+bool RobotController::executePath(bool cartesian, const double targets[],
+    int numTargets, const double durations[])
+{
+  char message[MAX_BUFFER];
+  char reply[MAX_BUFFER];
+  int idCode;
+
+  if (numTargets < 1 || numTargets > MAX_PATH_POINTS)
+    return false;
+
+  // Clear the buffer
+  idCode = motionChannel.nextIdCode();
+  if (cartesian)
+    strcpy(message, abb_comm::clearBuffer(idCode).c_str());
+  else
+    strcpy(message, abb_comm::clearJointsBuffer(idCode).c_str());
+  if (!sendAndReceive(message, strlen(message), reply, idCode))
+    return false;
+
+  // Stream the targets
+  pathFailures = 0;
+  for (int i = 0; i < numTargets; i++)
+  {
+    int length;
+    idCode = motionChannel.nextIdCode();
+    if (cartesian)
+    {
+      const double *p = targets + 7 * i;
+      if (binaryProtocol)
+        length = abb_comm::encodeCommand(message, 30, p, 7, idCode);
+      else
+      {
+        strcpy(message, abb_comm::addBuffer(p[0], p[1], p[2], 
+              p[3], p[4], p[5], p[6], idCode).c_str());
+        length = strlen(message);
+      }
+    }
+    else
+    {
+      //ABB robots accept joint positions in degrees, so we convert from radians
+      double j[NUM_JOINTS];
+      for (int k = 0; k < NUM_JOINTS; k++)
+        j[k] = targets[NUM_JOINTS * i + k]*57.2957795;
+      if (binaryProtocol)
+      {
+        double params[NUM_JOINTS + 1];
+        memcpy(params, j, sizeof(j));
+        params[NUM_JOINTS] = durations ? durations[i] : 0.0;
+        length = abb_comm::encodeCommand(message, 37, params, 
+            durations ? NUM_JOINTS + 1 : NUM_JOINTS, idCode);
+      }
+      else if (durations)
+      {
+        strcpy(message, abb_comm::addJointsBufferTimed(j[0], j[1], j[2], 
+              j[3], j[4], j[5], durations[i], idCode).c_str());
+        length = strlen(message);
+      }
+      else
+      {
+        strcpy(message, abb_comm::addJointsBuffer(j[0], j[1], j[2], 
+              j[3], j[4], j[5], idCode).c_str());
+        length = strlen(message);
+      }
+    }
+    if (motionChannel.send(message, length, idCode, 
+          countPathFailure, &pathFailures) == -1)
+      break;
+  }
+
+  // The server replies in order, so once we have the size of the buffer 
+  // all the targets have been acknowledged
+  idCode = motionChannel.nextIdCode();
+  if (cartesian)
+    strcpy(message, abb_comm::getBufferSize(idCode).c_str());
+  else
+    strcpy(message, abb_comm::getJointsBufferSize(idCode).c_str());
+  if (!sendAndReceive(message, strlen(message), reply, idCode))
+    return false;
+
+  int bufferSize = 0;
+  abb_comm::parseBufferSize(reply, &bufferSize);
+  if (pathFailures > 0 || bufferSize != numTargets)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Only %d of %d path targets were buffered.",
+        bufferSize, numTargets);
+    return false;
+  }
+
+  // Execute the path
+  idCode = motionChannel.nextIdCode();
+  if (cartesian)
+    strcpy(message, abb_comm::executeBuffer(idCode).c_str());
+  else
+    strcpy(message, abb_comm::executeJointsBuffer(idCode).c_str());
+  if (!sendAndReceive(message, strlen(message), reply, idCode))
+    return false;
+
+  // If the move was successful, keep track of the last commanded position
+  const double *last = targets + (cartesian ? 7 : NUM_JOINTS) * (numTargets - 1);
+  if (cartesian)
+  {
+    for (int i = 0; i < 3; i++)
+      curGoalP[i] = last[i];
+    for (int i = 0; i < 4; i++)
+      curGoalQ[i] = last[3 + i];
+  }
+  else
+  {
+    for (int i = 0; i < NUM_JOINTS; i++)
+      curGoalJ[i] = last[i];
+  }
+  return true;
+}
+
+// Command the robot to move along a path of cartesian poses
+bool RobotController::setCartesianPath(const double poses[], int numPoses)
+{
+  return executePath(true, poses, numPoses);
+}
+
+// Command the robot to move along a path of joint positions
+bool RobotController::setJointsPath(const double positions[], int numPositions,
+    const double durations[])
+{
+  return executePath(false, positions, numPositions, durations);
+}
+
 // Stop the robot while it is in non_blocking mode
 bool RobotController::stop_nb()
 {
@@ -926,25 +1344,16 @@ bool RobotController::stop_nb()
   if (!non_blocking)
     return false;
 
-  // If the robot is currently not moving, we're done.
-  if (!do_nb_move)
-    return true;
-
-  ros::Rate stop_check(STOP_CHECK_FREQ);
-
-  // If we are currently non-blocking, get out of non-blocking move and wait
-  // to return until we're sure that the robot has stopped moving.
+  // Get out of the non-blocking move, and wake up the non-blocking thread
+  // if it is waiting for the robot to catch up
+  pthread_mutex_lock(&nonBlockMutex);
   do_nb_move = false;
+  pthread_cond_broadcast(&nonBlockCond);
 
-  // We wait for the non-blocking thread to set stopConfirm to 
-  // true after we set stopRequest to true
-  stopConfirm = false;
-  stopRequest = true;
-  while (!stopConfirm)
-  {
-    stop_check.sleep();
-  }
-  stopRequest = false; 
+  // Wait to return until we're sure that no step is being sent anymore
+  while (nbBusy)
+    pthread_cond_wait(&nonBlockCond, &nonBlockMutex);
+  pthread_mutex_unlock(&nonBlockMutex);
 
   return true;
 }
@@ -963,11 +1372,11 @@ bool RobotController::setTool(double x, double y, double z,
       
       char message[MAX_BUFFER];
       char reply[MAX_BUFFER];
-      int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+      int idCode = motionChannel.nextIdCode();
       strcpy(message, abb_comm::setTool(x, y, z, q0, qx, qy, qz, 
-					      randNumber).c_str());
+					      idCode).c_str());
 
-      if(sendAndReceive(message, strlen(message), reply, randNumber))
+      if(sendAndReceive(message, strlen(message), reply, idCode))
 	{
 	  // If the command was successful, remember our new tool frame
 	  curToolP[0] = x;
@@ -1007,11 +1416,11 @@ bool RobotController::setWorkObject(double x, double y, double z,
       
       char message[MAX_BUFFER];
       char reply[MAX_BUFFER];
-      int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+      int idCode = motionChannel.nextIdCode();
       strcpy(message, abb_comm::setWorkObject(x, y, z, q0, qx, qy, qz, 
-						    randNumber).c_str());
+						    idCode).c_str());
       
-      if(sendAndReceive(message, strlen(message), reply, randNumber))
+      if(sendAndReceive(message, strlen(message), reply, idCode))
 	{
 	  // If the command was successful, remember our new work object
 	  curWorkP[0] = x;
@@ -1027,6 +1436,7 @@ bool RobotController::setWorkObject(double x, double y, double z,
 	  pthread_mutex_lock(&wobjUpdateMutex);
 	  curWobjTransform.setOrigin(tf::Vector3(x*.001, y*.001, z*.001));
 	  curWobjTransform.setRotation(tf::Quaternion(qx, qy, qz, q0));
+	  wobjChanged = true;
 	  pthread_mutex_unlock(&wobjUpdateMutex);
 
 
@@ -1059,10 +1469,10 @@ bool RobotController::setSpeed(double tcp, double ori)
 
       char message[MAX_BUFFER];
       char reply[MAX_BUFFER];
-      int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+      int idCode = motionChannel.nextIdCode();
       strcpy(message, abb_comm::setSpeed(tcp, ori, 
-					       randNumber).c_str());
-      if(sendAndReceive(message, strlen(message), reply, randNumber))
+					       idCode).c_str());
+      if(sendAndReceive(message, strlen(message), reply, idCode))
 	{
 	  // If we successfully changed the speed, remember our new speed values
 	  curSpd[0] = tcp;
@@ -1090,7 +1500,7 @@ bool RobotController::setZone(int z)
       
       char message[MAX_BUFFER];
       char reply[MAX_BUFFER];
-      int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+      int idCode = motionChannel.nextIdCode();
       
       // Make sure the specified zone number exists
       if (z < 0 || z > NUM_ZONES)
@@ -1101,9 +1511,9 @@ bool RobotController::setZone(int z)
       
       strcpy(message, abb_comm::setZone((z == ZONE_FINE), 
 					      zone_data[z].p_tcp, zone_data[z].p_ori, zone_data[z].ori, 
-					      randNumber).c_str());
+					      idCode).c_str());
       
-      if(sendAndReceive(message, strlen(message), reply, randNumber))
+      if(sendAndReceive(message, strlen(message), reply, idCode))
 	{
 	  // If we set the zone successfully, remember our new zone
 	  curZone = z;
@@ -1122,10 +1532,10 @@ bool RobotController::specialCommand(int command, double param1, double param2,
 {
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
-  strcpy(message, abb_comm::specialCommand(command, param1, param2, param3, param4, param5, randNumber).c_str());
+  int idCode = motionChannel.nextIdCode();
+  strcpy(message, abb_comm::specialCommand(command, param1, param2, param3, param4, param5, idCode).c_str());
 
-  if(sendAndReceive(message, strlen(message), reply, randNumber))
+  if(sendAndReceive(message, strlen(message), reply, idCode))
     return true;
   else
     return false;
@@ -1139,7 +1549,7 @@ bool RobotController::setVacuum(int v)
     {
       char message[MAX_BUFFER];
       char reply[MAX_BUFFER];
-      int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
+      int idCode = motionChannel.nextIdCode();
       
       // Make sure we are either opening or closing the vacuum
       if((v != VACUUM_OPEN) && (v != VACUUM_CLOSE))
@@ -1149,9 +1559,9 @@ bool RobotController::setVacuum(int v)
 	  return false;
 	}
       
-      strcpy(message, abb_comm::setVacuum(v, randNumber).c_str());
+      strcpy(message, abb_comm::setVacuum(v, idCode).c_str());
       
-      if(sendAndReceive(message, strlen(message), reply, randNumber))
+      if(sendAndReceive(message, strlen(message), reply, idCode))
 	{
 	  // Remember the current state of the vacuum if the command sent
 	  curVacuum = v;
@@ -1170,9 +1580,9 @@ bool RobotController::setDIO(int dio_num, int dio_state)
 {
   char message[MAX_BUFFER];
   char reply[MAX_BUFFER];
-  int randNumber = (int)(ID_CODE_MAX*(double)rand()/(double)(RAND_MAX));
-  strcpy(message, abb_comm::setDIO(dio_num, dio_state, randNumber).c_str());
-  if(sendAndReceive(message, strlen(message), reply, randNumber))
+  int idCode = motionChannel.nextIdCode();
+  strcpy(message, abb_comm::setDIO(dio_num, dio_state, idCode).c_str());
+  if(sendAndReceive(message, strlen(message), reply, idCode))
     { return true; }
   else 
     { return false; }
@@ -1290,86 +1700,70 @@ bool RobotController::connectMotionServer(const char* ip, int port)
 
 // Helper function to send a command to the robot, 
 // wait for an answer and check for correctness.
+// The command goes through the motion channel, so commands issued from
+// other threads are sent while this one waits for its reply.
 bool RobotController::sendAndReceive(char *message, int messageLength, 
     char* reply, int idCode)
 {
-  pthread_mutex_lock(&sendRecvMutex);
-  if (send(robotMotionSocket, message, messageLength, 0) == -1)
+  int ticket = motionChannel.send(message, messageLength, idCode);
+  if (ticket == -1)
+    return false;
+
+  int ok = motionChannel.wait(ticket, reply);
+  if (ok == SERVER_OK)
+    return true;
+  else if (ok == SERVER_COLLISION)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Collision Detected.");
+  }
+  else if (ok == CHANNEL_ERROR)
   {
-    ROS_WARN("ROBOT_CONTROLLER: Failed to send command to ABB robot:"
-        " Error number %d.", errno);
+    ROS_WARN("ROBOT_CONTROLLER: Failed to receive answer from ABB robot.");
   }
   else
   {
-    // Read the reply to the message we just sent, and make sure
-    // it's not corrupt, and the command was executed successfully
-    int t;
-    if ((t=recv(robotMotionSocket, reply, MAX_BUFFER-1, 0)) > 0)
-    {
-      reply[t] = '\0';
-      int ok, rcvIdCode;
-      sscanf(reply,"%*d %d %d", &rcvIdCode, &ok);
-      if(idCode!=-1)
-      {  
-        if ((ok == SERVER_OK) && (rcvIdCode == idCode))
-        {
-          pthread_mutex_unlock(&sendRecvMutex);
-          return true;
-        }
-        else if ((ok == SERVER_COLLISION) && (rcvIdCode == idCode))
-        {
-          ROS_WARN("ROBOT_CONTROLLER: Collision Detected.");
-        }
-        else
-        {
-          ROS_WARN("ROBOT_CONTROLLER: Corrupt message.");
-          ROS_WARN("msg = %s, reply = %s, idCode = %d, ok = %d, rcvCode = %d", message, reply, idCode, ok, rcvIdCode);
-        }
-      }
-      else
-      {
-        if (ok == SERVER_OK)
-        {
-          pthread_mutex_unlock(&sendRecvMutex);
-          return true;
-        }
-        else if (ok == SERVER_COLLISION)
-        {
-          ROS_WARN("ROBOT_CONTROLLER: Collision Detected.");
-        }
-        else
-        {
-          ROS_WARN("ROBOT_CONTROLLER: Corrupt message.");
-          ROS_WARN("msg = %s, reply = %s, idCode = %d, ok = %d, rcvCode = %d", message, reply, idCode, ok, rcvIdCode);
-        }
-      }
-    }
+    ROS_WARN("ROBOT_CONTROLLER: Corrupt message.");
+    if ((unsigned char)message[0] == BINARY_MARKER)
+      ROS_WARN("binary msg, idCode = %d, ok = %d", idCode, ok);
     else
-      ROS_WARN("ROBOT_CONTROLLER: Failed to receive answer from ABB robot.");
+      ROS_WARN("msg = %s, reply = %s, idCode = %d, ok = %d", message, reply, idCode, ok);
   }
-
-  pthread_mutex_unlock(&sendRecvMutex);
   return false;
 }
 
 // Compute the distance between the current position and the goal
 double RobotController::posDistFromGoal()
 {
+  double pos_mag = 0;
   pthread_mutex_lock(&cartUpdateMutex);
-  double pos_mag = (curGoalP - curP).norm();
+  for (int i=0; i < 3; i++)
+    pos_mag += (curGoalP[i] - curP[i]) * (curGoalP[i] - curP[i]);
   pthread_mutex_unlock(&cartUpdateMutex);
-  return pos_mag;
+  return sqrt(pos_mag);
 }
 
-// Compute the distance between the current orientation and the goal
+// Compute the distance between the current orientation and the goal. This 
+// is the angle of curGoalQ^(curQ.inverse()), computed from the components
+// so that no temporary quaternions are needed.
 double RobotController::orientDistFromGoal()
 {
+  double dot = 0, goalNorm2 = 0, curNorm2 = 0;
   pthread_mutex_lock(&cartUpdateMutex);
-  //Quaternion diff = Quaternion("1 0 0 0") - (curGoalQ - curQ);
-  //diff /= diff.norm();
-  Quaternion diff = curGoalQ^(curQ.inverse());
+  for (int i=0; i < 4; i++)
+    {
+      dot += curGoalQ[i] * curQ[i];
+      goalNorm2 += curGoalQ[i] * curGoalQ[i];
+      curNorm2 += curQ[i] * curQ[i];
+    }
   pthread_mutex_unlock(&cartUpdateMutex);
-  double ang_mag = fabs(diff.getAngle());
+  if (curNorm2 == 0)
+    return 0;
+
+  double s = dot / curNorm2;
+  double v2 = goalNorm2 / curNorm2 - s * s;
+  double ang_mag = 2 * atan2(sqrt(v2 > 0 ? v2 : 0), s);
+  if (ang_mag > PI)
+    ang_mag = 2 * PI - ang_mag;
   return ang_mag;
 }
 
@@ -1387,217 +1781,252 @@ double RobotController::jointDistFromGoal()
   return sqrt(joint_mag);
 }
 
+// Wait until the robot is within the tracking distance of the last goal.
+// The logger signals every new position, and stop_nb() signals a stop.
+bool RobotController::waitForTracking(bool cartesian)
+{
+  while (do_nb_move && ros::ok())
+  {
+    if (cartesian)
+    {
+      if (posDistFromGoal() <= curDist[0] && orientDistFromGoal() <= curDist[1])
+        return true;
+    }
+    else if (jointDistFromGoal() <= curDist[2])
+      return true;
+    pthread_cond_wait(&nonBlockCond, &nonBlockMutex);
+  }
+  return false;
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
-// Log Call Back
+// Logger Reader
 //
-// This function communicates with the robot to see if any new position
-// or force information has been transmitted by tcp/ip. If any data has been
-// sent, it reads all of it, saves the newest of each message, and publishes
-// any new position, joint, or force information it gets. This function is
-// called every time there is a timer event.
+// This function waits for new position or force information to be 
+// transmitted by tcp/ip, and hands it to the logger parser. Records split
+// over several receives are kept in the parser until they are whole. Every
+// sample is recorded, but only the latest sample of each type received
+// together is published, since they would all get the same time stamp. It
+// returns false once the connection to the logger server is lost.
 //////////////////////////////////////////////////////////////////////////////
-void RobotController::logCallback(const ros::TimerEvent&)
+bool RobotController::readLogger(int timeout)
 {
+  // Wait for data, so that the thread can still notice a shut down
+  struct pollfd pfd;
+  pfd.fd = robotLoggerSocket;
+  pfd.events = POLLIN;
+  int ready = poll(&pfd, 1, timeout);
+  if (ready < 0)
+    return errno == EINTR;
+  if (ready == 0)
+    return true;
+
+  // Read all information from the tcp/ip socket
   int t;
-  int code;
-  char buffer[MAX_BUFFER];
-  char * partialBuffer;
-  bool cartesianModif = false;
-  bool jointsModif = false;
-  bool forceModif = false;
-
-  //I'd like to broadcast frames for abb_base -> abb_workobject -> abb_tcp
-  //Non-TCP transforms change way less often, but I guess
-  //the ROS way is to broadcast everything always...
-  tf::Transform transform;
-  
-  //Messages to be published
-  sensor_msgs::JointState msgJoints;
-  geometry_msgs::WrenchStamped msgForce;
-  geometry_msgs::PoseStamped msgCartesian;
+  int space;
+  char *buffer;
+  logger_sample latest[NUM_LOG_TYPES];
+  bool received[NUM_LOG_TYPES] = {false, false, false};
+  do
+  {
+    buffer = loggerParser.receiveBuffer(space);
+    if ((t = recv(robotLoggerSocket, buffer, space, 0)) > 0)
+    {
+      loggerParser.received(t);
+      logger_sample sample;
+      while (loggerParser.next(sample))
+      {
+        telemetry.append(sample);
+        latest[sample.type] = sample;
+        received[sample.type] = true;
+      }
+    }
+  } while (t == space);
 
+  for (int i = 0; i < NUM_LOG_TYPES; i++)
+  {
+    if (received[i])
+      publishSample(latest[i]);
+  }
+
+  if (t == 0 || (t < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Lost the connection to the ABB logger "
+        "server.");
+    return false;
+  }
+
+  if (loggerParser.malformed != reportedMalformed || 
+      loggerParser.dropped != reportedDropped)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Logger samples: %lu, malformed records: "
+        "%lu, dropped records: %lu.", loggerParser.samples, 
+        loggerParser.malformed, loggerParser.dropped);
+    reportedMalformed = loggerParser.malformed;
+    reportedDropped = loggerParser.dropped;
+  }
+  return true;
+}
+
+// Set up the messages published by the logger, once
+void RobotController::initLoggerMessages()
+{
   //Set the frame IDs on the messages 
   msgForce.header.frame_id = "abb_tcp";
   msgJoints.header.frame_id = "abb_base";
   msgCartesian.header.frame_id = "abb_workobject";
+  tcpTransform.frame_id_ = "abb_workobject";
+  tcpTransform.child_frame_id_ = "abb_tcp";
+  wobjTransform.frame_id_ = "abb_base";
+  wobjTransform.child_frame_id_ = "abb_workobject";
 
   //Joints has 6 positions, as the robot is 6 DOF
-  msgJoints.position.resize(6);
-  msgJoints.name.resize(6);
+  msgJoints.position.resize(NUM_JOINTS);
+  msgJoints.name.resize(NUM_JOINTS);
   msgJoints.name[0] = "joint1";
   msgJoints.name[1] = "joint2";
   msgJoints.name[2] = "joint3";
   msgJoints.name[3] = "joint4";
   msgJoints.name[4] = "joint5";
   msgJoints.name[5] = "joint6";
-  
+}
 
-  // Read all information from the tcp/ip socket
-  if ((t=recv(robotLoggerSocket, buffer, MAX_BUFFER-1, 0)) > 0)
+// Send the work object transform if it changed, or if its period is over.
+// Like a static transform publisher, it is stamped a period ahead, so that
+// the listeners can look up the tree up to the next time it is sent. The
+// sample sent for that period can not be taken back, so a change within it
+// is stamped right after it: it applies from the end of the period on,
+// instead of a lookup interpolating from the new work object back to the
+// old one.
+void RobotController::publishWobjTransform(const ros::Time &now)
+{
+  pthread_mutex_lock(&wobjUpdateMutex);
+  if (wobjChanged || now >= wobjNextPublish)
   {
-    // Add an end character to form our string
-    buffer[t] = '\0';
-    partialBuffer = buffer;
-
-    // Each message starts with a '#' character. Read messages one at a time
-    while((partialBuffer = strchr(partialBuffer,'#'))!=NULL)		
+    wobjTransform.setData(curWobjTransform);
+    if (now >= wobjNextPublish)
     {
-      // The number after the start character is the type of message
-      sscanf(partialBuffer,"# %d", &code);
-      switch(code)
+      wobjTransform.stamp_ = now + ros::Duration(wobjTfPeriod);
+      wobjNextPublish = wobjTransform.stamp_;
+    }
+    else
+    {
+      // tf ignores a sample with the same stamp as a cached one
+      wobjTransform.stamp_ += ros::Duration(0, 1);
+    }
+    wobjChanged = false;
+    handle_tf.sendTransform(wobjTransform);
+  }
+  pthread_mutex_unlock(&wobjUpdateMutex);
+}
+
+// Wake up the non-blocking thread if it is waiting for the robot to reach
+// its last goal
+void RobotController::signalFeedback()
+{
+  // Nobody waits when there is no move
+  if (do_nb_move)
+  {
+    pthread_mutex_lock(&nonBlockMutex);
+    pthread_cond_broadcast(&nonBlockCond);
+    pthread_mutex_unlock(&nonBlockMutex);
+  }
+}
+
+// Publish a sample from the logger, and save this data internally so it can
+// be used for other functions
+void RobotController::publishSample(const logger_sample &sample)
+{
+  ros::Time now = ros::Time::now();
+  switch(sample.type)
+  {
+    // Cartesian Message
+    case LOG_CARTESIAN:
       {
-        // Cartesian Message
-        case 0:
-          {
-            char date[MAX_BUFFER];
-            char time[MAX_BUFFER];
-            int nParams = sscanf(partialBuffer,"# %*d %s %s %*f %lf %lf %lf %lf %lf %lf %lf",
-				 date,
-				 time,
-				 //&msgCartesian.timeStamp,
-				 &msgCartesian.pose.position.x,
-				 &msgCartesian.pose.position.y,
-				 &msgCartesian.pose.position.z,
-				 &msgCartesian.pose.orientation.w,
-				 &msgCartesian.pose.orientation.x,
-				 &msgCartesian.pose.orientation.y,
-				 &msgCartesian.pose.orientation.z);
-            if(nParams == 9)
-            {
-              // If we read in the correct number of parameters, save this message
-	      //Convert distance units from mm to meters
-	      msgCartesian.pose.position.x *= .001;
-	      msgCartesian.pose.position.y *= .001;
-	      msgCartesian.pose.position.z *= .001;
-              cartesianModif = true;
-            }
-            break;
-          }
-
-        // Joint Message
-        case 1:
-          {
-            char date[MAX_BUFFER];
-            char time[MAX_BUFFER];
-            int nParams = sscanf(partialBuffer,"# %*d %s %s %*f %lf %lf %lf %lf %lf %lf",
-				 date,
-				 time,
-				 //&msgJoints.timeStamp,
-				 &msgJoints.position[0],
-				 &msgJoints.position[1],
-				 &msgJoints.position[2],
-				 &msgJoints.position[3],
-				 &msgJoints.position[4],
-				 &msgJoints.position[5] );
-            if (nParams == 8)  //9 with timestamp
-            {
-              // If we read in the correct number of parameters, save this message
-       	      for (uint i =0; i < msgJoints.position.size(); i++) 
-		{
-		  //Convert joint angles to radians
-		  msgJoints.position[i] *= 0.017453292;
-		}
-              jointsModif = true;
-            }
-            break;
-          }
-
-        // Force Message
-        case 2:
-          {
-            char date[MAX_BUFFER];
-            char time[MAX_BUFFER];
-            int nParams = sscanf(partialBuffer,"# %*d %s %s %*f %lf %lf %lf %lf %lf %lf",
-				 date,
-				 time,
-				 &msgForce.wrench.force.x,
-				 &msgForce.wrench.force.y,
-				 &msgForce.wrench.force.z,
-				 &msgForce.wrench.torque.x,
-				 &msgForce.wrench.torque.y,
-				 &msgForce.wrench.torque.z);
-	    if (nParams == 8) //9 with timestamp, which is ignored
-            {
-              // If we read in the correct number of parameters, save this message.
-              forceModif = true;
-            }
-            break;
-          }
+        //Convert distance units from mm to meters
+        msgCartesian.header.stamp = now;
+        msgCartesian.pose.position.x = sample.values[0] * .001;
+        msgCartesian.pose.position.y = sample.values[1] * .001;
+        msgCartesian.pose.position.z = sample.values[2] * .001;
+        msgCartesian.pose.orientation.w = sample.values[3];
+        msgCartesian.pose.orientation.x = sample.values[4];
+        msgCartesian.pose.orientation.y = sample.values[5];
+        msgCartesian.pose.orientation.z = sample.values[6];
+
+        //Broadcast the frames abb_base -> abb_workobject -> abb_tcp. Only
+        //the TCP moves with every sample.
+        tcpTransform.stamp_ = now;
+        tcpTransform.setOrigin(tf::Vector3(msgCartesian.pose.position.x, 
+              msgCartesian.pose.position.y, 
+              msgCartesian.pose.position.z) );
+        tcpTransform.setRotation(tf::Quaternion(msgCartesian.pose.orientation.x, 
+              msgCartesian.pose.orientation.y, 
+              msgCartesian.pose.orientation.z, 
+              msgCartesian.pose.orientation.w));
+        handle_tf.sendTransform(tcpTransform);
+        publishWobjTransform(now);
+
+        //Publish XYZ/Quaternion message
+        handle_CartesianLog.publish(msgCartesian);
+
+        pthread_mutex_lock(&cartUpdateMutex);
+        curP[0] = msgCartesian.pose.position.x;
+        curP[1] = msgCartesian.pose.position.y;
+        curP[2] = msgCartesian.pose.position.z;
+        curQ[0] = msgCartesian.pose.orientation.w;
+        curQ[1] = msgCartesian.pose.orientation.x;
+        curQ[2] = msgCartesian.pose.orientation.y;
+        curQ[3] = msgCartesian.pose.orientation.z;
+        pthread_mutex_unlock(&cartUpdateMutex); 
+        signalFeedback();
+        break;
       }
-      // Increment partialBuffer, so we don't look at the same message again
-      partialBuffer++;
-    }
 
-    // Now, only publish on a given topic if a new message was received.
-    // Also, save this data internally so it can be used for other functions
-    if(cartesianModif)
-    {
-      //update the TCP transform with message info
-      //Need to convert from mm(robot) -> m (tf standard)
-      transform.setOrigin(tf::Vector3(msgCartesian.pose.position.x, 
-				      msgCartesian.pose.position.y, 
-				      msgCartesian.pose.position.z) );
-      transform.setRotation(tf::Quaternion(msgCartesian.pose.orientation.x, 
-					   msgCartesian.pose.orientation.y, 
-					   msgCartesian.pose.orientation.z, 
-					   msgCartesian.pose.orientation.w));
-
-      handle_tf.sendTransform(tf::StampedTransform(transform, ros::Time::now(),"abb_workobject",  "abb_tcp"));
-
-      //Send the Work Object transform at the same time, so the tree abb_base -> abb_workobject -> abb_tcp is fully populated 
-      pthread_mutex_lock(&wobjUpdateMutex);
-      handle_tf.sendTransform(tf::StampedTransform(curWobjTransform, ros::Time::now(), "abb_base", "abb_workobject"));
-      pthread_mutex_unlock(&wobjUpdateMutex); 
-     
-      //Publish XYZ/Quaternion message
-      handle_CartesianLog.publish(msgCartesian);
-
-      pthread_mutex_lock(&cartUpdateMutex);
-      curP[0] = msgCartesian.pose.position.x;
-      curP[1] = msgCartesian.pose.position.y;
-      curP[2] = msgCartesian.pose.position.z;
-      curQ[0] = msgCartesian.pose.orientation.w;
-      curQ[1] = msgCartesian.pose.orientation.x;
-      curQ[2] = msgCartesian.pose.orientation.y;
-      curQ[3] = msgCartesian.pose.orientation.z;
-      pthread_mutex_unlock(&cartUpdateMutex); 
+    // Joint Message
+    case LOG_JOINTS:
+      {
+        //Convert joint angles to radians
+        msgJoints.header.stamp = now;
+        for (int i = 0; i < NUM_JOINTS; i++)
+          msgJoints.position[i] = sample.values[i] * 0.017453292;
+
+        handle_JointsLog.publish(msgJoints);
+        pthread_mutex_lock(&jointUpdateMutex);
+        for (int i = 0; i < NUM_JOINTS; i++)
+          curJ[i] = msgJoints.position[i];
+        pthread_mutex_unlock(&jointUpdateMutex);
+        signalFeedback();
+        break;
+      }
 
-    }
-    if(jointsModif)
-    {
-      handle_JointsLog.publish(msgJoints);
-      pthread_mutex_lock(&jointUpdateMutex);
-      curJ[0] = msgJoints.position[0];
-      curJ[1] = msgJoints.position[1];
-      curJ[2] = msgJoints.position[2];
-      curJ[3] = msgJoints.position[3];
-      curJ[4] = msgJoints.position[4];
-      curJ[5] = msgJoints.position[5];
-      pthread_mutex_unlock(&jointUpdateMutex);
-    }
-    if(forceModif)
-    {
-      
-      handle_ForceLog.publish(msgForce);
-      pthread_mutex_lock(&forceUpdateMutex);
-      curForce[0] = msgForce.wrench.force.x;
-      curForce[1] = msgForce.wrench.force.y;
-      curForce[2] = msgForce.wrench.force.z;
-      curForce[3] = msgForce.wrench.torque.x;
-      curForce[4] = msgForce.wrench.torque.y;
-      curForce[5] = msgForce.wrench.torque.z;
-      pthread_mutex_unlock(&forceUpdateMutex);
-    }
+    // Force Message
+    case LOG_FORCE:
+      {
+        msgForce.header.stamp = now;
+        msgForce.wrench.force.x = sample.values[0];
+        msgForce.wrench.force.y = sample.values[1];
+        msgForce.wrench.force.z = sample.values[2];
+        msgForce.wrench.torque.x = sample.values[3];
+        msgForce.wrench.torque.y = sample.values[4];
+        msgForce.wrench.torque.z = sample.values[5];
+
+        handle_ForceLog.publish(msgForce);
+        pthread_mutex_lock(&forceUpdateMutex);
+        for (int i = 0; i < NUM_FORCES; i++)
+          curForce[i] = sample.values[i];
+        pthread_mutex_unlock(&forceUpdateMutex);
+        break;
+      }
   }
 }
 
 //////////////////////////////////////////////////////////////////////////////
 // Main Thread for Logger
 //
-// This is the main function for our logger thread. We simply start a ROS 
-// timer event and get it to call our loggerCallback function at a 
-// specified interval. This exits when ROS shuts down.
+// This is the main function for our logger thread. It reads the logger 
+// stream and publishes every sample as it arrives, until ROS shuts down 
+// or the connection to the logger server is lost.
 //////////////////////////////////////////////////////////////////////////////
 void *loggerMain(void *args)
 {
@@ -1605,24 +2034,170 @@ void *loggerMain(void *args)
   RobotController* ABBrobot;
   ABBrobot = (RobotController*) args;
 
-  // Create a timer to look at the log data
-  ros::Timer loggerTimer;
-  loggerTimer = ABBrobot->node->createTimer(ros::Duration(0.003), 
-      &RobotController::logCallback, ABBrobot);
-
-  // Now simply wait until the program is shut down
-  ros::waitForShutdown();
-  loggerTimer.stop();
+  // Wake up regularly to check whether ROS is shutting down
+  while (ros::ok())
+  {
+    if (!ABBrobot->readLogger(100))
+      break;
+  }
 
   pthread_exit((void*) 0);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// Non-Blocking Steps
+//
+// These compute the next step of a non-blocking move, from the last goal 
+// towards the target, limited by the step sizes of the current 
+// non-blocking speed. They return true when the step reaches the target.
+//////////////////////////////////////////////////////////////////////////////
+static bool cartesianStep(const FixedHomogTransf &pos, 
+    const FixedHomogTransf &target, double cartStep, double orientStep, 
+    Vec3 &newGoalV, FixedQuaternion &newGoalQ)
+{
+  // Find the difference between the goal and our target
+  FixedHomogTransf diff = (pos.inv())*target;
+  
+  // Get the orientation and translational change
+  Vec3 diffV = diff.getTranslation();
+  FixedQuaternion diffQ = diff.getRotation().getQuaternion();
+  diffQ /= diffQ.norm();
+
+  // Compute the magnitude of each change
+  double transMag = diffV.norm();
+  double rotMag = diffQ.getAngle();
+
+  // Compute the number of loops it will take us to reach our 
+  // translation and orientation goals
+  double linSteps = transMag / cartStep;
+  double angSteps = rotMag / orientStep;
+  
+  // This will hold the distance to translate 
+  // and rotate for this iteration
+  double transDist = 0;
+  double angDist = 0;
+
+  // Keep track of whether this is our last step
+  bool reachedGoal = false;
+
+  // If we have more linear steps than angular steps left, make sure 
+  // we go the full distance for the linear step, but only a scaled 
+  // distance for the angular step
+  if (linSteps >= angSteps)
+  {
+    // If we have more than a step left, make sure we only move 
+    // 1 step's worth in both rotation and translation
+    if (linSteps > 1.0)
+    {
+      transDist = transMag / linSteps;
+      angDist = rotMag / linSteps;
+    }
+    else
+    {
+      // Otherwise, we are less than a step away from our goal
+      reachedGoal = true;
+    }
+  }
+  else
+  {
+    // If there are more angular steps than linear steps remaining, 
+    // make sure we scale everything by the number of angular 
+    // steps left
+    if (angSteps > 1.0)
+    {
+      // If we have more than a step left, only move 1 steps's worth
+      angDist = rotMag / angSteps;
+      transDist = transMag / angSteps;
+    }
+    else
+    {
+      // Otherwise, we are less than a step away from our goal
+      reachedGoal = true;
+    }
+  }
+
+  // Now that we have computed the magnitude of our steps, compute
+  // the actual translation and rotation to do for this step
+  Vec3 incTrans(0.0);
+  FixedQuaternion incRot;
+
+  if (!reachedGoal)
+  {
+    // Simply scale the total difference by the current magnitude's step
+    // to get the translation for this step
+    if (transMag > 0)
+      incTrans = diffV * transDist / transMag;
+
+    // Rotate from not rotating (unit quaternion) towards the full 
+    // rotation, by exactly the angle for the current step
+    if (rotMag > 0)
+      incRot = quatSlerp(FixedQuaternion(), diffQ, angDist / rotMag);
+  }
+  else
+  { 
+    // If we have less than a step to go, the translation and rotation 
+    // is simply the changed we calculated above
+    incTrans = diffV;
+    incRot = diffQ;
+  }
+
+  // Now form homogeneous matrices to calculate the resulting 
+  // position and orientation from this step
+  FixedHomogTransf incStep(incRot.getRotMat(), incTrans);
+  FixedHomogTransf newGoal = pos * incStep;
+
+  newGoalV = newGoal.getTranslation();
+  newGoalQ = newGoal.getRotation().getQuaternion();
+
+  return reachedGoal;
+}
+
+static bool jointStep(const double goalJ[], const double targJ[], 
+    double jointStepSize, double newGoalJ[])
+{
+  int i;
+  double diffJ[NUM_JOINTS];
+  double maxNumSteps = 0.0;
+
+  // Find the joint with the furthest to go, and compute the number
+  // of iterations it will take to get there
+  for (i=0; i<NUM_JOINTS; i++)
+  {
+    diffJ[i] = targJ[i] - goalJ[i];
+    double numSteps = fabs(diffJ[i]) / jointStepSize;
+    if (numSteps > maxNumSteps)
+      maxNumSteps = numSteps;
+  }
+
+  // If we have more than one iteration to go, scale the total 
+  // difference by the magnitude of the current step and add it 
+  // to the current position to get our new goal
+  if (maxNumSteps > 1.0)
+  {
+    for (i=0; i<NUM_JOINTS; i++)
+      newGoalJ[i] = goalJ[i] + diffJ[i] / maxNumSteps;
+    return false;
+  }
+
+  // Otherwise, we will reach our goal during this step, so simply
+  // add the entire difference to the current position to get our goal
+  for (i=0; i<NUM_JOINTS; i++)
+    newGoalJ[i] = goalJ[i] + diffJ[i];
+  return true;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Main Thread for Non-Blocking
 //
 // This is the main function of the non-blocking thread. When we are in
 // non-blocking mode, it updates it's current target position, figures
-// out what step to take, and moves there. 
+// out what step to take, and moves there. With robot/nbBatchSteps above
+// 1, it figures out that many steps at once, and uploads them to the 
+// robot as a single path, so that dense paths are not limited by the
+// round-trip time of every step. The thread sleeps on nonBlockCond while 
+// there is nothing to do, and while the robot catches up with its last 
+// goal, so that new moves, stops and robot feedback are handled as soon 
+// as they are signalled.
 //////////////////////////////////////////////////////////////////////////////
 void *nonBlockMain(void *args)
 {
@@ -1630,253 +2205,150 @@ void *nonBlockMain(void *args)
   RobotController* robot;
   robot = (RobotController*) args;
 
-  // Initiate our loop frequency variable
-  ros::Rate nb_rate(NB_FREQ);
+  // Steps are not sent faster than NB_FREQ
+  ros::WallTime nextStep = ros::WallTime::now();
+
+  // Steps to take, 7 values per cartesian step or NUM_JOINTS per joint step
+  static double path[MAX_PATH_POINTS * 7];
 
   // We will stay in this loop until ROS shuts down
+  pthread_mutex_lock(&nonBlockMutex);
   while(ros::ok())
   {
-    // While we are inside this loop, the robot is moving
-    while (robot->non_blocking && robot->do_nb_move)
+    // Sleep until a move is started
+    if (!robot->non_blocking || !robot->do_nb_move)
     {
-      // If we are doing a cartesian move, execute the sequence below
-      if (robot->cart_move)
-      {
-        // Read in the current cartesian target, and don't use it again
-        // for this iteration in case it changed in between
-        pthread_mutex_lock (&nonBlockMutex);
-        HomogTransf target(robot->curTargQ.getRotMat(), robot->curTargP);
-        robot->targetChanged = false;
-        /*ROS_INFO("Target: %f, %f, %f", robot->curTargP[0], 
-            robot->curTargP[1], robot->curTargP[2]);*/
-        pthread_mutex_unlock(&nonBlockMutex);
-
-        // Get the last goal position, and find the 
-        // difference between here and our target
-        HomogTransf pos(robot->curGoalQ.getRotMat(), robot->curGoalP);
-        HomogTransf diff = (pos.inv())*target;
-        
-        // Get the orientation and translational change
-        Vec diffV = diff.getTranslation();
-        Quaternion diffQ = diff.getRotation().getQuaternion();
-        diffQ /= diffQ.norm();
-
-        // Compute the magnitude of each change
-        double transMag = diffV.norm();
-        double rotMag = diffQ.getAngle();
-
-        // Compute the number of loops it will take us to reach our 
-        // translation and orientation goals. Note that since our speed and
-        // step size is variable, we make sure that nothing funny happens while
-        pthread_mutex_lock(&nonBlockMutex);
-        double linSteps = transMag / robot->curCartStep;
-        double angSteps = rotMag / robot->curOrientStep;
-        pthread_mutex_unlock(&nonBlockMutex);
-        
-        // This will hold the distance to translate 
-        // and rotate for this iteration
-        double transDist = 0;
-        double angDist = 0;
-
-        // Keep track of whether this is our last step
-        bool reachedGoal = false;
-
-        // If we have more linear steps than angular steps left, make sure 
-        // we go the full distance for the linear step, but only a scaled 
-        // distance for the angular step
-        if (linSteps >= angSteps)
-        {
-          // If we have more than a step left, make sure we only move 
-          // 1 step's worth in both rotation and translation
-          if (linSteps > 1.0)
-          {
-            transDist = transMag / linSteps;
-            angDist = rotMag / linSteps;
-          }
-          else
-          {
-            // Otherwise, we are less than a step away from our goal
-            reachedGoal = true;
-          }
-        }
-        else
-        {
-          // If there are more angular steps than linear steps remaining, 
-          // make sure we scale everything by the number of angular 
-          // steps left
-          if (angSteps > 1.0)
-          {
-            // If we have more than a step left, only move 1 steps's worth
-            angDist = rotMag / angSteps;
-            transDist = transMag / angSteps;
-          }
-          else
-          {
-            // Otherwise, we are less than a step away from our goal
-            reachedGoal = true;
-          }
-        }
-
-        // Now that we have computed the magnitude of our steps, compute
-        // the actual translation and rotation to do for this step
-        Vec incTrans(3);
-        Quaternion incRot("1 0 0 0");
+      pthread_cond_wait(&nonBlockCond, &nonBlockMutex);
+      continue;
+    }
 
-        if (!reachedGoal)
-        {
-          // Simply scale the total difference by the current magnitude's step
-          // to get the translation for this step
-          if (transMag > 0)
-            incTrans = diffV * transDist / transMag;
-
-          // Interpolate between not rotating (unit quaternion) to the full
-          // rotation, and scale by the magnitude for the current step
-          if (rotMag > 0)
-          {
-            incRot = Quaternion("1 0 0 0") + 
-               (diffQ - Quaternion("1 0 0 0")) * angDist / rotMag;
-
-            // Make sure that we renormalize our quaternion
-            incRot /= incRot.norm();
-          }
-        }
-        else
-        { 
-          // If we have less than a step to go, the translation and rotation 
-          // is simply the changed we calculated above
-          incTrans = diffV;
-          incRot = diffQ;
-        }
+    // Make sure we don't hog all the CPU by running too fast, while still 
+    // noticing a stop request right away
+    ros::WallTime now = ros::WallTime::now();
+    if (now < nextStep)
+    {
+      struct timespec deadline;
+      deadline.tv_sec = nextStep.sec;
+      deadline.tv_nsec = nextStep.nsec;
+      pthread_cond_timedwait(&nonBlockCond, &nonBlockMutex, &deadline);
+      continue;
+    }
+    nextStep = now + ros::WallDuration(1.0 / NB_FREQ);
 
-        // Now form homogeneous matrices to calculate the resulting 
-        // position and orientation from this step
-        HomogTransf incStep(incRot.getRotMat(), incTrans);
-        HomogTransf newGoal = pos * incStep;
-
-        Vec newGoalV = newGoal.getTranslation();
-        Quaternion newGoalQ = newGoal.getRotation().getQuaternion();
-
-        // Wait here until we're within range to last commanded goal
-	ros::Rate check_rate(DIST_CHECK_FREQ);
-
-	while ((robot->posDistFromGoal() > robot->curDist[0]) ||
-	       (robot->orientDistFromGoal() > robot->curDist[1]))
-	  check_rate.sleep();
-
-        /*
-        ROS_INFO("New Goal: %f, %f, %f", newGoalV[0], newGoalV[1], newGoalV[2]);
-        ROS_INFO("Old Goal: %f, %f, %f", robot->curGoalP[0], 
-            robot->curGoalP[1], robot->curGoalP[2]);
-        pthread_mutex_lock (&cartUpdateMutex);
-        ROS_INFO("Cur Pos: %f, %f, %f", 
-            robot->curP[0], robot->curP[1], robot->curP[2]); 
-        pthread_mutex_unlock(&cartUpdateMutex);
-*/
-
-        // Now do the cartesian move towards our new goal
-        if (!robot->setCartesian(newGoalV[0], newGoalV[1], newGoalV[2],
-              newGoalQ[0], newGoalQ[1], newGoalQ[2], newGoalQ[3]))
-        {
-          ROS_INFO("Non-Blocking move error!");
-          pthread_mutex_lock (&nonBlockMutex);
-          robot->do_nb_move = false;
-          pthread_mutex_unlock(&nonBlockMutex);
-        }
+    // While we are computing or sending this step, stop_nb() waits for us
+    robot->nbBusy = true;
+    bool reached;
+    bool moved = true;
 
-        // If we have reached our goal, and the target hasn't been changed 
-        // while we were doing the last move, we're done.
-        pthread_mutex_lock (&nonBlockMutex);
-        if (reachedGoal && !robot->targetChanged)
-          robot->do_nb_move = false;
-        pthread_mutex_unlock(&nonBlockMutex);
-      }
-      // Otherwise, we are executing a non-blocking joint move
-      else
+    // If we are doing a cartesian move, execute the sequence below
+    if (robot->cart_move)
+    {
+      // Read in the current cartesian target and step sizes, and don't 
+      // use them again for this iteration in case they changed in between
+      FixedHomogTransf target(FixedQuaternion(robot->curTargQ).getRotMat(),
+          Vec3(robot->curTargP));
+      robot->targetChanged = false;
+      double cartStep = robot->curCartStep;
+      double orientStep = robot->curOrientStep;
+      int batchSteps = robot->nbBatchSteps;
+      pthread_mutex_unlock(&nonBlockMutex);
+
+      // Compute the steps from the last goal position towards our target
+      FixedHomogTransf pos(FixedQuaternion(robot->curGoalQ).getRotMat(),
+          Vec3(robot->curGoalP));
+      reached = false;
+      int numSteps = 0;
+      while (!reached && numSteps < batchSteps)
       {
-        int i;
-	double diffJ[NUM_JOINTS];
-	double newGoalJ[NUM_JOINTS];
-        bool reachedJ = false;
-        double maxNumSteps = 0.0;
-        double jointStepSize;
-
-        // Compute the difference between the current goal and joint target 
-        // for each joint. Note that this is the only time we access the 
-        // current joint target, as it's possible that it could change 
-        // while we are executing this iteration.
-        pthread_mutex_lock (&nonBlockMutex);
-        for (i=0; i<NUM_JOINTS; i++)
-        {
-          diffJ[i] = (robot->curTargJ[i]) - (robot->curGoalJ[i]);
-        }
-        robot->targetChanged = false;
-        jointStepSize = robot->curJointStep;
+        Vec3 newGoalV;
+        FixedQuaternion newGoalQ;
+        reached = cartesianStep(pos, target, cartStep, orientStep,
+            newGoalV, newGoalQ);
+
+        double *step = path + 7 * numSteps;
+        for (int i=0; i<3; i++)
+          step[i] = newGoalV[i];
+        for (int i=0; i<4; i++)
+          step[3 + i] = newGoalQ[i];
+        numSteps++;
+
+        pos = FixedHomogTransf(newGoalQ.getRotMat(), newGoalV);
+      }
 
-        // Find the joint with the furthest to go, and compute the number
-        // of iterations it will take to get there
-        for (i=0; i<NUM_JOINTS; i++)
-        {
-          double numSteps = fabs(diffJ[i]) / jointStepSize;
-          if (numSteps > maxNumSteps)
-            maxNumSteps = numSteps;
-        }
-        pthread_mutex_unlock(&nonBlockMutex);
+      // Wait here until we're within range to last commanded goal
+      pthread_mutex_lock(&nonBlockMutex);
+      bool tracking = robot->waitForTracking(true);
+      pthread_mutex_unlock(&nonBlockMutex);
 
-        // If we have more than one iteration to go, scale the total 
-        // difference by the magnitude of the current step and add it 
-        // to the current position to get our new goal
-        if (maxNumSteps > 1.0)
-        {
-          for (i=0; i<NUM_JOINTS; i++)
-	    {
-	      newGoalJ[i] = robot->curGoalJ[i] + diffJ[i] / maxNumSteps;
-	    }
-	}
+      // Now do the cartesian move towards our new goal
+      if (tracking)
+      {
+        if (numSteps == 1)
+          moved = robot->setCartesian(path[0], path[1], path[2],
+              path[3], path[4], path[5], path[6]);
         else
-        {
-          // Otherwise, we will reach our goal during this step, so simply
-          // add the entire difference to the current position to get our goal
-          for (i=0; i<NUM_JOINTS; i++)
-	    {
-	      newGoalJ[i] = robot->curGoalJ[i] + diffJ[i];
-	    }
-	  reachedJ = true;
-        }
+          moved = robot->setCartesianPath(path, numSteps);
+      }
+    }
+    // Otherwise, we are executing a non-blocking joint move
+    else
+    {
+      double targJ[NUM_JOINTS];
+
+      // Read in the current joint target. Note that this is the only 
+      // time we access the current joint target, as it's possible that 
+      // it could change while we are executing this iteration.
+      for (int i=0; i<NUM_JOINTS; i++)
+        targJ[i] = robot->curTargJ[i];
+      robot->targetChanged = false;
+      double jointStepSize = robot->curJointStep;
+      int batchSteps = robot->nbBatchSteps;
+      pthread_mutex_unlock(&nonBlockMutex);
+
+      // Compute the steps from the last goal towards our target
+      const double *goalJ = robot->curGoalJ;
+      reached = false;
+      int numSteps = 0;
+      while (!reached && numSteps < batchSteps)
+      {
+        double *step = path + NUM_JOINTS * numSteps;
+        reached = jointStep(goalJ, targJ, jointStepSize, step);
+        goalJ = step;
+        numSteps++;
+      }
 
-        // Wait here until we're within range to last commanded goal
-	ros::Rate check_rate(DIST_CHECK_FREQ);
-	while (robot->jointDistFromGoal() > robot->curDist[2])
-	  {
-	    check_rate.sleep();
-	  }
-	// Now do the joint move towards our new goal
-        if (!robot->setJoints(newGoalJ))
-        {
-          ROS_INFO("Non-Blocking move error!");
-          pthread_mutex_lock (&nonBlockMutex);
-          robot->do_nb_move = false;
-          pthread_mutex_unlock(&nonBlockMutex);
-        }
+      // Wait here until we're within range to last commanded goal
+      pthread_mutex_lock(&nonBlockMutex);
+      bool tracking = robot->waitForTracking(false);
+      pthread_mutex_unlock(&nonBlockMutex);
 
-        // If we have reached our goal, and the target hasn't been changed 
-        // while we were doing the last move, we're done.
-        pthread_mutex_lock (&nonBlockMutex);
-        if (reachedJ && !robot->targetChanged)
-          robot->do_nb_move = false;
-        pthread_mutex_unlock(&nonBlockMutex);
+      // Now do the joint move towards our new goal
+      if (tracking)
+      {
+        if (numSteps == 1)
+          moved = robot->setJoints(path);
+        else
+          moved = robot->setJointsPath(path, numSteps);
       }
+    }
 
-      // Make sure we don't hog all the CPU by running too fast
-      nb_rate.sleep();
+    pthread_mutex_lock(&nonBlockMutex);
+    if (!moved)
+    {
+      ROS_INFO("Non-Blocking move error!");
+      robot->do_nb_move = false;
     }
 
-    // If we get a stop request, confirm that we've stopped
-    if (robot->stopRequest)
-      robot->stopConfirm = true;
+    // If we have reached our goal, and the target hasn't been changed 
+    // while we were doing the last move, we're done.
+    if (reached && !robot->targetChanged)
+      robot->do_nb_move = false;
 
-    // Make sure we don't hog all the CPU by running too fast
-    nb_rate.sleep();
+    // Let stop_nb() know that no step is being sent anymore
+    robot->nbBusy = false;
+    pthread_cond_broadcast(&nonBlockCond);
   }
+  pthread_mutex_unlock(&nonBlockMutex);
 
   pthread_exit((void*) 0);
 }
@@ -1902,23 +2374,10 @@ int main(int argc, char** argv)
  
   // Initialize the mutex's we will be using in our threads
   pthread_mutex_init(&nonBlockMutex, NULL);
+  pthread_cond_init(&nonBlockCond, NULL);
   pthread_mutex_init(&jointUpdateMutex, NULL);
   pthread_mutex_init(&cartUpdateMutex, NULL);
   pthread_mutex_init(&forceUpdateMutex, NULL);
-  pthread_mutex_init(&sendRecvMutex, NULL);
-
-  // Create a dedicated thread for logger broadcasts
-  pthread_t loggerThread;
-  pthread_attr_t attrL;
-  pthread_attr_init(&attrL);
-  pthread_attr_setdetachstate(&attrL, PTHREAD_CREATE_JOINABLE);
-
-  if (pthread_create(&loggerThread, &attrL, 
-        loggerMain, (void*)&ABBrobot) != 0)
-  {
-    ROS_INFO("ROBOT_CONTROLLER: Unable to create logger thread. "
-        "Error number: %d.",errno);
-  }
 
   // Create a dedicated thread for non-blocking moves
   pthread_t nonBlockThread;
@@ -1941,6 +2400,20 @@ int main(int argc, char** argv)
   ROS_INFO("ROBOT_CONTROLLER: Advertising ROS topics...");
   ABBrobot.advertiseTopics();
 
+  // Create a dedicated thread for logger broadcasts, now that the topics 
+  // it publishes on are advertised
+  pthread_t loggerThread;
+  pthread_attr_t attrL;
+  pthread_attr_init(&attrL);
+  pthread_attr_setdetachstate(&attrL, PTHREAD_CREATE_JOINABLE);
+
+  if (pthread_create(&loggerThread, &attrL, 
+        loggerMain, (void*)&ABBrobot) != 0)
+  {
+    ROS_INFO("ROBOT_CONTROLLER: Unable to create logger thread. "
+        "Error number: %d.",errno);
+  }
+
   //Main ROS loop
   ROS_INFO("ROBOT_CONTROLLER: Running node /robot_controller...");
   // Multithreaded spinner so that callbacks 
@@ -1949,17 +2422,22 @@ int main(int argc, char** argv)
   spinner.spin();
   ROS_INFO("ROBOT_CONTROLLER: Shutting down node /robot_controller...");
 
+  // Wake up the non-blocking thread, so that it notices the shut down
+  pthread_mutex_lock(&nonBlockMutex);
+  pthread_cond_broadcast(&nonBlockCond);
+  pthread_mutex_unlock(&nonBlockMutex);
+
   //End threads
   void *statusL, *statusB;
+  pthread_join(loggerThread, &statusL);
+  pthread_join(nonBlockThread, &statusB);
   pthread_attr_destroy(&attrL);
   pthread_attr_destroy(&attrB);
+  pthread_cond_destroy(&nonBlockCond);
   pthread_mutex_destroy(&nonBlockMutex);
   pthread_mutex_destroy(&jointUpdateMutex);
   pthread_mutex_destroy(&cartUpdateMutex);
   pthread_mutex_destroy(&forceUpdateMutex);
-  pthread_mutex_destroy(&sendRecvMutex);
-  pthread_join(loggerThread, &statusL);
-  pthread_join(nonBlockThread, &statusB);
 
   ROS_INFO("ROBOT_CONTROLLER: Done.");
   return 0;
@@ -1,15 +1,24 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 #include <pthread.h>
+#include <poll.h>
 #include <arpa/inet.h>
 #include <sys/socket.h>
 #include <sys/types.h> 
 
 #include "abb_comm.h"
+#include "atomic_flag.h"
+#include "command_channel.h"
+#include "logger_parser.h"
+#include "telemetry_recorder.h"
+#include "trajectory.h"
 #include "matVec.h"
 
 //ROS specific
@@ -31,17 +40,18 @@
 #include <abb_node/robot_Stop.h>
 #include <abb_node/robot_SetTrackDist.h>
 #include <abb_node/robot_IsMoving.h>
+#include <abb_node/robot_SetJointTrajectory.h>
 
 //ROS specific, these are redundant with abb_node
 //standard libary messages instead of custom messages
 #include <tf/transform_broadcaster.h>
+#include <urdf/model.h>
 #include <sensor_msgs/JointState.h>
 #include <geometry_msgs/WrenchStamped.h>
 #include <geometry_msgs/PoseStamped.h>
 
 //#define MAX_BUFFER 256
 #define MAX_BUFFER 10000
-#define ID_CODE_MAX 999
 
 #define SERVER_BAD_MSG 0
 #define SERVER_OK 1
@@ -52,8 +62,6 @@
 #define MAX_J_STEP 0.5
 
 #define NB_FREQ 200.0
-#define STOP_CHECK_FREQ 25.0
-#define DIST_CHECK_FREQ 100.0
 
 #define SAFETY_FACTOR 0.90
 #define MINIMUM_TRACK_DIST_TRANS 1.0 //mm
@@ -67,9 +75,26 @@
 #define MINIMUM_NB_SPEED_ORI 0.333 //deg/s
 
 
+// Size of the cartesian and joint buffers in the robot server
+#define MAX_PATH_POINTS 512
+
 #define NUM_JOINTS 6
 #define NUM_FORCES 6
 
+// Default joint limits when there is no robot_description (rad, rad/s and
+// rad/s^2), and the sample time of the joint trajectories (s)
+#define DEFAULT_JOINT_LIMIT_POS 3.14159265
+#define DEFAULT_JOINT_LIMIT_VEL 1.0
+#define DEFAULT_JOINT_LIMIT_ACC 2.0
+#define DEFAULT_TRAJ_SAMPLE_TIME 0.1
+
+// Period of the work object transform (s), which is only sent when it
+// changes and at this period for the listeners that start later
+#define DEFAULT_TF_WOBJ_PERIOD 1.0
+
+// Logger samples kept in the telemetry file (about 15 minutes at 250 Hz)
+#define DEFAULT_TELEMETRY_CAPACITY 262144
+
 #define BLOCKING 1
 #define NON_BLOCKING 0
 
@@ -107,11 +132,13 @@ static const zone_vals zone_data[NUM_ZONES] =
 
 // Mutex used for threads
 pthread_mutex_t nonBlockMutex;
+// Signalled with nonBlockMutex when a non-blocking move is started or 
+// stopped, when the robot position is updated and when ROS shuts down
+pthread_cond_t nonBlockCond;
 pthread_mutex_t jointUpdateMutex;
 pthread_mutex_t cartUpdateMutex;
 pthread_mutex_t wobjUpdateMutex;
 pthread_mutex_t forceUpdateMutex;
-pthread_mutex_t sendRecvMutex;
 
 class RobotController
 {
@@ -171,24 +198,28 @@ class RobotController
   bool robot_IsMoving(
       abb_node::robot_IsMoving::Request& req, 
       abb_node::robot_IsMoving::Response& res);
+  bool robot_SetJointTrajectory(
+      abb_node::robot_SetJointTrajectory::Request& req, 
+      abb_node::robot_SetJointTrajectory::Response& res);
 
 
   // Advertise Services and Topics
   void advertiseServices();
   void advertiseTopics();
 
-  // Call back function for the logging which will be called by a timer event
-  void logCallback(const ros::TimerEvent&);
+  // Read the logger stream and publish the samples received, waiting at 
+  // most timeout ms for data. Returns false once the connection is lost.
+  bool readLogger(int timeout);
   
   // Public access to the ROS node
   ros::NodeHandle *node;
 
   // Non-Blocking move variables
-  bool non_blocking;  // Whether we are in non-blocking mode
-  bool do_nb_move;    // Whether we are currently moving in non-blocking mode
-  bool targetChanged; // Whether a new target was specified
-  bool stopRequest;   // Set to true when we are trying to stop the robot
-  bool stopConfirm;   // Set to true when the thread is sure it's stopped
+  // The flags are only changed with nonBlockMutex held
+  AtomicFlag non_blocking;  // Whether we are in non-blocking mode
+  AtomicFlag do_nb_move;    // Whether we are currently moving in non-blocking mode
+  AtomicFlag targetChanged; // Whether a new target was specified
+  bool nbBusy;        // Set while the thread is computing or sending a step
   bool cart_move;     // True if we're doing a cartesian move, false if joint
 
   // Variables dealing with changing non-blocking speed and step sizes
@@ -206,16 +237,32 @@ class RobotController
   double curGoalJ[NUM_JOINTS];
   double curTargJ[NUM_JOINTS];
 
+  // Number of non-blocking steps uploaded to the robot at once
+  int nbBatchSteps;
+
   // Move commands are public so that the non-blocking thread can use it
   bool setCartesian(double x, double y, double z, 
 		    double q0, double qx, double qy, double qz);
   bool setJoints(double position[]);
 
+  // Upload a whole path to the robot and execute it there, with the current
+  // zone. Poses have 7 values (x y z q0 qx qy qz), joint positions have 
+  // NUM_JOINTS values (in radians). Joint positions can be given the time
+  // to reach each of them (in seconds), instead of moving at the current
+  // speed.
+  bool setCartesianPath(const double poses[], int numPoses);
+  bool setJointsPath(const double positions[], int numPositions,
+      const double durations[] = NULL);
+
   // Functions that compute our distance from the current position to the goal
   double posDistFromGoal();
   double orientDistFromGoal();
   double jointDistFromGoal();
 
+  // Wait until the robot is within the tracking distance of the last goal,
+  // with nonBlockMutex held. Returns false if the move was stopped instead.
+  bool waitForTracking(bool cartesian);
+
  private:
   // Socket Variables
   bool motionConnected;
@@ -237,6 +284,34 @@ class RobotController
   ros::Publisher handle_ForceLog;
   ros::Publisher handle_CartesianLog;
 
+  // Logger stream parser, and the messages published for its samples
+  LoggerParser loggerParser;
+  unsigned long reportedMalformed;
+  unsigned long reportedDropped;
+  sensor_msgs::JointState msgJoints;
+  geometry_msgs::WrenchStamped msgForce;
+  geometry_msgs::PoseStamped msgCartesian;
+  void initLoggerMessages();
+  void publishSample(const logger_sample &sample);
+
+  // Transforms abb_workobject -> abb_tcp and abb_base -> abb_workobject,
+  // which are reused for every broadcast
+  tf::StampedTransform tcpTransform;
+  tf::StampedTransform wobjTransform;
+  ros::Time wobjNextPublish;
+  double wobjTfPeriod;
+  void publishWobjTransform(const ros::Time &now);
+
+  // Limits of the joints for trajectories, from the robot_description
+  joint_limits jointLimits[NUM_JOINTS];
+  double trajSampleTime;
+  JointTrajectory trajectory;
+  void loadJointLimits();
+
+  // Optional recording of the logger samples (robot/telemetryFile)
+  TelemetryRecorder telemetry;
+  void signalFeedback();
+
   ros::ServiceServer handle_Ping;
   ros::ServiceServer handle_SetCartesian;
   ros::ServiceServer handle_GetCartesian;
@@ -253,13 +328,26 @@ class RobotController
   ros::ServiceServer handle_SetVacuum;
   ros::ServiceServer handle_SetDIO;
   ros::ServiceServer handle_IsMoving;
+  ros::ServiceServer handle_SetJointTrajectory;
  
+  // Pipelined command channel to the robot motion server
+  CommandChannel motionChannel;
+
   // Helper function for communicating with robot server
   bool sendAndReceive(char *message, int messageLength, 
-      char*reply, int idCode=-1);
+      char*reply, int idCode);
+
+  // Helper function for uploading and executing a path
+  bool executePath(bool cartesian, const double targets[], int numTargets,
+      const double durations[] = NULL);
+  int pathFailures;  // Targets of the path rejected by the robot server
+
+  // Whether the binary protocol was negotiated with the robot
+  bool binaryProtocol;
 
   // Internal functions that communicate with the robot
   bool ping();
+  bool setLoggerFormat(bool binary);
   bool getCartesian(double &x, double &y, double &z, 
       double &q0, double &qx, double &qy, double &qz);
   bool getJoints(double &j1, double &j2, double &j3,
@@ -291,6 +379,7 @@ class RobotController
   Vec curWorkP;
   Quaternion curWorkQ;
   tf::Transform curWobjTransform;
+  bool wobjChanged;  // Set when curWobjTransform changes, with wobjUpdateMutex
 
 
   // Robot Position and Force Information
@@ -0,0 +1,23 @@
+#ifndef ATOMIC_FLAG_H
+#define ATOMIC_FLAG_H
+
+// Flag shared between threads. It can be read without a mutex, and every
+// read sees the last value written.
+class AtomicFlag
+{
+ public:
+  AtomicFlag(bool value=false) { *this = value; }
+  operator bool() const { return __sync_fetch_and_add(&flag, 0) != 0; }
+  AtomicFlag &operator=(bool value)
+  {
+    __sync_synchronize();
+    __sync_lock_test_and_set(&flag, value ? 1 : 0);
+    __sync_synchronize();
+    return *this;
+  }
+  
+ private:
+  mutable volatile int flag;
+};
+
+#endif
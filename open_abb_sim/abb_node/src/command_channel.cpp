@@ -0,0 +1,380 @@
+//
+// Command Channel
+//
+// Pipelined communication with the ABB motion server. Commands are sent as
+// soon as they are issued, and a dedicated reader thread matches the
+// replies to them by their identification code.
+//
+
+#include "command_channel.h"
+#include "abb_comm.h"
+
+#include <errno.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+
+#include <ros/ros.h>
+
+CommandChannel::CommandChannel()
+{
+  robotSocket = -1;
+  running = false;
+  started = false;
+  inFlight = 0;
+  nextSequence = 0;
+  lastIdCode = 0;
+  for (int i = 0; i < MAX_IN_FLIGHT; i++)
+    slots[i].state = SLOT_FREE;
+
+  pthread_mutex_init(&sendMutex, NULL);
+  pthread_mutex_init(&slotMutex, NULL);
+  pthread_cond_init(&slotFreed, NULL);
+  pthread_cond_init(&replyReceived, NULL);
+}
+
+CommandChannel::~CommandChannel()
+{
+  stop();
+  pthread_cond_destroy(&replyReceived);
+  pthread_cond_destroy(&slotFreed);
+  pthread_mutex_destroy(&slotMutex);
+  pthread_mutex_destroy(&sendMutex);
+}
+
+// Start the reader thread on a socket connected to the motion server
+bool CommandChannel::start(int socket)
+{
+  if (started)
+    return false;
+
+  robotSocket = socket;
+  running = true;
+  if (pthread_create(&readerThread, NULL, readerMain, (void*)this) != 0)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Unable to create the command reader thread. "
+        "Error number: %d.", errno);
+    running = false;
+    return false;
+  }
+  started = true;
+  return true;
+}
+
+// Stop the reader thread. The socket is left open, but can not be read
+// anymore.
+void CommandChannel::stop()
+{
+  if (!started)
+    return;
+
+  pthread_mutex_lock(&slotMutex);
+  running = false;
+  pthread_cond_broadcast(&slotFreed);
+  pthread_mutex_unlock(&slotMutex);
+
+  // Unblock the reader thread
+  shutdown(robotSocket, SHUT_RD);
+  pthread_join(readerThread, NULL);
+  started = false;
+}
+
+// Identification codes are handed out in sequence, skipping the ones of
+// the commands still in flight, so that every reply matches one command.
+int CommandChannel::nextIdCode()
+{
+  pthread_mutex_lock(&slotMutex);
+  bool used = true;
+  while (used)
+  {
+    lastIdCode = lastIdCode % ID_CODE_MAX + 1;
+    used = false;
+    for (int i = 0; i < MAX_IN_FLIGHT; i++)
+    {
+      if (slots[i].state != SLOT_FREE && slots[i].idCode == lastIdCode)
+        used = true;
+    }
+  }
+  int idCode = lastIdCode;
+  pthread_mutex_unlock(&slotMutex);
+  return idCode;
+}
+
+// Register a command and send it to the server
+int CommandChannel::send(const char *message, int length, int idCode,
+    ReplyCallback callback, void *arg)
+{
+  pthread_mutex_lock(&sendMutex);
+  pthread_mutex_lock(&slotMutex);
+
+  // Wait for room in the pipeline
+  while (running && inFlight >= MAX_IN_FLIGHT)
+    pthread_cond_wait(&slotFreed, &slotMutex);
+
+  if (!running)
+  {
+    pthread_mutex_unlock(&slotMutex);
+    pthread_mutex_unlock(&sendMutex);
+    return -1;
+  }
+
+  // The command is registered before it is sent, so that the reply can
+  // not arrive before the reader thread knows about it.
+  int ticket = 0;
+  while (slots[ticket].state != SLOT_FREE)
+    ticket++;
+  slots[ticket].state = SLOT_PENDING;
+  slots[ticket].idCode = idCode;
+  slots[ticket].sequence = nextSequence++;
+  slots[ticket].result = CHANNEL_ERROR;
+  slots[ticket].reply[0] = '\0';
+  slots[ticket].replyLength = 0;
+  slots[ticket].callback = callback;
+  slots[ticket].arg = arg;
+  inFlight++;
+  pthread_mutex_unlock(&slotMutex);
+
+  if (::send(robotSocket, message, length, 0) == -1)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Failed to send command to ABB robot:"
+        " Error number %d.", errno);
+    pthread_mutex_lock(&slotMutex);
+    slots[ticket].state = SLOT_FREE;
+    inFlight--;
+    pthread_cond_broadcast(&slotFreed);
+    pthread_mutex_unlock(&slotMutex);
+    ticket = -1;
+  }
+
+  pthread_mutex_unlock(&sendMutex);
+  return ticket;
+}
+
+// Send a command without registering it, since no reply will come for it
+bool CommandChannel::sendNoReply(const char *message, int length)
+{
+  if (robotSocket < 0)
+    return false;
+
+  pthread_mutex_lock(&sendMutex);
+  bool sent = (::send(robotSocket, message, length, 0) != -1);
+  if (!sent)
+    ROS_WARN("ROBOT_CONTROLLER: Failed to send command to ABB robot:"
+        " Error number %d.", errno);
+  pthread_mutex_unlock(&sendMutex);
+  return sent;
+}
+
+// Wait for the reply to a command sent without a callback, and release
+// its ticket
+int CommandChannel::wait(int ticket, char *reply, double timeout)
+{
+  if (ticket < 0 || ticket >= MAX_IN_FLIGHT)
+    return CHANNEL_ERROR;
+
+  struct timespec deadline;
+  if (timeout >= 0.0)
+  {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    double end = now.tv_sec + now.tv_usec * 1e-6 + timeout;
+    deadline.tv_sec = (time_t)end;
+    deadline.tv_nsec = (long)((end - deadline.tv_sec) * 1e9);
+  }
+
+  pthread_mutex_lock(&slotMutex);
+  bool timedOut = false;
+  while (slots[ticket].state == SLOT_PENDING && !timedOut)
+  {
+    if (timeout < 0.0)
+      pthread_cond_wait(&replyReceived, &slotMutex);
+    else if (pthread_cond_timedwait(&replyReceived, &slotMutex,
+          &deadline) == ETIMEDOUT)
+      timedOut = true;
+  }
+
+  int result = CHANNEL_ERROR;
+  if (slots[ticket].state == SLOT_DONE)
+  {
+    result = slots[ticket].result;
+    memcpy(reply, slots[ticket].reply, slots[ticket].replyLength + 1);
+  }
+  else
+  {
+    // A late reply will not find its command anymore, and is dropped
+    reply[0] = '\0';
+  }
+
+  if (slots[ticket].state != SLOT_FREE)
+  {
+    slots[ticket].state = SLOT_FREE;
+    inFlight--;
+    pthread_cond_broadcast(&slotFreed);
+  }
+  pthread_mutex_unlock(&slotMutex);
+  return result;
+}
+
+void *CommandChannel::readerMain(void *arg)
+{
+  CommandChannel *channel = (CommandChannel*)arg;
+  channel->readReplies();
+  pthread_exit((void*) 0);
+}
+
+// Receive replies until the channel is stopped or the connection is lost.
+// A receive may hold several replies, or only part of one, so replies are
+// split on their "#" terminator, or on their length for binary replies.
+void CommandChannel::readReplies()
+{
+  char buffer[MAX_IN_FLIGHT * MAX_COMMAND_LENGTH];
+  int length = 0;
+
+  while (running)
+  {
+    int t = recv(robotSocket, buffer + length, sizeof(buffer) - length - 1, 0);
+    if (t <= 0)
+    {
+      if (running)
+        ROS_WARN("ROBOT_CONTROLLER: Failed to receive answer from ABB robot.");
+      break;
+    }
+    length += t;
+
+    int start = 0;
+    bool whole = true;
+    while (whole && start < length)
+    {
+      int frameLength = 0;
+      if ((unsigned char)buffer[start] == BINARY_MARKER)
+        frameLength = abb_comm::binaryFrameLength(buffer + start, length - start);
+      else
+      {
+        char *end = (char*)memchr(buffer + start, '#', length - start);
+        if (end != NULL)
+        {
+          *end = '\0';
+          frameLength = end - (buffer + start) + 1;
+        }
+      }
+
+      if (frameLength == 0)
+        whole = false;
+      else if (frameLength < 0)
+      {
+        // Skip the marker, and look for the next reply after it
+        ROS_WARN("ROBOT_CONTROLLER: Corrupt message (too many values).");
+        start++;
+      }
+      else
+      {
+        dispatch(buffer + start, frameLength);
+        start += frameLength;
+      }
+    }
+
+    // Keep the start of an incomplete reply for the next receive
+    length -= start;
+    memmove(buffer, buffer + start, length);
+    if (length >= (int)sizeof(buffer) - 1)
+    {
+      ROS_WARN("ROBOT_CONTROLLER: Corrupt message (no terminator).");
+      length = 0;
+    }
+  }
+
+  // Nothing can be received anymore
+  pthread_mutex_lock(&slotMutex);
+  running = false;
+  pthread_cond_broadcast(&slotFreed);
+  pthread_mutex_unlock(&slotMutex);
+  failAll();
+}
+
+// Hand a reply over to the oldest command in flight with its
+// identification code
+void CommandChannel::dispatch(const char *reply, int length)
+{
+  int instructionCode, idCode, result;
+  if ((unsigned char)reply[0] == BINARY_MARKER)
+    abb_comm::decodeRecord(reply, &instructionCode, &idCode, &result, 
+        NULL, NULL, 0);
+  else if (sscanf(reply, "%d %d %d", &instructionCode, &idCode, &result) != 3)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Corrupt message.");
+    ROS_WARN("reply = %s", reply);
+    return;
+  }
+
+  pthread_mutex_lock(&slotMutex);
+  int slot = -1;
+  for (int i = 0; i < MAX_IN_FLIGHT; i++)
+  {
+    if (slots[i].state == SLOT_PENDING && slots[i].idCode == idCode &&
+        (slot == -1 || slots[i].sequence < slots[slot].sequence))
+      slot = i;
+  }
+  unsigned long sequence = (slot == -1) ? 0 : slots[slot].sequence;
+  pthread_mutex_unlock(&slotMutex);
+
+  if (slot == -1)
+  {
+    ROS_WARN("ROBOT_CONTROLLER: Reply to an unknown command.");
+    ROS_WARN("reply = %s, rcvCode = %d", reply, idCode);
+    return;
+  }
+  complete(slot, sequence, result, reply, length);
+}
+
+// Complete a command, either for wait() or through its callback. The
+// command is identified by its sequence as well, since its slot may have
+// been freed and reused by another command since it was looked up.
+void CommandChannel::complete(int slot, unsigned long sequence, int result,
+    const char *reply, int length)
+{
+  pthread_mutex_lock(&slotMutex);
+  if (slots[slot].state != SLOT_PENDING || slots[slot].sequence != sequence)
+  {
+    // Given up on by wait() in the meantime
+    pthread_mutex_unlock(&slotMutex);
+    return;
+  }
+  ReplyCallback callback = slots[slot].callback;
+  void *arg = slots[slot].arg;
+  if (callback == NULL)
+  {
+    slots[slot].state = SLOT_DONE;
+    slots[slot].result = result;
+    if (length > MAX_COMMAND_LENGTH - 1)
+      length = MAX_COMMAND_LENGTH - 1;
+    memcpy(slots[slot].reply, reply, length);
+    slots[slot].reply[length] = '\0';
+    slots[slot].replyLength = length;
+    pthread_cond_broadcast(&replyReceived);
+  }
+  else
+  {
+    slots[slot].state = SLOT_FREE;
+    inFlight--;
+    pthread_cond_broadcast(&slotFreed);
+  }
+  pthread_mutex_unlock(&slotMutex);
+
+  if (callback != NULL)
+    callback(result, reply, arg);
+}
+
+void CommandChannel::failAll()
+{
+  for (int i = 0; i < MAX_IN_FLIGHT; i++)
+  {
+    pthread_mutex_lock(&slotMutex);
+    bool pending = (slots[i].state == SLOT_PENDING);
+    unsigned long sequence = slots[i].sequence;
+    pthread_mutex_unlock(&slotMutex);
+    if (pending)
+      complete(i, sequence, CHANNEL_ERROR, "", 0);
+  }
+}
@@ -0,0 +1,116 @@
+#ifndef COMMAND_CHANNEL_H
+#define COMMAND_CHANNEL_H
+
+#include <pthread.h>
+
+#include "atomic_flag.h"
+
+// Identification codes go from 1 to ID_CODE_MAX (they are sent with 3 digits)
+#define ID_CODE_MAX 999
+
+// Maximum number of commands waiting for a reply at the same time. The
+// server buffers the commands it has not parsed yet in a rawbytes variable
+// (1024 bytes), which bounds how many commands can be sent ahead.
+#define MAX_IN_FLIGHT 8
+
+// Maximum length of a command or a reply (the server uses RAPID strings)
+#define MAX_COMMAND_LENGTH 128
+
+// Result of a command that did not get a reply
+#define CHANNEL_ERROR -1
+
+/** \class CommandChannel
+    \brief Pipelined command channel to the ABB motion server.
+    Commands are sent without waiting for the replies to the previous ones.
+    A reader thread splits the received data on the "#" terminator and hands
+    each reply to the command with the same identification code (replies
+    to binary commands are framed by their length instead), either by
+    waking up a thread blocked in wait() or by calling a callback.
+*/
+class CommandChannel
+{
+ public:
+  // Called from the reader thread with the server's result code (or
+  // CHANNEL_ERROR), and the reply to the command.
+  typedef void (*ReplyCallback)(int result, const char *reply, void *arg);
+
+  CommandChannel();
+  virtual ~CommandChannel();
+
+  // Start reading replies from a connected socket
+  bool start(int socket);
+
+  // Stop the reader thread. Commands still waiting fail with CHANNEL_ERROR.
+  void stop();
+
+  // Get an identification code that is not used by any command in flight
+  int nextIdCode();
+
+  // Send a command. Blocks while MAX_IN_FLIGHT commands are in flight.
+  // Without a callback, the returned ticket must be passed to wait(). With
+  // a callback, the callback is called with the reply instead.
+  // Returns the ticket, or -1 if the command could not be sent.
+  int send(const char *message, int length, int idCode,
+      ReplyCallback callback=NULL, void *arg=NULL);
+
+  // Send a command the server does not reply to (e.g. closeConnection),
+  // in order with the other commands. Returns false if it could not be sent.
+  bool sendNoReply(const char *message, int length);
+
+  // Wait for the reply to a command, and copy it to reply (which must hold
+  // MAX_COMMAND_LENGTH characters). Text replies are copied without their
+  // "#" terminator, binary replies as received. A negative timeout waits forever.
+  // Returns the server's result code, or CHANNEL_ERROR.
+  int wait(int ticket, char *reply, double timeout=-1.0);
+
+ private:
+  typedef enum
+  {
+    SLOT_FREE = 0,
+    SLOT_PENDING,
+    SLOT_DONE
+  } SLOT_STATE;
+
+  typedef struct
+  {
+    SLOT_STATE state;
+    int idCode;
+    unsigned long sequence;  // Order in which the command was sent
+    int result;
+    char reply[MAX_COMMAND_LENGTH];
+    int replyLength;
+    ReplyCallback callback;
+    void *arg;
+  } command_slot;
+
+  // Reader thread
+  static void *readerMain(void *arg);
+  void readReplies();
+
+  // Hand a reply over to its command
+  void dispatch(const char *reply, int length);
+  void complete(int slot, unsigned long sequence, int result,
+      const char *reply, int length);
+
+  // Fail all commands in flight
+  void failAll();
+
+  int robotSocket;
+  AtomicFlag running;  // Written with slotMutex, so that waiters are woken up
+  bool started;
+  pthread_t readerThread;
+
+  // Serializes sends, so that commands go out in the order they are registered
+  pthread_mutex_t sendMutex;
+  // Protects the slots
+  pthread_mutex_t slotMutex;
+  pthread_cond_t slotFreed;
+  pthread_cond_t replyReceived;
+
+  command_slot slots[MAX_IN_FLIGHT];
+  int inFlight;
+  unsigned long nextSequence;
+  int lastIdCode;
+};
+
+#endif
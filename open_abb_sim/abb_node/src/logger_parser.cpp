@@ -0,0 +1,244 @@
+//
+// Logger Parser
+//
+// Incremental parser of the records streamed by the ABB logger server.
+// The bytes are kept in a ring buffer between receives, so that a record
+// split over several receives is parsed once its last byte has arrived.
+//
+
+#include "logger_parser.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Number of values in each type of record
+static const int recordValues[NUM_LOG_TYPES] = {7, 6, 6};
+
+// Text records hold the type, date, time and time stamp before the values
+#define TEXT_FIELDS 4
+
+static bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\0';
+}
+
+static bool isRecordStart(unsigned char c)
+{
+  return c == '#' || c == BINARY_MARKER;
+}
+
+LoggerParser::LoggerParser()
+{
+  head = 0;
+  count = 0;
+  samples = 0;
+  malformed = 0;
+  dropped = 0;
+}
+
+char *LoggerParser::receiveBuffer(int &space)
+{
+  if (count == 0)
+    head = 0;
+  else if (count == LOGGER_RING_SIZE)
+  {
+    // Nobody took the samples out. Make room for the new data.
+    dropped++;
+    head = 0;
+    count = 0;
+  }
+
+  int tail = (head + count) % LOGGER_RING_SIZE;
+  if (tail >= head)
+    space = LOGGER_RING_SIZE - tail;
+  else
+    space = head - tail;
+  return ring + tail;
+}
+
+void LoggerParser::received(int length)
+{
+  count += length;
+}
+
+unsigned char LoggerParser::peek(int offset) const
+{
+  return ring[(head + offset) % LOGGER_RING_SIZE];
+}
+
+void LoggerParser::copy(char *destination, int length) const
+{
+  int first = LOGGER_RING_SIZE - head;
+  if (first >= length)
+    memcpy(destination, ring + head, length);
+  else
+  {
+    memcpy(destination, ring + head, first);
+    memcpy(destination + first, ring, length - first);
+  }
+}
+
+void LoggerParser::consume(int length)
+{
+  head = (head + length) % LOGGER_RING_SIZE;
+  count -= length;
+}
+
+bool LoggerParser::next(logger_sample &sample)
+{
+  while (count > 0)
+  {
+    // Skip anything that is not the start of a record
+    if (!isRecordStart(peek(0)))
+    {
+      int skipped = 0;
+      while (skipped < count && !isRecordStart(peek(skipped)))
+        skipped++;
+      consume(skipped);
+      malformed++;
+      continue;
+    }
+
+    int length = 0;
+    int result;
+    if (peek(0) == BINARY_MARKER)
+      result = parseBinary(sample, length);
+    else
+      result = parseText(sample, length);
+
+    if (result == 0)
+      return false;
+
+    consume(length);
+    if (result == 1)
+    {
+      samples++;
+      return true;
+    }
+    malformed++;
+  }
+  return false;
+}
+
+// Binary records are framed by the number of values in their header
+int LoggerParser::parseBinary(logger_sample &sample, int &length)
+{
+  if (count < BINARY_RECORD_HEADER)
+    return 0;
+
+  int nValues = peek(4);
+  if (nValues > BINARY_MAX_VALUES)
+  {
+    // Not a header, look for the next record from the following byte
+    length = 1;
+    return -1;
+  }
+
+  length = BINARY_RECORD_HEADER + 4 * nValues;
+  if (count < length)
+    return 0;
+
+  char frame[BINARY_MAX_LENGTH];
+  copy(frame, length);
+  sample.nValues = abb_comm::decodeRecord(frame, &sample.type, NULL, NULL,
+      &sample.time, sample.values, BINARY_MAX_VALUES);
+
+  if (sample.type < 0 || sample.type >= NUM_LOG_TYPES ||
+      sample.nValues != recordValues[sample.type])
+    return -1;
+  return 1;
+}
+
+// Text records ("# type date time stamp values") have no terminator. A
+// record is whole once the next record has started, or once all of its
+// fields have been received and the last one is followed by a space.
+int LoggerParser::parseText(logger_sample &sample, int &length)
+{
+  char record[MAX_LOGGER_RECORD + 1];
+
+  // Find where the next record starts
+  int end = 1;
+  while (end < count && end < MAX_LOGGER_RECORD && !isRecordStart(peek(end)))
+    end++;
+  bool terminated = (end < count && end < MAX_LOGGER_RECORD);
+  copy(record, end);
+  record[end] = '\0';
+
+  // Split the record into fields
+  int starts[TEXT_FIELDS + BINARY_MAX_VALUES];
+  int ends[TEXT_FIELDS + BINARY_MAX_VALUES];
+  int nFields = 0;
+  int i = 1;
+  while (i < end)
+  {
+    while (i < end && isSpace(record[i]))
+      i++;
+    if (i == end)
+      break;
+    if (nFields == TEXT_FIELDS + BINARY_MAX_VALUES)
+    {
+      length = end;
+      return -1;
+    }
+    starts[nFields] = i;
+    while (i < end && !isSpace(record[i]))
+      i++;
+    ends[nFields] = i;
+    record[i] = '\0';
+    nFields++;
+    i++;
+  }
+
+  // The type tells how many fields to expect
+  if (nFields == 0)
+  {
+    if (terminated)
+    {
+      length = end;
+      return -1;
+    }
+    return 0;
+  }
+  char *stop;
+  long type = strtol(record + starts[0], &stop, 10);
+  if (*stop != '\0' || type < 0 || type >= NUM_LOG_TYPES)
+  {
+    length = end;
+    return -1;
+  }
+  int expected = TEXT_FIELDS + recordValues[type];
+
+  if (terminated)
+  {
+    length = end;
+    if (nFields != expected)
+      return -1;
+  }
+  else
+  {
+    // Without a following record, the last field may still be growing
+    if (nFields < expected || ends[expected - 1] == end)
+    {
+      if (end >= MAX_LOGGER_RECORD)
+      {
+        length = end;
+        return -1;
+      }
+      return 0;
+    }
+    length = ends[expected - 1] + 1;
+  }
+
+  sample.type = (int)type;
+  sample.time = strtod(record + starts[TEXT_FIELDS - 1], &stop);
+  if (*stop != '\0')
+    return -1;
+  sample.nValues = recordValues[type];
+  for (int v = 0; v < sample.nValues; v++)
+  {
+    sample.values[v] = strtod(record + starts[TEXT_FIELDS + v], &stop);
+    if (*stop != '\0')
+      return -1;
+  }
+  return 1;
+}
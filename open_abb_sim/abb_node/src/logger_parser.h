@@ -0,0 +1,74 @@
+#ifndef LOGGER_PARSER_H
+#define LOGGER_PARSER_H
+
+#include "abb_comm.h"
+
+// Size of the ring buffer holding the bytes received from the logger
+#define LOGGER_RING_SIZE 4096
+
+// Longest text record accepted (longer ones are malformed)
+#define MAX_LOGGER_RECORD 160
+
+typedef enum
+{
+  LOG_CARTESIAN = 0,
+  LOG_JOINTS,
+  LOG_FORCE,
+  NUM_LOG_TYPES
+} LOG_TYPE;
+
+typedef struct
+{
+  int type;       // LOG_TYPE of the sample
+  double time;    // Time stamp from the robot (s)
+  int nValues;
+  double values[BINARY_MAX_VALUES];  // In the robot's units (mm, deg, N)
+} logger_sample;
+
+/** \class LoggerParser
+    \brief Incremental parser of the logger stream.
+    Received bytes are appended to a ring buffer, and samples are taken out
+    as soon as a whole record is available, so records split over several
+    receives are reassembled instead of lost. Text records ("# type date
+    time stamp values") and binary records (see abb_comm.h) can be mixed.
+    Nothing is allocated after construction.
+*/
+class LoggerParser
+{
+ public:
+  LoggerParser();
+
+  // Space to receive bytes into, contiguous in the ring buffer. Returns the
+  // number of bytes that fit at the returned position.
+  char *receiveBuffer(int &space);
+
+  // Append the bytes received into receiveBuffer()
+  void received(int length);
+
+  // Take the next whole sample out of the buffer. Returns false if no
+  // whole sample has been received yet.
+  bool next(logger_sample &sample);
+
+  // Counters
+  unsigned long samples;    // Samples parsed
+  unsigned long malformed;  // Records that could not be parsed
+  unsigned long dropped;    // Records lost because the buffer overflowed
+
+ private:
+  // Bytes in the buffer
+  int available() const { return count; }
+  unsigned char peek(int offset) const;
+  void copy(char *destination, int length) const;
+  void consume(int length);
+
+  // Parse the record at the start of the buffer. They return 1 for a
+  // sample, 0 if the record is incomplete and -1 if it is malformed.
+  int parseBinary(logger_sample &sample, int &length);
+  int parseText(logger_sample &sample, int &length);
+
+  char ring[LOGGER_RING_SIZE];
+  int head;   // Position of the first byte
+  int count;  // Number of bytes
+};
+
+#endif
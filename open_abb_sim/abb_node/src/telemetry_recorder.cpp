@@ -0,0 +1,165 @@
+//
+// Telemetry Recorder
+//
+// Records the samples of the logger stream to a preallocated ring file,
+// which is memory-mapped so that recording costs a copy per sample.
+//
+
+#include "telemetry_recorder.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+// Names and number of values of the logger record types
+static const char *groupNames[NUM_LOG_TYPES] = {"cartesian", "joints", "force"};
+static const uint32_t groupValues[NUM_LOG_TYPES] = {7, 6, 6};
+
+// The position of a Cartesian sample is a distance, its quaternion is not
+#define CARTESIAN_LINEAR_MASK 0x7
+
+static int64_t nanoseconds(clockid_t clock)
+{
+  struct timespec now;
+  clock_gettime(clock, &now);
+  return (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+TelemetryRecorder::TelemetryRecorder()
+{
+  mapping = NULL;
+  mappingSize = 0;
+  fd = -1;
+  header = NULL;
+  records = NULL;
+  written = 0;
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+  close();
+}
+
+bool TelemetryRecorder::open(const char *path, unsigned long capacity)
+{
+  close();
+
+  // The capacity is limited to what a mapping (and a signed file offset)
+  // can hold
+  size_t maxSize = (size_t)-1;
+  if (sizeof(off_t) <= sizeof(size_t))
+    maxSize >>= 1;
+  if (capacity == 0 ||
+      capacity > (maxSize - TELEMETRY_HEADER_SIZE) / sizeof(telemetry_record))
+  {
+    errno = EINVAL;
+    return false;
+  }
+
+  fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+    return false;
+
+  // Reserve the blocks now, so that a full disk is noticed here instead of
+  // as a SIGBUS while recording. posix_fallocate returns its error instead
+  // of setting errno, and only a file system that can not reserve blocks
+  // falls back to a sparse file.
+  mappingSize = TELEMETRY_HEADER_SIZE + capacity * sizeof(telemetry_record);
+  int allocated = posix_fallocate(fd, 0, mappingSize);
+  if (allocated != 0 &&
+      ((allocated != EOPNOTSUPP && allocated != EINVAL) ||
+       ftruncate(fd, mappingSize) != 0))
+  {
+    int error = (allocated != EOPNOTSUPP && allocated != EINVAL) ?
+        allocated : errno;
+    ::close(fd);
+    fd = -1;
+    errno = error;
+    return false;
+  }
+  void *address = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, fd, 0);
+  if (address == MAP_FAILED)
+  {
+    int error = errno;
+    ::close(fd);
+    fd = -1;
+    errno = error;
+    return false;
+  }
+
+  // Touch every page, so that appending never faults them in
+  mapping = address;
+  memset(mapping, 0, mappingSize);
+  mlock(mapping, mappingSize);
+
+  header = (telemetry_header *)mapping;
+  records = (telemetry_record *)((char *)mapping + TELEMETRY_HEADER_SIZE);
+  written = 0;
+
+  memcpy(header->magic, TELEMETRY_MAGIC, sizeof(header->magic));
+  header->version = TELEMETRY_VERSION;
+  header->record_size = sizeof(telemetry_record);
+  header->capacity = capacity;
+  header->start_wall_ns = nanoseconds(CLOCK_REALTIME);
+  header->start_steady_ns = nanoseconds(CLOCK_MONOTONIC);
+  header->source = TELEMETRY_SOURCE_LOGGER;
+  header->num_groups = NUM_LOG_TYPES;
+  for (int i = 0; i < NUM_LOG_TYPES; i++)
+  {
+    strncpy(header->groups[i].name, groupNames[i],
+        sizeof(header->groups[i].name) - 1);
+    header->groups[i].num_joints = groupValues[i];
+    header->groups[i].num_robot_joints = groupValues[i];
+  }
+  header->groups[LOG_CARTESIAN].linear_mask = CARTESIAN_LINEAR_MASK;
+  return true;
+}
+
+void TelemetryRecorder::close()
+{
+  if (mapping == NULL)
+    return;
+  msync(mapping, mappingSize, MS_ASYNC);
+  munmap(mapping, mappingSize);
+  ::close(fd);
+  mapping = NULL;
+  header = NULL;
+  records = NULL;
+  fd = -1;
+}
+
+void TelemetryRecorder::append(const logger_sample &sample)
+{
+  if (mapping == NULL)
+    return;
+
+  uint64_t index = written++;
+  telemetry_record &record = records[index % header->capacity];
+
+  // Invalidate the slot before overwriting it, so that readers never accept
+  // a torn record
+  __atomic_store_n(&record.sequence, 0, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+
+  int count = sample.nValues;
+  if (count > TELEMETRY_MAX_VALUES)
+    count = TELEMETRY_MAX_VALUES;
+  telemetry_sample &recorded = record.sample;
+  recorded.stamp_ns = nanoseconds(CLOCK_MONOTONIC);
+  recorded.source_time = sample.time;
+  recorded.group = (uint16_t)sample.type;
+  recorded.kind = TELEMETRY_KIND_LOGGER;
+  recorded.num_values = (uint8_t)count;
+  for (int i = 0; i < count; i++)
+  {
+    recorded.positions[i] = sample.values[i];
+    recorded.velocities[i] = 0.0;
+  }
+
+  __atomic_store_n(&record.sequence, index + 1, __ATOMIC_RELEASE);
+  __atomic_store_n(&header->written, written, __ATOMIC_RELEASE);
+}
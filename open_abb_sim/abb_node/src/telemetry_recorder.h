@@ -0,0 +1,101 @@
+#ifndef TELEMETRY_RECORDER_H
+#define TELEMETRY_RECORDER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "logger_parser.h"
+
+// Layout of a telemetry file: a header of TELEMETRY_HEADER_SIZE bytes,
+// followed by a ring of fixed-size records. It is the layout of
+// abb_ros2_sim's abb_hardware_interface/telemetry_recorder.hpp, so that
+// abb_telemetry_tool can dump and replay the recordings of both drivers.
+// All fields are in host byte order.
+#define TELEMETRY_MAGIC "ABBTLM01"
+#define TELEMETRY_VERSION 1
+#define TELEMETRY_HEADER_SIZE 4096
+#define TELEMETRY_MAX_GROUPS 8
+#define TELEMETRY_MAX_VALUES 12
+
+// Producer of the file, and kind of its records
+#define TELEMETRY_SOURCE_LOGGER 1
+#define TELEMETRY_KIND_LOGGER 2
+
+typedef struct
+{
+  char name[32];
+  uint32_t num_joints;
+  uint32_t num_robot_joints;
+  uint32_t linear_mask;  // Bit i is set if value i is a distance
+  uint32_t reserved;
+} telemetry_group;
+
+typedef struct
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t capacity;
+  uint64_t written;          // Records appended, record i is in slot i % capacity
+  int64_t start_wall_ns;     // CLOCK_REALTIME when the file was created
+  int64_t start_steady_ns;   // CLOCK_MONOTONIC at the same time
+  uint32_t source;
+  uint32_t num_groups;
+  telemetry_group groups[TELEMETRY_MAX_GROUPS];  // One per LOG_TYPE
+} telemetry_header;
+
+typedef struct
+{
+  int64_t stamp_ns;    // CLOCK_MONOTONIC when the sample was recorded
+  double source_time;  // Time stamp from the robot (s)
+  uint16_t group;      // LOG_TYPE of the sample
+  uint8_t kind;
+  uint8_t num_values;
+  uint32_t reserved;
+  double positions[TELEMETRY_MAX_VALUES];   // The logger values (mm, deg, N)
+  double velocities[TELEMETRY_MAX_VALUES];  // Zero, the logger has none
+} telemetry_sample;
+
+typedef struct
+{
+  uint64_t sequence;  // Index of the record plus one, zero while written
+  telemetry_sample sample;
+} telemetry_record;
+
+/** \class TelemetryRecorder
+    \brief Records the logger samples to a memory-mapped ring file.
+    The file is created with its final size, mapped and touched when it is
+    opened, so that appending a sample is a copy into the mapping: it does
+    not allocate or make a system call, and does not slow down the logger
+    thread. Once the ring is full, the oldest samples are overwritten.
+    Records are published with a sequence number, so the file can be read
+    while it is written. Only one thread may append.
+*/
+class TelemetryRecorder
+{
+ public:
+  TelemetryRecorder();
+  ~TelemetryRecorder();
+
+  // Create (or replace) the file, with room for capacity samples. Returns
+  // false if it could not be created, with errno set.
+  bool open(const char *path, unsigned long capacity);
+
+  // Unmap and close the file, which keeps the samples
+  void close();
+
+  bool isOpen() const { return mapping != NULL; }
+
+  // Append a sample. Does nothing if no file is open.
+  void append(const logger_sample &sample);
+
+ private:
+  void *mapping;
+  size_t mappingSize;
+  int fd;
+  telemetry_header *header;
+  telemetry_record *records;
+  uint64_t written;
+};
+
+#endif
@@ -0,0 +1,232 @@
+//
+// Joint Trajectory
+//
+// Time parameterization of joint waypoints with quintic segments, limited
+// by the velocity and acceleration of each joint.
+//
+
+#include "trajectory.h"
+
+#include <math.h>
+#include <algorithm>
+
+// Peak velocity and acceleration of a quintic from rest to rest over a
+// distance h in a time T are 15/8 h/T and 10/sqrt(3) h/T^2
+#define QUINTIC_PEAK_VEL 1.875
+#define QUINTIC_PEAK_ACC 5.7735027
+
+// Segments between these ratios of their limits are not adjusted further
+#define TRAJ_RATIO_LOW 0.99
+#define TRAJ_RATIO_HIGH 1.0
+
+// Waypoints closer than this on every joint (rad) are the same
+#define TRAJ_SAME_POINT 1e-9
+
+JointTrajectory::JointTrajectory() : numJoints(0), numSegments(0)
+{
+}
+
+bool JointTrajectory::plan(const double waypoints[], int numWaypoints,
+    int numJoints, const joint_limits limits[])
+{
+  this->numJoints = 0;
+  numSegments = 0;
+  points.clear();
+  startTimes.clear();
+  position.clear();
+  velocity.clear();
+  acceleration.clear();
+
+  if (numWaypoints < 1 || numJoints < 1)
+    return false;
+  for (int j = 0; j < numJoints; j++)
+  {
+    if (limits[j].velocity <= 0.0 || limits[j].acceleration <= 0.0)
+      return false;
+  }
+
+  // Check the limits, and drop the waypoints that repeat the previous one
+  for (int i = 0; i < numWaypoints; i++)
+  {
+    const double *p = waypoints + numJoints * i;
+    bool same = (i > 0);
+    for (int j = 0; j < numJoints; j++)
+    {
+      if (p[j] < limits[j].lower || p[j] > limits[j].upper)
+        return false;
+      if (same && fabs(p[j] - points[points.size() - numJoints + j]) >
+          TRAJ_SAME_POINT)
+        same = false;
+    }
+    if (!same)
+      points.insert(points.end(), p, p + numJoints);
+  }
+
+  this->numJoints = numJoints;
+  jointLimits.assign(limits, limits + numJoints);
+  numSegments = points.size() / numJoints - 1;
+
+  // Start with the time of a stop at each waypoint, which is within the
+  // limits, and adjust the segments to their limits from there
+  std::vector<double> durations(numSegments);
+  for (int k = 0; k < numSegments; k++)
+  {
+    double T = TRAJ_MIN_SEGMENT_TIME;
+    for (int j = 0; j < numJoints; j++)
+    {
+      double h = fabs(points[numJoints * (k + 1) + j] -
+          points[numJoints * k + j]);
+      T = std::max(T, QUINTIC_PEAK_VEL * h / limits[j].velocity);
+      T = std::max(T, sqrt(QUINTIC_PEAK_ACC * h / limits[j].acceleration));
+    }
+    durations[k] = T;
+  }
+
+  std::vector<double> ratios(numSegments);
+  for (int iteration = 0; iteration < TRAJ_MAX_ITERATIONS; iteration++)
+  {
+    fitSegments(durations);
+    bool converged = true;
+    for (int k = 0; k < numSegments; k++)
+    {
+      ratios[k] = limitRatio(k, durations);
+      if (ratios[k] < TRAJ_RATIO_LOW || ratios[k] > TRAJ_RATIO_HIGH)
+        converged = false;
+    }
+    if (converged)
+      break;
+
+    // Slow down the segments over their limits, and speed up the others by
+    // half of their margin, since they also change the via points
+    for (int k = 0; k < numSegments; k++)
+    {
+      if (ratios[k] > TRAJ_RATIO_HIGH)
+        durations[k] *= ratios[k];
+      else if (ratios[k] < TRAJ_RATIO_LOW)
+        durations[k] *= (1.0 + ratios[k]) / 2.0;
+      durations[k] = std::max(durations[k], TRAJ_MIN_SEGMENT_TIME);
+    }
+  }
+
+  // If the iterations did not settle, slow down the whole trajectory. The
+  // via velocities scale with 1 / r and the accelerations with 1 / r^2, so
+  // the largest ratio is then exactly 1.
+  fitSegments(durations);
+  double worst = 0.0;
+  for (int k = 0; k < numSegments; k++)
+    worst = std::max(worst, limitRatio(k, durations));
+  if (worst > TRAJ_RATIO_HIGH)
+  {
+    for (int k = 0; k < numSegments; k++)
+      durations[k] *= worst;
+    fitSegments(durations);
+  }
+
+  startTimes.resize(numSegments + 1);
+  startTimes[0] = 0.0;
+  for (int k = 0; k < numSegments; k++)
+    startTimes[k + 1] = startTimes[k] + durations[k];
+  return true;
+}
+
+void JointTrajectory::fitSegments(const std::vector<double> &durations)
+{
+  position.resize(numSegments * numJoints);
+  velocity.resize(numSegments * numJoints);
+  acceleration.resize(numSegments * numJoints);
+
+  for (int j = 0; j < numJoints; j++)
+  {
+    // Velocity and acceleration at the start of segment k
+    double v0 = 0.0;
+    double a0 = 0.0;
+    for (int k = 0; k < numSegments; k++)
+    {
+      double p0 = points[numJoints * k + j];
+      double p1 = points[numJoints * (k + 1) + j];
+      double T = durations[k];
+
+      // At a via point, the velocity is the average of the slopes of the
+      // segments around it, each weighted with the duration of the other
+      // one, and zero where the joint turns back. The ends are at rest.
+      double v1 = 0.0;
+      double a1 = 0.0;
+      if (k + 1 < numSegments)
+      {
+        double Tn = durations[k + 1];
+        double s = (p1 - p0) / T;
+        double sn = (points[numJoints * (k + 2) + j] - p1) / Tn;
+        if (s * sn > 0.0)
+          v1 = (s * Tn + sn * T) / (T + Tn);
+        a1 = 2.0 * (sn - s) / (T + Tn);
+      }
+
+      Polynom &p = position[numJoints * k + j];
+      p.quintic(T, p0, v0, a0, p1, v1, a1);
+      velocity[numJoints * k + j] = p.derivative();
+      acceleration[numJoints * k + j] = velocity[numJoints * k + j].derivative();
+      v0 = v1;
+      a0 = a1;
+    }
+  }
+}
+
+double JointTrajectory::limitRatio(int k,
+    const std::vector<double> &durations) const
+{
+  double ratio = 0.0;
+  for (int j = 0; j < numJoints; j++)
+  {
+    const Polynom &v = velocity[numJoints * k + j];
+    const Polynom &a = acceleration[numJoints * k + j];
+    double peakV = 0.0;
+    double peakA = 0.0;
+    for (int i = 0; i <= TRAJ_PEAK_SAMPLES; i++)
+    {
+      double t = durations[k] * i / TRAJ_PEAK_SAMPLES;
+      peakV = std::max(peakV, fabs(v(t)));
+      peakA = std::max(peakA, fabs(a(t)));
+    }
+    ratio = std::max(ratio, peakV / jointLimits[j].velocity);
+    ratio = std::max(ratio, sqrt(peakA / jointLimits[j].acceleration));
+  }
+  return ratio;
+}
+
+double JointTrajectory::duration() const
+{
+  return numSegments > 0 ? startTimes[numSegments] : 0.0;
+}
+
+void JointTrajectory::sample(double t, double pos[], double vel[],
+    double acc[]) const
+{
+  if (numSegments == 0)
+  {
+    for (int j = 0; j < numJoints; j++)
+    {
+      pos[j] = points[j];
+      if (vel)
+        vel[j] = 0.0;
+      if (acc)
+        acc[j] = 0.0;
+    }
+    return;
+  }
+
+  // Segment that contains t
+  t = std::max(0.0, std::min(t, startTimes[numSegments]));
+  int k = std::upper_bound(startTimes.begin(), startTimes.end(), t) -
+    startTimes.begin() - 1;
+  k = std::max(0, std::min(k, numSegments - 1));
+  t -= startTimes[k];
+
+  for (int j = 0; j < numJoints; j++)
+  {
+    pos[j] = position[numJoints * k + j](t);
+    if (vel)
+      vel[j] = velocity[numJoints * k + j](t);
+    if (acc)
+      acc[j] = acceleration[numJoints * k + j](t);
+  }
+}
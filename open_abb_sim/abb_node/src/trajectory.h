@@ -0,0 +1,75 @@
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <vector>
+
+#include "matVec.h"
+
+// Samples of each segment checked for its peak velocity and acceleration
+#define TRAJ_PEAK_SAMPLES 64
+
+// Iterations adjusting the segment durations to the limits
+#define TRAJ_MAX_ITERATIONS 30
+
+// Shortest segment (s)
+#define TRAJ_MIN_SEGMENT_TIME 0.001
+
+typedef struct
+{
+  double lower;         // Position limits (rad)
+  double upper;
+  double velocity;      // Largest velocity (rad/s)
+  double acceleration;  // Largest acceleration (rad/s^2)
+} joint_limits;
+
+/** \class JointTrajectory
+    \brief Time parameterization of a path of joint waypoints.
+    The path goes through the waypoints with a quintic polynomial per
+    segment, with a continuous velocity and acceleration, and stops at
+    both ends. The segment durations are adjusted until each segment
+    reaches the velocity or acceleration limit of one of its joints, so
+    the trajectory is as fast as the limits allow for its waypoints.
+*/
+class JointTrajectory
+{
+ public:
+  JointTrajectory();
+
+  // Plan the trajectory through numWaypoints waypoints of numJoints
+  // positions each (rad), with the limits of each joint. Returns false if
+  // a waypoint is outside the position limits, or a limit is not positive.
+  bool plan(const double waypoints[], int numWaypoints, int numJoints,
+      const joint_limits limits[]);
+
+  // Duration of the trajectory (s), zero if it does not move
+  double duration() const;
+
+  int joints() const { return numJoints; }
+
+  // Position (and optionally velocity and acceleration) of the joints at
+  // time t, which is clamped to the trajectory
+  void sample(double t, double pos[], double vel[] = NULL,
+      double acc[] = NULL) const;
+
+ private:
+  // Fit the polynomials of the segments for the given durations, with the
+  // via velocities and accelerations estimated from the segments around
+  // each via point
+  void fitSegments(const std::vector<double> &durations);
+
+  // Largest ratio of the peak velocity or acceleration to the limits over
+  // the joints of segment k, where 1 is at the limit. The acceleration
+  // ratio is a square root, so that both scale with 1 / duration.
+  double limitRatio(int k, const std::vector<double> &durations) const;
+
+  int numJoints;
+  int numSegments;
+  std::vector<double> points;     // Waypoints without repeats
+  std::vector<joint_limits> jointLimits;
+  std::vector<double> startTimes; // Start of each segment, and the end
+  std::vector<Polynom> position;  // Segment k joint j is k*numJoints + j
+  std::vector<Polynom> velocity;
+  std::vector<Polynom> acceleration;
+};
+
+#endif